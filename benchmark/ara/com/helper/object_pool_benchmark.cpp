@@ -0,0 +1,118 @@
+#include <stdint.h>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../../../../src/ara/com/helper/object_pool.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Object of a pooled entry size
+            struct PooledObject
+            {
+                std::array<uint64_t, 6> Fields;
+            };
+
+            using Clock = std::chrono::steady_clock;
+
+            /// @brief Default allocator with the same interface as the pool
+            class DefaultAllocator
+            {
+            public:
+                void *Allocate(std::size_t size)
+                {
+                    return ::operator new(size);
+                }
+
+                void Deallocate(void *pointer, std::size_t /*size*/) noexcept
+                {
+                    ::operator delete(pointer);
+                }
+            };
+
+            /// @brief Run the contended allocation benchmark on an allocator
+            /// @tparam Allocator Allocator type with Allocate and Deallocate functions
+            /// @param name Allocator name to be printed
+            /// @param allocator Allocator shared by all the threads
+            /// @param threadCount Number of the allocating threads
+            /// @param roundCount Number of the allocation rounds per thread
+            /// @note Each round allocates a burst of objects and then releases them,
+            /// similar to decoding and dropping a received SD message.
+            template <typename Allocator>
+            void RunBenchmark(
+                const char *name,
+                Allocator &allocator,
+                int threadCount,
+                std::size_t roundCount)
+            {
+                const std::size_t cBurstSize = 32;
+                std::vector<std::thread> _threads;
+
+                auto _start = Clock::now();
+
+                for (int i = 0; i < threadCount; ++i)
+                {
+                    _threads.emplace_back(
+                        [&]()
+                        {
+                            std::array<void *, cBurstSize> _blocks;
+
+                            for (std::size_t j = 0; j < roundCount; ++j)
+                            {
+                                for (auto &_block : _blocks)
+                                {
+                                    _block = allocator.Allocate(sizeof(PooledObject));
+                                    // Touch the block as the object construction would do
+                                    static_cast<PooledObject *>(_block)->Fields[0] = j;
+                                }
+
+                                for (auto _block : _blocks)
+                                {
+                                    allocator.Deallocate(_block, sizeof(PooledObject));
+                                }
+                            }
+                        });
+                }
+
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                auto _stop = Clock::now();
+
+                const double cSeconds = std::chrono::duration<double>(_stop - _start).count();
+                const double cOperations = 2.0 * cBurstSize * roundCount * threadCount;
+
+                std::cout << name << " " << threadCount << " threads: "
+                          << cOperations / cSeconds / 1e6 << " M new/delete per second" << std::endl;
+            }
+        }
+    }
+}
+
+int main()
+{
+    using namespace ara::com::helper;
+
+    const std::size_t cRoundCount = 100000;
+    const int cMaxThreadCount = 8;
+
+    DefaultAllocator _defaultAllocator;
+    ObjectPool<PooledObject> _lockedPool;
+    ObjectPool<PooledObject> &_threadCachedPool = ObjectPool<PooledObject>::Instance();
+
+    for (int _threadCount = 1; _threadCount <= cMaxThreadCount; _threadCount *= 2)
+    {
+        RunBenchmark("Default allocator", _defaultAllocator, _threadCount, cRoundCount);
+        RunBenchmark("Locked pool", _lockedPool, _threadCount, cRoundCount);
+        RunBenchmark("Thread-cached pool", _threadCachedPool, _threadCount, cRoundCount);
+    }
+
+    return 0;
+}
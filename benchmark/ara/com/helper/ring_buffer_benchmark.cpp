@@ -0,0 +1,143 @@
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../../../../src/ara/com/helper/concurrent_queue.h"
+#include "../../../../src/ara/com/helper/ring_buffer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            using Clock = std::chrono::steady_clock;
+
+            static int64_t getTimestamp()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           Clock::now().time_since_epoch())
+                    .count();
+            }
+
+            static void printResult(
+                const char *buffer,
+                int producerCount,
+                int consumerCount,
+                std::size_t elementCount,
+                double seconds,
+                std::vector<int64_t> &latencies)
+            {
+                std::sort(latencies.begin(), latencies.end());
+                const int64_t cMedian = latencies[latencies.size() / 2];
+                const int64_t cPercentile99 = latencies[latencies.size() * 99 / 100];
+
+                std::cout << buffer << " " << producerCount << "P/" << consumerCount << "C: "
+                          << elementCount / seconds / 1e6 << " M elements/s, latency p50 "
+                          << cMedian << " ns, p99 " << cPercentile99 << " ns" << std::endl;
+            }
+
+            /// @brief Run the throughput and enqueue-to-dequeue latency benchmark on a buffer
+            /// @tparam Buffer Buffer type with TryEnqueue and TryDequeue functions on timestamps
+            /// @param name Buffer name to be printed
+            /// @param producerCount Number of the producer threads
+            /// @param consumerCount Number of the consumer threads
+            /// @param elementCount Total number of the transferred elements
+            template <typename Buffer>
+            void RunBenchmark(
+                const char *name,
+                int producerCount,
+                int consumerCount,
+                std::size_t elementCount)
+            {
+                Buffer _buffer;
+                std::atomic_size_t _consumed{0};
+                std::vector<std::vector<int64_t>> _latencies(consumerCount);
+                std::vector<std::thread> _threads;
+                const std::size_t cProducerElementCount = elementCount / producerCount;
+                const std::size_t cTotalElementCount = cProducerElementCount * producerCount;
+
+                auto _start = Clock::now();
+
+                for (int i = 0; i < consumerCount; ++i)
+                {
+                    _latencies[i].reserve(cTotalElementCount);
+                    _threads.emplace_back(
+                        [&, i]()
+                        {
+                            while (_consumed < cTotalElementCount)
+                            {
+                                int64_t _timestamp;
+                                if (_buffer.TryDequeue(_timestamp))
+                                {
+                                    _latencies[i].push_back(getTimestamp() - _timestamp);
+                                    ++_consumed;
+                                }
+                                else
+                                {
+                                    std::this_thread::yield();
+                                }
+                            }
+                        });
+                }
+
+                for (int i = 0; i < producerCount; ++i)
+                {
+                    _threads.emplace_back(
+                        [&]()
+                        {
+                            for (std::size_t j = 0; j < cProducerElementCount; ++j)
+                            {
+                                while (!_buffer.TryEnqueue(getTimestamp()))
+                                {
+                                    std::this_thread::yield();
+                                }
+                            }
+                        });
+                }
+
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                auto _stop = Clock::now();
+
+                std::vector<int64_t> _allLatencies;
+                _allLatencies.reserve(cTotalElementCount);
+                for (const auto &_consumerLatencies : _latencies)
+                {
+                    _allLatencies.insert(
+                        _allLatencies.end(), _consumerLatencies.begin(), _consumerLatencies.end());
+                }
+
+                printResult(
+                    name, producerCount, consumerCount, cTotalElementCount,
+                    std::chrono::duration<double>(_stop - _start).count(), _allLatencies);
+            }
+        }
+    }
+}
+
+int main()
+{
+    using namespace ara::com::helper;
+
+    const std::size_t cElementCount = 1000000;
+    const int cMaxProducerCount = 16;
+
+    RunBenchmark<SpscRingBuffer<int64_t>>("SPSC ring", 1, 1, cElementCount);
+
+    for (int _producerCount = 1; _producerCount <= cMaxProducerCount; _producerCount *= 2)
+    {
+        RunBenchmark<ConcurrentQueue<int64_t>>("ConcurrentQueue", _producerCount, 1, cElementCount);
+        RunBenchmark<MpscRingBuffer<int64_t>>("MPSC ring", _producerCount, 1, cElementCount);
+        RunBenchmark<MpmcRingBuffer<int64_t>>("MPMC ring", _producerCount, 1, cElementCount);
+        RunBenchmark<MpmcRingBuffer<int64_t>>("MPMC ring", _producerCount, _producerCount, cElementCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../src/ara/com/helper/shared_memory_network_layer.h"
+#include "../../../../src/ara/com/helper/udp_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            using SdMessage = someip::sd::SomeIpSdMessage;
+
+            static SdMessage getMessage()
+            {
+                SdMessage _result;
+                _result.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+
+                return _result;
+            }
+
+            static void printResult(const char *transport, std::size_t roundTrips, double seconds)
+            {
+                std::cout << transport << ": "
+                          << seconds * 1e6 / roundTrips << " us/round trip ("
+                          << roundTrips << " round trips)" << std::endl;
+            }
+
+            /// @brief Run the ping-pong round trip benchmark over a pair of shared-memory rings
+            /// @param roundTrips Number of the round trips
+            void RunSharedMemoryBenchmark(std::size_t roundTrips)
+            {
+                using ShmLayer = SharedMemoryNetworkLayer<SdMessage>;
+
+                const std::string cPingRingName{"/ara_com_benchmark_ping_" + std::to_string(getpid())};
+                const std::string cPongRingName{"/ara_com_benchmark_pong_" + std::to_string(getpid())};
+                const SdMessage cMessage{getMessage()};
+
+                ShmLayer _client(cPingRingName, cPongRingName);
+                ShmLayer _server(cPongRingName, cPingRingName);
+
+                // The server echoes the pings on its receiving thread.
+                _server.SetReceiver(
+                    &_server,
+                    [&_server](std::shared_ptr<const SdMessage> message)
+                    { _server.Send(*message); });
+
+                std::atomic_size_t _pongs{0};
+                _client.SetReceiver(
+                    &_client,
+                    [&_pongs](std::shared_ptr<const SdMessage>)
+                    { ++_pongs; });
+
+                auto _start = std::chrono::steady_clock::now();
+
+                for (std::size_t i = 1; i <= roundTrips; ++i)
+                {
+                    _client.Send(cMessage);
+                    while (_pongs < i)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                auto _stop = std::chrono::steady_clock::now();
+                printResult("shared memory", roundTrips, std::chrono::duration<double>(_stop - _start).count());
+
+                _client.ResetReceiver(&_client);
+                _server.ResetReceiver(&_server);
+            }
+
+            /// @brief Run the ping-pong round trip benchmark over the UDP loopback
+            /// @param roundTrips Number of the round trips
+            void RunUdpBenchmark(std::size_t roundTrips)
+            {
+                using SdNetworkLayer = UdpNetworkLayer<SdMessage>;
+
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cClientPort = 40592;
+                const uint16_t cServerPort = 40593;
+                const int cPollTimeout = 100;
+                const SdMessage cMessage{getMessage()};
+
+                EpollPoller _clientPoller;
+                EpollPoller _serverPoller;
+                SdNetworkLayer _client(&_clientPoller, cLocalhost, cClientPort, cLocalhost, cServerPort);
+                SdNetworkLayer _server(&_serverPoller, cLocalhost, cServerPort, cLocalhost, cClientPort);
+
+                _server.SetReceiver(
+                    &_server,
+                    [&_server](std::shared_ptr<const SdMessage> message)
+                    { _server.Send(*message); });
+
+                std::size_t _pongs = 0;
+                _client.SetReceiver(
+                    &_client,
+                    [&_pongs](std::shared_ptr<const SdMessage>)
+                    { ++_pongs; });
+
+                std::atomic_bool _running{true};
+                std::thread _serverThread(
+                    [&]()
+                    {
+                        while (_running)
+                        {
+                            _serverPoller.TryPoll(cPollTimeout);
+                        }
+                    });
+
+                auto _start = std::chrono::steady_clock::now();
+
+                for (std::size_t i = 1; i <= roundTrips; ++i)
+                {
+                    _client.Send(cMessage);
+                    while (_pongs < i && _clientPoller.TryPoll(cPollTimeout))
+                    {
+                    }
+                }
+
+                auto _stop = std::chrono::steady_clock::now();
+                printResult("UDP loopback", _pongs, std::chrono::duration<double>(_stop - _start).count());
+
+                _running = false;
+                _serverThread.join();
+
+                _client.ResetReceiver(&_client);
+                _server.ResetReceiver(&_server);
+            }
+        }
+    }
+}
+
+int main()
+{
+    const std::size_t cRoundTrips = 100000;
+
+    ara::com::helper::RunUdpBenchmark(cRoundTrips);
+    ara::com::helper::RunSharedMemoryBenchmark(cRoundTrips);
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <iostream>
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../src/ara/com/helper/udp_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            using SdNetworkLayer = UdpNetworkLayer<someip::sd::SomeIpSdMessage>;
+
+            /// @brief Run the loopback throughput benchmark on a single thread (i.e., a single core)
+            /// @param batched Indicates whether to send a whole batch per system call or a datagram per call
+            /// @param numberOfDatagrams Total number of the sent datagrams
+            void RunBenchmark(bool batched, std::size_t numberOfDatagrams)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40590;
+                const uint16_t cReceiverPort = 40591;
+                const int cPollTimeout = 100;
+
+                EpollPoller _poller;
+                SdNetworkLayer _sender(&_poller, cLocalhost, cSenderPort, cLocalhost, cReceiverPort);
+                SdNetworkLayer _receiver(&_poller, cLocalhost, cReceiverPort, cLocalhost, cSenderPort);
+
+                std::size_t _receivedDatagrams = 0;
+                _receiver.SetReceiver(
+                    &_receivedDatagrams,
+                    [&_receivedDatagrams](std::shared_ptr<const someip::sd::SomeIpSdMessage>)
+                    { ++_receivedDatagrams; });
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                const std::vector<std::vector<uint8_t>> cBatch(UdpSocket::cBatchSize, _message.Payload());
+
+                auto _start = std::chrono::steady_clock::now();
+
+                std::size_t _sentDatagrams = 0;
+                while (_sentDatagrams < numberOfDatagrams)
+                {
+                    // Send one batch worth of datagrams and drain them, so the socket buffer never overflows.
+                    if (batched)
+                    {
+                        _sentDatagrams += _sender.SendPayloads(cBatch);
+                    }
+                    else
+                    {
+                        for (const auto &_payload : cBatch)
+                        {
+                            _sender.SendPayload(_payload);
+                        }
+                        _sentDatagrams += cBatch.size();
+                    }
+
+                    while (_receivedDatagrams < _sentDatagrams)
+                    {
+                        if (!_poller.TryPoll(cPollTimeout))
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                auto _stop = std::chrono::steady_clock::now();
+                double _seconds = std::chrono::duration<double>(_stop - _start).count();
+
+                std::cout << (batched ? "sendmmsg batches" : "per-datagram sends")
+                          << ": " << static_cast<std::size_t>(_receivedDatagrams / _seconds)
+                          << " datagrams/s/core (received " << _receivedDatagrams
+                          << ", dropped " << _sentDatagrams - _receivedDatagrams << ")"
+                          << std::endl;
+
+                _receiver.ResetReceiver(&_receivedDatagrams);
+            }
+        }
+    }
+}
+
+int main()
+{
+    const std::size_t cNumberOfDatagrams = 640000;
+
+    ara::com::helper::RunBenchmark(false, cNumberOfDatagrams);
+    ara::com::helper::RunBenchmark(true, cNumberOfDatagrams);
+
+    return 0;
+}
@@ -0,0 +1,223 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_message_view.h"
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+#include "../../../../../src/ara/com/option/loadbalancing_option.h"
+
+namespace
+{
+    std::atomic_size_t sAllocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+    ++sAllocations;
+
+    if (void *_pointer = std::malloc(size))
+    {
+        return _pointer;
+    }
+    else
+    {
+        throw std::bad_alloc();
+    }
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t /*size*/) noexcept
+{
+    std::free(pointer);
+}
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                SomeIpSdMessage CreateOfferMessage(std::size_t numberOfEntries)
+                {
+                    SomeIpSdMessage _result;
+
+                    for (std::size_t i = 0; i < numberOfEntries; ++i)
+                    {
+                        auto _entry =
+                            entry::ServiceEntry::CreateOfferServiceEntry(
+                                static_cast<uint16_t>(i), 1, 1, 0);
+
+                        auto _endpointOption =
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                false,
+                                helper::Ipv4Address(192, 168, 0, 1),
+                                option::Layer4ProtocolType::Udp,
+                                static_cast<uint16_t>(30500 + i));
+                        _entry->AddFirstOption(std::move(_endpointOption));
+
+                        auto _loadBalancingOption =
+                            std::make_unique<option::LoadBalancingOption>(true, 0, 1);
+                        _entry->AddSecondOption(std::move(_loadBalancingOption));
+
+                        _result.AddEntry(std::move(_entry));
+                    }
+
+                    return _result;
+                }
+
+                void RunBenchmark(std::size_t numberOfEntries, std::size_t iterations)
+                {
+                    SomeIpSdMessage _message = CreateOfferMessage(numberOfEntries);
+
+                    // Payload path: one fresh buffer per message
+                    std::size_t _allocationsBefore = sAllocations;
+                    auto _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        auto _payload = _message.Payload();
+                    }
+                    auto _end = std::chrono::steady_clock::now();
+                    std::size_t _payloadAllocations = sAllocations - _allocationsBefore;
+                    auto _payloadDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    // Serialize path: caller-provided buffer reused across messages
+                    std::vector<uint8_t> _buffer;
+                    _message.Serialize(_buffer);
+                    _allocationsBefore = sAllocations;
+                    _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        _buffer.clear();
+                        _message.Serialize(_buffer);
+                    }
+                    _end = std::chrono::steady_clock::now();
+                    std::size_t _serializeAllocations = sAllocations - _allocationsBefore;
+                    auto _serializeDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    // Deserialize path: entries and options are recycled through the object pools
+                    _allocationsBefore = sAllocations;
+                    _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        auto _deserializedMessage = SomeIpSdMessage::Deserialize(_buffer);
+                    }
+                    _end = std::chrono::steady_clock::now();
+                    std::size_t _deserializeAllocations = sAllocations - _allocationsBefore;
+                    auto _deserializeDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    // Lazy path: only the entries of a single service and their options are decoded
+                    const uint16_t cServiceId = 0;
+                    const SomeIpSdMessageView::EntryFilter cFilter(
+                        {entry::EntryType::Offering}, cServiceId);
+                    std::size_t _matches = 0;
+                    _allocationsBefore = sAllocations;
+                    _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        SomeIpSdMessageView _view(_buffer);
+                        for (const entry::EntryRecord &record : _view.Entries(cFilter))
+                        {
+                            option::OptionRecord _option;
+                            _matches += _view.TryGetOption(record.FirstOptionIndex, _option);
+                        }
+                    }
+                    _end = std::chrono::steady_clock::now();
+                    std::size_t _viewAllocations = sAllocations - _allocationsBefore;
+                    auto _viewDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    std::cout
+                        << "entries: " << numberOfEntries
+                        << ", options: " << 2 * numberOfEntries
+                        << ", bytes: " << _buffer.size()
+                        << " | Payload(): "
+                        << static_cast<double>(_payloadAllocations) / iterations << " alloc/msg, "
+                        << _payloadDuration.count() / iterations << " ns/msg"
+                        << " | Serialize(reused buffer): "
+                        << static_cast<double>(_serializeAllocations) / iterations << " alloc/msg, "
+                        << _serializeDuration.count() / iterations << " ns/msg"
+                        << " | Deserialize(): "
+                        << static_cast<double>(_deserializeAllocations) / iterations << " alloc/msg, "
+                        << _deserializeDuration.count() / iterations << " ns/msg"
+                        << " | View(1 service): "
+                        << static_cast<double>(_viewAllocations) / iterations << " alloc/msg, "
+                        << _viewDuration.count() / iterations << " ns/msg"
+                        << (_matches == iterations ? "" : " (mismatch)")
+                        << std::endl;
+                }
+
+                void RunMalformedBenchmark(std::size_t iterations)
+                {
+                    std::vector<uint8_t> _payload = CreateOfferMessage(1).Payload();
+                    // Corrupt the SD flags
+                    const std::size_t cFlagsOffset = 16;
+                    _payload.at(cFlagsOffset) = 0x00;
+
+                    // Exception path: unwinding per malformed message
+                    auto _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        try
+                        {
+                            SomeIpSdMessage::Deserialize(_payload);
+                        }
+                        catch (const std::out_of_range &)
+                        {
+                        }
+                    }
+                    auto _end = std::chrono::steady_clock::now();
+                    auto _throwDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    // Result path: the malformation reason is returned as an error code
+                    std::size_t _allocationsBefore = sAllocations;
+                    _start = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < iterations; ++i)
+                    {
+                        SomeIpSdMessage _message;
+                        SomeIpSdMessage::TryDeserialize(_payload, _message);
+                    }
+                    _end = std::chrono::steady_clock::now();
+                    std::size_t _resultAllocations = sAllocations - _allocationsBefore;
+                    auto _resultDuration =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start);
+
+                    std::cout
+                        << "malformed flags"
+                        << " | Deserialize(throw): "
+                        << _throwDuration.count() / iterations << " ns/msg"
+                        << " | TryDeserialize(): "
+                        << static_cast<double>(_resultAllocations) / iterations << " alloc/msg, "
+                        << _resultDuration.count() / iterations << " ns/msg"
+                        << std::endl;
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    const std::size_t cIterations = 100000;
+
+    for (std::size_t _numberOfEntries : {1, 4, 16, 64})
+    {
+        ara::com::someip::sd::RunBenchmark(_numberOfEntries, cIterations);
+    }
+
+    ara::com::someip::sd::RunMalformedBenchmark(cIterations);
+
+    return 0;
+}
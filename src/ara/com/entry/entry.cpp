@@ -42,28 +42,30 @@ namespace ara
             }
 
             bool Entry::ValidateOption(const option::Option *option) const noexcept
+            {
+                bool _result =
+                    IsOptionAllowed(option->Type(), ContainsOption(option->Type()));
+
+                return _result;
+            }
+
+            bool Entry::IsOptionAllowed(option::OptionType optionType, bool contained) noexcept
             {
                 bool _result;
 
-                switch (option->Type())
+                switch (optionType)
                 {
                 case option::OptionType::Configuration:
                 {
-                    bool _containsConfiguration =
-                        ContainsOption(option::OptionType::Configuration);
-
                     // Each entry can only have at maximum one configuration option.
-                    _result = !_containsConfiguration;
+                    _result = !contained;
 
                     break;
                 }
                 case option::OptionType::LoadBalancing:
                 {
-                    bool _containsLoadBalancing =
-                        ContainsOption(option::OptionType::LoadBalancing);
-
                     // Each entry can only have at maximum one load balancing option.
-                    _result = !_containsLoadBalancing;
+                    _result = !contained;
 
                     break;
                 }
@@ -133,71 +135,174 @@ namespace ara
                 return mTTL;
             }
 
-            const std::vector<std::unique_ptr<option::Option>> &Entry::FirstOptions() const noexcept
+            const std::vector<std::shared_ptr<const option::Option>> &Entry::FirstOptions() const noexcept
             {
                 return mFirstOptions;
             }
 
             void Entry::AddFirstOption(std::unique_ptr<option::Option> firstOption)
             {
-                bool _valid = ValidateOption(firstOption.get());
+                bool _added = TryAddFirstOption(std::shared_ptr<const option::Option>{std::move(firstOption)});
 
-                if (_valid)
+                if (!_added)
                 {
-                    mFirstOptions.push_back(std::move(firstOption));
+                    throw std::invalid_argument("The option cannot be added.");
                 }
-                else
+            }
+
+            bool Entry::TryAddFirstOption(const std::shared_ptr<const option::Option> &firstOption)
+            {
+                bool _valid = ValidateOption(firstOption.get());
+
+                if (_valid)
                 {
-                    throw std::invalid_argument("The option cannot be added.");
+                    mFirstOptions.push_back(firstOption);
                 }
+
+                return _valid;
             }
 
-            const std::vector<std::unique_ptr<option::Option>> &Entry::SecondOptions() const noexcept
+            const std::vector<std::shared_ptr<const option::Option>> &Entry::SecondOptions() const noexcept
             {
                 return mSecondOptions;
             }
 
             void Entry::AddSecondOption(std::unique_ptr<option::Option> secondOption)
             {
-                bool _valid = ValidateOption(secondOption.get());
+                bool _added = TryAddSecondOption(std::shared_ptr<const option::Option>{std::move(secondOption)});
 
-                if (_valid)
+                if (!_added)
                 {
-                    mSecondOptions.push_back(std::move(secondOption));
+                    throw std::invalid_argument("The option cannot be added.");
                 }
-                else
+            }
+
+            bool Entry::TryAddSecondOption(const std::shared_ptr<const option::Option> &secondOption)
+            {
+                bool _valid = ValidateOption(secondOption.get());
+
+                if (_valid)
                 {
-                    throw std::invalid_argument("The option cannot be added.");
+                    mSecondOptions.push_back(secondOption);
                 }
+
+                return _valid;
             }
 
-            std::vector<uint8_t> Entry::BasePayload(uint8_t &optionIndex) const
+            std::size_t Entry::BaseSerializeTo(
+                uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const
             {
-                std::vector<uint8_t> _result;
+                if (cap < cEntrySize)
+                {
+                    throw std::out_of_range(
+                        "The buffer capacity is not enough for the entry.");
+                }
+
+                std::size_t _offset = 0;
 
                 uint8_t _type = static_cast<uint8_t>(Type());
-                _result.push_back(_type);
+                dst[_offset++] = _type;
 
-                _result.push_back(optionIndex);
+                dst[_offset++] = optionIndex;
                 uint8_t _firstOptionsSize = FirstOptions().size();
                 optionIndex += _firstOptionsSize;
 
-                _result.push_back(optionIndex);
+                dst[_offset++] = optionIndex;
                 uint8_t _secondOptionsSize = SecondOptions().size();
                 optionIndex += _secondOptionsSize;
 
                 _firstOptionsSize <<= cOptionSizeBitLength;
                 _firstOptionsSize |= _secondOptionsSize;
-                _result.push_back(_firstOptionsSize);
+                dst[_offset++] = _firstOptionsSize;
 
-                helper::Inject(_result, ServiceId());
-                helper::Inject(_result, InstanceId());
+                helper::Inject(dst, _offset, ServiceId());
+                helper::Inject(dst, _offset, InstanceId());
 
                 const uint8_t cTTLSizeBitLength = 24;
                 uint32_t _majorVersion = MajorVersion();
                 _majorVersion <<= cTTLSizeBitLength;
                 _majorVersion |= TTL();
-                helper::Inject(_result, _majorVersion);
+                helper::Inject(dst, _offset, _majorVersion);
+
+                return _offset;
+            }
+
+            std::size_t Entry::SerializeRecordTo(
+                const EntryRecord &record, uint8_t *dst, std::size_t cap)
+            {
+                if (cap < cEntrySize)
+                {
+                    throw std::out_of_range(
+                        "The buffer capacity is not enough for the entry.");
+                }
+
+                std::size_t _offset = 0;
+
+                dst[_offset++] = static_cast<uint8_t>(record.Type);
+                dst[_offset++] = record.FirstOptionIndex;
+                dst[_offset++] = record.SecondOptionIndex;
+
+                uint8_t _optionsNumbers = record.FirstOptionCount;
+                _optionsNumbers <<= cOptionSizeBitLength;
+                _optionsNumbers |= record.SecondOptionCount;
+                dst[_offset++] = _optionsNumbers;
+
+                helper::Inject(dst, _offset, record.ServiceId);
+                helper::Inject(dst, _offset, record.InstanceId);
+
+                const uint8_t cTTLSizeBitLength = 24;
+                uint32_t _majorVersion = record.MajorVersion;
+                _majorVersion <<= cTTLSizeBitLength;
+                _majorVersion |= record.TTL;
+                helper::Inject(dst, _offset, _majorVersion);
+
+                if (record.IsServiceEntry())
+                {
+                    helper::Inject(dst, _offset, record.MinorVersion);
+                }
+                else
+                {
+                    uint16_t _eventgroupFlag = static_cast<uint16_t>(record.Eventgroup.Counter);
+                    helper::Inject(dst, _offset, _eventgroupFlag);
+                    helper::Inject(dst, _offset, record.Eventgroup.EventgroupId);
+                }
+
+                return _offset;
+            }
+
+            EntryRecord Entry::BaseRecord(uint8_t &optionIndex) const noexcept
+            {
+                EntryRecord _result;
+                _result.Type = Type();
+
+                _result.FirstOptionIndex = optionIndex;
+                _result.FirstOptionCount = FirstOptions().size();
+                optionIndex += _result.FirstOptionCount;
+
+                _result.SecondOptionIndex = optionIndex;
+                _result.SecondOptionCount = SecondOptions().size();
+                optionIndex += _result.SecondOptionCount;
+
+                _result.ServiceId = ServiceId();
+                _result.InstanceId = InstanceId();
+                _result.TTL = TTL();
+                _result.MajorVersion = MajorVersion();
+
+                return _result;
+            }
+
+            void Entry::Serialize(std::vector<uint8_t> &payload, uint8_t &optionIndex) const
+            {
+                std::size_t _offset = payload.size();
+                payload.resize(_offset + cEntrySize);
+                SerializeTo(payload.data() + _offset, cEntrySize, optionIndex);
+            }
+
+            std::vector<uint8_t> Entry::Payload(uint8_t &optionIndex) const
+            {
+                std::vector<uint8_t> _result;
+                _result.reserve(cEntrySize);
+                Serialize(_result, optionIndex);
 
                 return _result;
             }
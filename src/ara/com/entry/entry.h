@@ -23,13 +23,74 @@ namespace ara
                 Acknowledging = 0x07 ///< Event subscribe positive/negative acknowledging
             };
 
+            /// @brief Plain value representation of a communication message entry
+            /// @details The record is as compact as the serialized entry, and the options are
+            /// referred by their indices in the message option records. The type-specific fields
+            /// are held in a tagged union which should be accessed based on the entry type.
+            struct EntryRecord
+            {
+                /// @brief Event-group entry specific fields
+                struct EventgroupFields
+                {
+                    /// @brief Event-group ID
+                    uint16_t EventgroupId;
+                    /// @brief Subscriber counter
+                    uint8_t Counter;
+                };
+
+                /// @brief Entry type
+                EntryType Type;
+                /// @brief Index of the first options run
+                uint8_t FirstOptionIndex;
+                /// @brief Index of the second options run
+                uint8_t SecondOptionIndex;
+                /// @brief Number of the first options
+                uint8_t FirstOptionCount : 4;
+                /// @brief Number of the second options
+                uint8_t SecondOptionCount : 4;
+                /// @brief Service in interest ID
+                uint16_t ServiceId;
+                /// @brief Service in interest instance ID
+                uint16_t InstanceId;
+                /// @brief Entry time to live in seconds
+                uint32_t TTL : 24;
+                /// @brief Service in interest major version
+                uint32_t MajorVersion : 8;
+
+                union
+                {
+                    /// @brief Valid for the service finding and offering entry types
+                    uint32_t MinorVersion;
+                    /// @brief Valid for the event-group subscribing and acknowledging entry types
+                    EventgroupFields Eventgroup;
+                };
+
+                /// @brief Indicate whether the record is a service entry or not
+                /// @returns True if the entry is a finding or an offering entry; otherwise false
+                bool IsServiceEntry() const noexcept
+                {
+                    return Type == EntryType::Finding || Type == EntryType::Offering;
+                }
+
+                /// @brief Indicate whether the record is an event-group entry or not
+                /// @returns True if the entry is a subscribing or an acknowledging entry; otherwise false
+                bool IsEventgroupEntry() const noexcept
+                {
+                    return Type == EntryType::Subscribing || Type == EntryType::Acknowledging;
+                }
+            };
+
+            static_assert(
+                sizeof(EntryRecord) == 16,
+                "The entry record should be as compact as a serialized entry.");
+
             /// @brief Communication message abstract entry
             class Entry
             {
             private:
                 EntryType mType;
-                std::vector<std::unique_ptr<option::Option>> mFirstOptions;
-                std::vector<std::unique_ptr<option::Option>> mSecondOptions;
+                std::vector<std::shared_ptr<const option::Option>> mFirstOptions;
+                std::vector<std::shared_ptr<const option::Option>> mSecondOptions;
                 uint16_t mServiceId;
                 uint16_t mInstanceId;
                 uint8_t mMajorVersion;
@@ -58,10 +119,19 @@ namespace ara
                 /// @returns True if the entry contains the option; otherwise false
                 bool ContainsOption(option::OptionType optionType) const noexcept;
 
-                /// @brief Get baseentity payload
+                /// @brief Serialize the base entry fields into a byte buffer
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
                 /// @param optionIndex Index of the last added option
-                /// @returns Byte array
-                virtual std::vector<uint8_t> BasePayload(uint8_t &optionIndex) const;
+                /// @returns Offset right after the serialized base fields
+                /// @throws std::out_of_range Throws when the capacity does not fit the whole entry
+                std::size_t BaseSerializeTo(
+                    uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const;
+
+                /// @brief Get the base entry fields as a record
+                /// @param optionIndex Index of the last added option
+                /// @returns Record filled with the base entry fields and the option runs
+                EntryRecord BaseRecord(uint8_t &optionIndex) const noexcept;
 
             public:
                 /// @brief Any service instance ID
@@ -70,6 +140,8 @@ namespace ara
                 static const uint8_t cAnyMajorVersion = 0xff;
                 /// @brief Option number field bit size
                 static const uint8_t cOptionSizeBitLength = 4;
+                /// @brief Serialized entry size in bytes
+                static const uint8_t cEntrySize = 16;
 
                 Entry(Entry &&other);
                 virtual ~Entry() noexcept = default;
@@ -98,24 +170,72 @@ namespace ara
 
                 /// @brief Get first (general) options
                 /// @returns Exisiting first options
-                const std::vector<std::unique_ptr<option::Option>> &FirstOptions() const noexcept;
+                const std::vector<std::shared_ptr<const option::Option>> &FirstOptions() const noexcept;
 
                 /// @brief Add a first (general) option
                 /// @param firstOption First option to be added
                 void AddFirstOption(std::unique_ptr<option::Option> firstOption);
 
+                /// @brief Try to add a first (general) option
+                /// @param firstOption First option to be added
+                /// @returns True if the option is added; false if the option is not valid for the entry
+                /// @note The immutable option can be shared among entries (e.g., the entries of a deserialized message).
+                bool TryAddFirstOption(const std::shared_ptr<const option::Option> &firstOption);
+
                 /// @brief Get second (specific) options
                 /// @returns Exisiting second options
-                const std::vector<std::unique_ptr<option::Option>> &SecondOptions() const noexcept;
+                const std::vector<std::shared_ptr<const option::Option>> &SecondOptions() const noexcept;
 
                 /// @brief Add a second (specific) option
                 /// @param secondOption Second option to be added
                 void AddSecondOption(std::unique_ptr<option::Option> secondOption);
 
+                /// @brief Try to add a second (specific) option
+                /// @param secondOption Second option to be added
+                /// @returns True if the option is added; false if the option is not valid for the entry
+                /// @note The immutable option can be shared among entries (e.g., the entries of a deserialized message).
+                bool TryAddSecondOption(const std::shared_ptr<const option::Option> &secondOption);
+
+                /// @brief Serialize the entry into a caller-provided byte buffer
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
+                /// @param optionIndex Index of the last added option
+                /// @returns Number of written bytes
+                /// @throws std::out_of_range Throws when the capacity does not fit the entry
+                virtual std::size_t SerializeTo(
+                    uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const = 0;
+
+                /// @brief Validate an option type for adding regardless of the entry type
+                /// @param optionType Type of the option of interest
+                /// @param contained Indicates whether the entry already contains an option of the same type
+                /// @returns True if the option type is valid; otherwise false
+                static bool IsOptionAllowed(option::OptionType optionType, bool contained) noexcept;
+
+                /// @brief Serialize an entry record into a caller-provided byte buffer
+                /// @param record Entry record including its option run indices
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
+                /// @returns Number of written bytes
+                /// @throws std::out_of_range Throws when the capacity does not fit the entry
+                static std::size_t SerializeRecordTo(
+                    const EntryRecord &record, uint8_t *dst, std::size_t cap);
+
+                /// @brief Serialize the entry at the end of a byte array
+                /// @param[out] payload Byte array to append the entry to
+                /// @param optionIndex Index of the last added option
+                /// @note No allocation happens if the payload has enough reserved capacity.
+                void Serialize(std::vector<uint8_t> &payload, uint8_t &optionIndex) const;
+
                 /// @brief Get entity payload
                 /// @param optionIndex Index of the last added option
                 /// @returns Byte array
-                virtual std::vector<uint8_t> Payload(uint8_t &optionIndex) const = 0;
+                virtual std::vector<uint8_t> Payload(uint8_t &optionIndex) const;
+
+                /// @brief Get the entry as a plain value record
+                /// @param optionIndex Index of the last added option
+                /// @returns Entry record
+                /// @note The option indices are assigned in the same order as the serialization.
+                virtual EntryRecord Record(uint8_t &optionIndex) const noexcept = 0;
             };
         }
     }
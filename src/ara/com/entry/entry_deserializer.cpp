@@ -12,58 +12,137 @@ namespace ara
                 uint8_t &numberOfFirstOptions,
                 uint8_t &numberOfSecondOptions)
             {
-                auto _type = static_cast<EntryType>(payload.at(offset++));
+                helper::ByteReader _reader(payload);
+                std::unique_ptr<Entry> _result;
+                uint8_t _firstOptionIndex;
+                uint8_t _secondOptionIndex;
 
-                // Apply the first and the second options' indices fields
-                offset += 2;
+                bool _successful =
+                    _reader.Skip(offset) &&
+                    TryDeserialize(
+                        _reader,
+                        _result,
+                        _firstOptionIndex,
+                        _secondOptionIndex,
+                        numberOfFirstOptions,
+                        numberOfSecondOptions);
 
-                uint8_t optionsNumbers = payload.at(offset++);
-                numberOfFirstOptions = optionsNumbers >> Entry::cOptionSizeBitLength;
+                if (!_successful)
+                {
+                    throw std::out_of_range(
+                        "Entry is corrupted or its type is not supported for deserializing.");
+                }
+
+                offset = _reader.Offset();
+
+                return _result;
+            }
+
+            bool EntryDeserializer::TryDeserialize(
+                helper::ByteReader &reader,
+                std::unique_ptr<Entry> &entry,
+                uint8_t &firstOptionIndex,
+                uint8_t &secondOptionIndex,
+                uint8_t &numberOfFirstOptions,
+                uint8_t &numberOfSecondOptions)
+            {
+                // The entry is instantiated from the decoded record, so both paths share one decoder.
+                EntryRecord _record;
+                if (!TryDeserialize(reader, _record))
+                {
+                    return false;
+                }
+
+                firstOptionIndex = _record.FirstOptionIndex;
+                secondOptionIndex = _record.SecondOptionIndex;
+                numberOfFirstOptions = _record.FirstOptionCount;
+                numberOfSecondOptions = _record.SecondOptionCount;
+
+                entry = FromRecord(_record);
+
+                return true;
+            }
+
+            std::unique_ptr<Entry> EntryDeserializer::FromRecord(const EntryRecord &record)
+            {
+                if (record.IsServiceEntry())
+                {
+                    return ServiceEntry::FromRecord(record);
+                }
+                else
+                {
+                    return EventgroupEntry::FromRecord(record);
+                }
+            }
+
+            bool EntryDeserializer::IsOptionAllowed(
+                const EntryRecord &record,
+                option::OptionType optionType,
+                bool contained) noexcept
+            {
+                if (record.IsServiceEntry())
+                {
+                    return ServiceEntry::IsOptionAllowed(optionType, contained);
+                }
+                else
+                {
+                    return EventgroupEntry::IsOptionAllowed(
+                        record.Type, record.TTL, optionType, contained);
+                }
+            }
+
+            bool EntryDeserializer::TryDeserialize(
+                helper::ByteReader &reader,
+                EntryRecord &record) noexcept
+            {
+                if (!reader.Require(Entry::cEntrySize))
+                {
+                    return false;
+                }
+
+                record.Type = static_cast<EntryType>(reader.ReadByte());
+                record.FirstOptionIndex = reader.ReadByte();
+                record.SecondOptionIndex = reader.ReadByte();
+
+                uint8_t _optionsNumbers = reader.ReadByte();
                 const uint8_t cSecondOptionsNumberMask = 0x0f;
-                numberOfSecondOptions = optionsNumbers & cSecondOptionsNumberMask;
+                record.FirstOptionCount = _optionsNumbers >> Entry::cOptionSizeBitLength;
+                record.SecondOptionCount = _optionsNumbers & cSecondOptionsNumberMask;
 
-                uint16_t _serviceId = helper::ExtractShort(payload, offset);
-                uint16_t _instanceId = helper::ExtractShort(payload, offset);
+                record.ServiceId = reader.ReadShort();
+                record.InstanceId = reader.ReadShort();
 
                 const uint8_t cTTLSizeBitLength = 24;
                 const uint32_t cTTLMask = 0x00ffffff;
-                uint32_t _combinedMajorVersionTtl =
-                    helper::ExtractInteger(payload, offset);
+                uint32_t _combinedMajorVersionTtl = reader.ReadInteger();
+                record.MajorVersion = _combinedMajorVersionTtl >> cTTLSizeBitLength;
+                record.TTL = _combinedMajorVersionTtl & cTTLMask;
+
+                if (record.IsServiceEntry())
+                {
+                    record.MinorVersion = reader.ReadInteger();
 
-                uint8_t _majorVersion =
-                    static_cast<uint8_t>(_combinedMajorVersionTtl >> cTTLSizeBitLength);
+                    return true;
+                }
+                else if (record.IsEventgroupEntry())
+                {
+                    // Apply the reserved byte offset
+                    reader.ReadByte();
 
-                uint32_t _ttl = _combinedMajorVersionTtl & cTTLMask;
+                    const uint8_t cCounterMask = 0x0f;
+                    record.Eventgroup.Counter = reader.ReadByte() & cCounterMask;
+                    record.Eventgroup.EventgroupId = reader.ReadShort();
 
-                switch (_type)
+                    return true;
+                }
+                else
                 {
-                case EntryType::Finding:
-                case EntryType::Offering:
-                    return ServiceEntry::Deserialize(
-                        payload,
-                        offset,
-                        _type,
-                        _serviceId,
-                        _instanceId,
-                        _ttl,
-                        _majorVersion);
-
-                case EntryType::Subscribing:
-                case EntryType::Acknowledging:
-                    return EventgroupEntry::Deserialize(
-                        payload,
-                        offset,
-                        _type,
-                        _serviceId,
-                        _instanceId,
-                        _ttl,
-                        _majorVersion);
-
-                default:
-                    throw std::out_of_range(
-                        "Entry type is not supported for deserializing.");
+                    // Move over the type-specific fields of the unsupported entry
+                    reader.ReadInteger();
+
+                    return false;
                 }
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -20,12 +20,54 @@ namespace ara
                 /// @param[out] numberOfFirstOptions Number of first options that the deserialized entry have
                 /// @param[out] numberOfSecondOptions Number of second options that the deserialized entry have
                 /// @returns Deserialized entry
-                /// @throws std::out_of_range Throws when the entry type for deserializing is not supported
+                /// @throws std::out_of_range Throws when the entry is truncated or its type is not supported
                 static std::unique_ptr<Entry> Deserialize(
                     const std::vector<uint8_t> &payload,
                     std::size_t &offset,
                     uint8_t &numberOfFirstOptions,
                     uint8_t &numberOfSecondOptions);
+
+                /// @brief Try to deserialize an entry
+                /// @param reader Byte reader positioned at the entry
+                /// @param[out] entry Deserialized entry
+                /// @param[out] firstOptionIndex Index of the first options run within the message options array
+                /// @param[out] secondOptionIndex Index of the second options run within the message options array
+                /// @param[out] numberOfFirstOptions Number of first options that the deserialized entry have
+                /// @param[out] numberOfSecondOptions Number of second options that the deserialized entry have
+                /// @returns True if the entry is deserialized; false if it is truncated or its type is not supported
+                /// @note The remaining length is validated once for the whole entry.
+                static bool TryDeserialize(
+                    helper::ByteReader &reader,
+                    std::unique_ptr<Entry> &entry,
+                    uint8_t &firstOptionIndex,
+                    uint8_t &secondOptionIndex,
+                    uint8_t &numberOfFirstOptions,
+                    uint8_t &numberOfSecondOptions);
+
+                /// @brief Instantiate an entry from a decoded record
+                /// @param record Service or event-group entry record
+                /// @returns Entry without any option
+                /// @note The option runs of the record should be added to the entry separately.
+                static std::unique_ptr<Entry> FromRecord(const EntryRecord &record);
+
+                /// @brief Validate an option type for adding to a decoded entry record
+                /// @param record Service or event-group entry record
+                /// @param optionType Type of the option of interest
+                /// @param contained Indicates whether the entry already contains an option of the same type
+                /// @returns True if the option type is valid for the entry; otherwise false
+                static bool IsOptionAllowed(
+                    const EntryRecord &record,
+                    option::OptionType optionType,
+                    bool contained) noexcept;
+
+                /// @brief Try to decode an entry into a plain value record without instantiating it
+                /// @param reader Byte reader positioned at the entry
+                /// @param[out] record Decoded entry record with the serialized option indices
+                /// @returns True if the entry is decoded; false if it is truncated or its type is not supported
+                /// @note The reader always moves over the whole entry if it is not truncated.
+                static bool TryDeserialize(
+                    helper::ByteReader &reader,
+                    EntryRecord &record) noexcept;
             };
         }
     }
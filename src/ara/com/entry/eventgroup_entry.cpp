@@ -1,4 +1,5 @@
 #include "./eventgroup_entry.h"
+#include "../helper/object_pool.h"
 
 namespace ara
 {
@@ -38,10 +39,10 @@ namespace ara
                 return *this;
             }
 
-            bool EventgroupEntry::isAcknowledge() const noexcept
+            bool EventgroupEntry::isAcknowledge(EntryType type, uint32_t ttl) noexcept
             {
                 bool _result =
-                    (Type() == EntryType::Acknowledging) && (TTL() > cNackTTL);
+                    (type == EntryType::Acknowledging) && (ttl > cNackTTL);
 
                 return _result;
             }
@@ -49,26 +50,39 @@ namespace ara
             bool EventgroupEntry::ValidateOption(
                 const option::Option *option) const noexcept
             {
-                bool _result = Entry::ValidateOption(option);
+                bool _result =
+                    IsOptionAllowed(
+                        Type(), TTL(), option->Type(), ContainsOption(option->Type()));
+
+                return _result;
+            }
+
+            bool EventgroupEntry::IsOptionAllowed(
+                EntryType type,
+                uint32_t ttl,
+                option::OptionType optionType,
+                bool contained) noexcept
+            {
+                bool _result = Entry::IsOptionAllowed(optionType, contained);
 
                 if (_result)
                 {
-                    switch (option->Type())
+                    switch (optionType)
                     {
                     case option::OptionType::IPv4Endpoint:
                     case option::OptionType::IPv6Endpoint:
                     {
                         // Endpoint option is allowed only eventgroup subscription entries.
-                        _result = (Type() == EntryType::Subscribing);
+                        _result = (type == EntryType::Subscribing);
                         break;
                     }
                     case option::OptionType::IPv4Multicast:
                     case option::OptionType::IPv6Multicast:
                     {
                         // Multicast option is not allowed in eventgroup entries expect acknowledgement.
-                        if (isAcknowledge())
+                        if (isAcknowledge(type, ttl))
                         {
-                            _result = !ContainsOption(option->Type());
+                            _result = !contained;
                         }
                         else
                         {
@@ -98,15 +112,16 @@ namespace ara
                 return mEventgroupId;
             }
 
-            std::vector<uint8_t> EventgroupEntry::Payload(uint8_t &optionIndex) const
+            std::size_t EventgroupEntry::SerializeTo(
+                uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const
             {
-                std::vector<uint8_t> _result = Entry::BasePayload(optionIndex);
+                std::size_t _offset = Entry::BaseSerializeTo(dst, cap, optionIndex);
 
                 uint16_t _eventgroupFlag = static_cast<uint16_t>(mCounter);
-                helper::Inject(_result, _eventgroupFlag);
-                helper::Inject(_result, mEventgroupId);
+                helper::Inject(dst, _offset, _eventgroupFlag);
+                helper::Inject(dst, _offset, mEventgroupId);
 
-                return _result;
+                return _offset;
             }
 
             std::unique_ptr<EventgroupEntry> EventgroupEntry::CreateSubscribeEventEntry(
@@ -114,17 +129,17 @@ namespace ara
                 uint16_t instanceId,
                 uint8_t majorVersion,
                 uint8_t counter,
-                uint16_t eventgroupId)
+                uint16_t eventgroupId,
+                uint32_t ttl)
             {
                 const EntryType cSubscribeEventEntry = EntryType::Subscribing;
-                const uint32_t cSubscribeEventTTL = 0xffffff;
 
                 std::unique_ptr<EventgroupEntry> _result(
                     new EventgroupEntry(
                         cSubscribeEventEntry,
                         serviceId,
                         instanceId,
-                        cSubscribeEventTTL,
+                        ttl,
                         majorVersion,
                         counter,
                         eventgroupId));
@@ -190,34 +205,69 @@ namespace ara
                 return _result;
             }
 
-            std::unique_ptr<EventgroupEntry> EventgroupEntry::Deserialize(
-                const std::vector<uint8_t> &payload,
-                std::size_t &offset,
-                EntryType type,
-                uint16_t serviceId,
-                uint16_t instanceId,
-                uint32_t ttl,
-                uint8_t majorVersion)
+            std::unique_ptr<EventgroupEntry> EventgroupEntry::CreateAcknowledgeEntry(
+                const EntryRecord &eventgroupRecord)
             {
-                // Apply the reserved byte offset
-                offset++;
+                const EntryType cAcknowledgetEntry = EntryType::Acknowledging;
+
+                std::unique_ptr<EventgroupEntry> _result(
+                    new EventgroupEntry(
+                        cAcknowledgetEntry,
+                        eventgroupRecord.ServiceId,
+                        eventgroupRecord.InstanceId,
+                        eventgroupRecord.TTL,
+                        eventgroupRecord.MajorVersion,
+                        eventgroupRecord.Eventgroup.Counter,
+                        eventgroupRecord.Eventgroup.EventgroupId));
 
-                uint8_t _counter = payload.at(offset++);
-                uint16_t _eventgroupId = helper::ExtractShort(payload, offset);
+                return _result;
+            }
 
-                switch (type)
+            std::unique_ptr<EventgroupEntry> EventgroupEntry::CreateNegativeAcknowledgeEntry(
+                const EntryRecord &eventgroupRecord)
+            {
+                const EntryType cAcknowledgetEntry = EntryType::Acknowledging;
+
+                std::unique_ptr<EventgroupEntry> _result(
+                    new EventgroupEntry(
+                        cAcknowledgetEntry,
+                        eventgroupRecord.ServiceId,
+                        eventgroupRecord.InstanceId,
+                        cNackTTL,
+                        eventgroupRecord.MajorVersion,
+                        eventgroupRecord.Eventgroup.Counter,
+                        eventgroupRecord.Eventgroup.EventgroupId));
+
+                return _result;
+            }
+
+            std::unique_ptr<EventgroupEntry> EventgroupEntry::FromRecord(
+                const EntryRecord &record)
+            {
+                const auto cMajorVersion = static_cast<uint8_t>(record.MajorVersion);
+
+                switch (record.Type)
                 {
                 case EntryType::Subscribing:
                 {
-                    if (ttl > cUnsubscribeEventTTL)
+                    if (record.TTL > cUnsubscribeEventTTL)
                     {
                         return CreateSubscribeEventEntry(
-                            serviceId, instanceId, majorVersion, _counter, _eventgroupId);
+                            record.ServiceId,
+                            record.InstanceId,
+                            cMajorVersion,
+                            record.Eventgroup.Counter,
+                            record.Eventgroup.EventgroupId,
+                            record.TTL);
                     }
                     else
                     {
                         return CreateUnsubscribeEventEntry(
-                            serviceId, instanceId, majorVersion, _counter, _eventgroupId);
+                            record.ServiceId,
+                            record.InstanceId,
+                            cMajorVersion,
+                            record.Eventgroup.Counter,
+                            record.Eventgroup.EventgroupId);
                     }
                 }
 
@@ -225,13 +275,13 @@ namespace ara
                 {
                     std::unique_ptr<EventgroupEntry> _result(
                         new EventgroupEntry(
-                            type,
-                            serviceId,
-                            instanceId,
-                            ttl,
-                            majorVersion,
-                            _counter,
-                            _eventgroupId));
+                            record.Type,
+                            record.ServiceId,
+                            record.InstanceId,
+                            record.TTL,
+                            cMajorVersion,
+                            record.Eventgroup.Counter,
+                            record.Eventgroup.EventgroupId));
 
                     return _result;
                 }
@@ -241,6 +291,25 @@ namespace ara
                         "The entry type does not belong to service entry series.");
                 }
             }
+
+            EntryRecord EventgroupEntry::Record(uint8_t &optionIndex) const noexcept
+            {
+                EntryRecord _result = Entry::BaseRecord(optionIndex);
+                _result.Eventgroup.EventgroupId = mEventgroupId;
+                _result.Eventgroup.Counter = mCounter;
+
+                return _result;
+            }
+
+            void *EventgroupEntry::operator new(std::size_t size)
+            {
+                return helper::ObjectPool<EventgroupEntry>::Instance().Allocate(size);
+            }
+
+            void EventgroupEntry::operator delete(void *pointer, std::size_t size) noexcept
+            {
+                helper::ObjectPool<EventgroupEntry>::Instance().Deallocate(pointer, size);
+            }
         }
     }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ namespace ara
             class EventgroupEntry : public Entry
             {
             private:
+                static const uint32_t cInfiniteTtl = 0xffffff;
                 static const uint32_t cNackTTL = 0x000000;
                 static const uint32_t cUnsubscribeEventTTL = 0x000000;
 
@@ -27,7 +28,7 @@ namespace ara
                                 uint8_t counter,
                                 uint16_t eventgroupId);
 
-                bool isAcknowledge() const noexcept;
+                static bool isAcknowledge(EntryType type, uint32_t ttl) noexcept;
 
             protected:
                 virtual bool ValidateOption(
@@ -37,6 +38,18 @@ namespace ara
                 EventgroupEntry() = delete;
                 EventgroupEntry(EventgroupEntry &&other);
 
+                /// @brief Validate an option type for adding to an event-group entry
+                /// @param type Event-group entry type
+                /// @param ttl Event-group entry time to live
+                /// @param optionType Type of the option of interest
+                /// @param contained Indicates whether the entry already contains an option of the same type
+                /// @returns True if the option type is valid; otherwise false
+                static bool IsOptionAllowed(
+                    EntryType type,
+                    uint32_t ttl,
+                    option::OptionType optionType,
+                    bool contained) noexcept;
+
                 EventgroupEntry &operator=(EventgroupEntry &&other);
 
                 /// @brief Get the subscriber counter
@@ -47,7 +60,10 @@ namespace ara
                 /// @returns Event-group ID for subscription/unsubscription
                 uint16_t EventgroupId() const noexcept;
 
-                virtual std::vector<uint8_t> Payload(uint8_t &optionIndex) const override;
+                virtual std::size_t SerializeTo(
+                    uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const override;
+
+                virtual EntryRecord Record(uint8_t &optionIndex) const noexcept override;
 
                 /// @brief Subscribe to an event-group entry factory
                 /// @param serviceId Service in interest ID
@@ -55,6 +71,7 @@ namespace ara
                 /// @param majorVersion Service in interest major version
                 /// @param counter Counter to distinguish between subscribers
                 /// @param eventgroupId Event-group in interest ID
+                /// @param ttl Subscription lifetime
                 /// @returns Subscribe event-group entry
                 /// @throws std::out_of_range Throws if counter is greater than 4 bits
                 static std::unique_ptr<EventgroupEntry> CreateSubscribeEventEntry(
@@ -62,7 +79,8 @@ namespace ara
                     uint16_t instanceId,
                     uint8_t majorVersion,
                     uint8_t counter,
-                    uint16_t eventgroupId);
+                    uint16_t eventgroupId,
+                    uint32_t ttl = cInfiniteTtl);
 
                 /// @brief Unsubscribe from an event-group entry factory
                 /// @param serviceId Service in interest ID
@@ -91,24 +109,34 @@ namespace ara
                 static std::unique_ptr<EventgroupEntry> CreateNegativeAcknowledgeEntry(
                     const EventgroupEntry *eventgroupEntry);
 
-                /// @brief Deserialize a entry payload
-                /// @param payload Serialized entry payload byte array
-                /// @param offset Deserializing offset in the payload
-                /// @param type Entry type
-                /// @param serviceId Service in interest ID
-                /// @param instanceId Service in interest instance ID
-                /// @param ttl Entry time to live
-                /// @param majorVersion Service in interest major version
-                /// @returns Deserialized entry
+                /// @brief Positive acknowledge of an event-group entry record factory
+                /// @param eventgroupRecord Received subscribe event-group entry record
+                /// @returns Acknowledge event-group subscription entry
+                static std::unique_ptr<EventgroupEntry> CreateAcknowledgeEntry(
+                    const EntryRecord &eventgroupRecord);
+
+                /// @brief Negative acknowledge of an event-group entry record factory
+                /// @param eventgroupRecord Received subscribe event-group entry record
+                /// @returns Negative acknowledge event-group subscription entry
+                static std::unique_ptr<EventgroupEntry> CreateNegativeAcknowledgeEntry(
+                    const EntryRecord &eventgroupRecord);
+
+                /// @brief Instantiate an event-group entry from its decoded record
+                /// @param record Decoded event-group entry record
+                /// @returns Event-group entry
                 /// @throws std::out_of_range Throws when the entry type is not an event-group entry
-                static std::unique_ptr<EventgroupEntry> Deserialize(
-                    const std::vector<uint8_t> &payload,
-                    std::size_t &offset,
-                    EntryType type,
-                    uint16_t serviceId,
-                    uint16_t instanceId,
-                    uint32_t ttl,
-                    uint8_t majorVersion);
+                static std::unique_ptr<EventgroupEntry> FromRecord(
+                    const EntryRecord &record);
+
+                /// @brief Allocate an eventgroup entry from the object pool
+                /// @param size Requested size in bytes
+                /// @returns Pointer to the allocated memory
+                static void *operator new(std::size_t size);
+
+                /// @brief Release an eventgroup entry to the object pool
+                /// @param pointer Pointer to the allocated memory
+                /// @param size Requested size in bytes at the allocation
+                static void operator delete(void *pointer, std::size_t size) noexcept;
             };
         }
     }
@@ -1,4 +1,5 @@
 #include "./service_entry.h"
+#include "../helper/object_pool.h"
 
 namespace ara
 {
@@ -32,12 +33,21 @@ namespace ara
             bool ServiceEntry::ValidateOption(
                 const option::Option *option) const noexcept
             {
-                bool _result = Entry::ValidateOption(option);
+                bool _result =
+                    IsOptionAllowed(option->Type(), ContainsOption(option->Type()));
+
+                return _result;
+            }
+
+            bool ServiceEntry::IsOptionAllowed(
+                option::OptionType optionType, bool contained) noexcept
+            {
+                bool _result = Entry::IsOptionAllowed(optionType, contained);
 
                 // Multicast option is not allowed in service entries.
                 _result &=
-                    (option->Type() != option::OptionType::IPv4Multicast) &&
-                    (option->Type() != option::OptionType::IPv6Multicast);
+                    (optionType != option::OptionType::IPv4Multicast) &&
+                    (optionType != option::OptionType::IPv6Multicast);
 
                 return _result;
             }
@@ -47,12 +57,13 @@ namespace ara
                 return mMinorVersion;
             }
 
-            std::vector<uint8_t> ServiceEntry::Payload(uint8_t &optionIndex) const
+            std::size_t ServiceEntry::SerializeTo(
+                uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const
             {
-                std::vector<uint8_t> _result = Entry::BasePayload(optionIndex);
-                helper::Inject(_result, mMinorVersion);
+                std::size_t _offset = Entry::BaseSerializeTo(dst, cap, optionIndex);
+                helper::Inject(dst, _offset, mMinorVersion);
 
-                return _result;
+                return _offset;
             }
 
             std::unique_ptr<ServiceEntry> ServiceEntry::CreateFindServiceEntry(
@@ -128,34 +139,39 @@ namespace ara
                 return _result;
             }
 
-            std::unique_ptr<ServiceEntry> ServiceEntry::Deserialize(
-                const std::vector<uint8_t> &payload,
-                std::size_t &offset,
-                EntryType type,
-                uint16_t serviceId,
-                uint16_t instanceId,
-                uint32_t ttl,
-                uint8_t majorVersion)
+            std::unique_ptr<ServiceEntry> ServiceEntry::FromRecord(
+                const EntryRecord &record)
             {
-                uint32_t _minorVersion = helper::ExtractInteger(payload, offset);
+                const auto cMajorVersion = static_cast<uint8_t>(record.MajorVersion);
 
-                switch (type)
+                switch (record.Type)
                 {
                 case EntryType::Finding:
                     return CreateFindServiceEntry(
-                        serviceId, ttl, instanceId, majorVersion, _minorVersion);
+                        record.ServiceId,
+                        record.TTL,
+                        record.InstanceId,
+                        cMajorVersion,
+                        record.MinorVersion);
 
                 case EntryType::Offering:
                 {
-                    if (ttl > 0)
+                    if (record.TTL > 0)
                     {
                         return CreateOfferServiceEntry(
-                            serviceId, instanceId, majorVersion, _minorVersion, ttl);
+                            record.ServiceId,
+                            record.InstanceId,
+                            cMajorVersion,
+                            record.MinorVersion,
+                            record.TTL);
                     }
                     else
                     {
                         return CreateStopOfferEntry(
-                            serviceId, instanceId, majorVersion, _minorVersion);
+                            record.ServiceId,
+                            record.InstanceId,
+                            cMajorVersion,
+                            record.MinorVersion);
                     }
                 }
 
@@ -164,6 +180,24 @@ namespace ara
                         "The entry type does not belong to service entry series.");
                 }
             }
+
+            EntryRecord ServiceEntry::Record(uint8_t &optionIndex) const noexcept
+            {
+                EntryRecord _result = Entry::BaseRecord(optionIndex);
+                _result.MinorVersion = mMinorVersion;
+
+                return _result;
+            }
+
+            void *ServiceEntry::operator new(std::size_t size)
+            {
+                return helper::ObjectPool<ServiceEntry>::Instance().Allocate(size);
+            }
+
+            void ServiceEntry::operator delete(void *pointer, std::size_t size) noexcept
+            {
+                helper::ObjectPool<ServiceEntry>::Instance().Deallocate(pointer, size);
+            }
         }
     }
 }
\ No newline at end of file
@@ -36,13 +36,22 @@ namespace ara
                 ServiceEntry() = delete;
                 ServiceEntry(ServiceEntry &&other);
 
+                /// @brief Validate an option type for adding to a service entry
+                /// @param optionType Type of the option of interest
+                /// @param contained Indicates whether the entry already contains an option of the same type
+                /// @returns True if the option type is valid; otherwise false
+                static bool IsOptionAllowed(option::OptionType optionType, bool contained) noexcept;
+
                 ServiceEntry &operator=(ServiceEntry &&other);
 
                 /// @brief Get minor version
                 /// @returns Service minor version
                 uint32_t MinorVersion() const noexcept;
 
-                virtual std::vector<uint8_t> Payload(uint8_t &optionIndex) const override;
+                virtual std::size_t SerializeTo(
+                    uint8_t *dst, std::size_t cap, uint8_t &optionIndex) const override;
+
+                virtual EntryRecord Record(uint8_t &optionIndex) const noexcept override;
 
                 /// @brief Find a service entry factory
                 /// @param serviceId Service in interest ID
@@ -84,24 +93,22 @@ namespace ara
                     uint8_t majorVersion,
                     uint32_t minorVersion) noexcept;
 
-                /// @brief Deserialize a entry payload
-                /// @param payload Serialized entry payload byte array
-                /// @param offset Deserializing offset in the payload
-                /// @param type Entry type
-                /// @param serviceId Service in interest ID
-                /// @param instanceId Service in interest instance ID
-                /// @param ttl Entry time to live
-                /// @param majorVersion Service in interest major version
-                /// @returns Deserialized entry
+                /// @brief Instantiate a service entry from its decoded record
+                /// @param record Decoded service entry record
+                /// @returns Service entry
                 /// @throws std::out_of_range Throws when the entry type is not a service entry
-                static std::unique_ptr<ServiceEntry> Deserialize(
-                    const std::vector<uint8_t> &payload,
-                    std::size_t &offset,
-                    EntryType type,
-                    uint16_t serviceId,
-                    uint16_t instanceId,
-                    uint32_t ttl,
-                    uint8_t majorVersion);
+                static std::unique_ptr<ServiceEntry> FromRecord(
+                    const EntryRecord &record);
+
+                /// @brief Allocate a service entry from the object pool
+                /// @param size Requested size in bytes
+                /// @returns Pointer to the allocated memory
+                static void *operator new(std::size_t size);
+
+                /// @brief Release a service entry to the object pool
+                /// @param pointer Pointer to the allocated memory
+                /// @param size Requested size in bytes at the allocation
+                static void operator delete(void *pointer, std::size_t size) noexcept;
             };
         }
     }
@@ -0,0 +1,194 @@
+#ifndef BYTE_READER_H
+#define BYTE_READER_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Big-endian read cursor over a borrowed byte range
+            /// @details The remaining length should be validated once per structure via Require,
+            /// afterwards the unchecked reads can be used for the whole structure.
+            /// The checked reads report a short range via their results instead of throwing.
+            /// @note The read byte range must outlive the reader.
+            class ByteReader
+            {
+            private:
+                const uint8_t *mData;
+                std::size_t mSize;
+                std::size_t mOffset;
+
+                static uint16_t fromBigEndian(uint16_t value) noexcept
+                {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+                    return __builtin_bswap16(value);
+#else
+                    return value;
+#endif
+                }
+
+                static uint32_t fromBigEndian(uint32_t value) noexcept
+                {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+                    return __builtin_bswap32(value);
+#else
+                    return value;
+#endif
+                }
+
+            public:
+                ByteReader() = delete;
+
+                /// @brief Constructor
+                /// @param data Pointer to the first byte of the range
+                /// @param size Range size in bytes
+                ByteReader(const uint8_t *data, std::size_t size) noexcept : mData{data},
+                                                                             mSize{size},
+                                                                             mOffset{0}
+                {
+                }
+
+                /// @brief Constructor
+                /// @param payload Byte array to be read
+                explicit ByteReader(const std::vector<uint8_t> &payload) noexcept : ByteReader(
+                                                                                        payload.data(),
+                                                                                        payload.size())
+                {
+                }
+
+                /// @brief Get the current read offset
+                /// @returns Offset from the beginning of the range
+                std::size_t Offset() const noexcept
+                {
+                    return mOffset;
+                }
+
+                /// @brief Get the remaining length
+                /// @returns Number of bytes that are not read yet
+                std::size_t Remaining() const noexcept
+                {
+                    return mSize - mOffset;
+                }
+
+                /// @brief Get the current read position
+                /// @returns Pointer to the first unread byte
+                const uint8_t *Current() const noexcept
+                {
+                    return mData + mOffset;
+                }
+
+                /// @brief Validate the remaining length
+                /// @param length Number of bytes that are going to be read
+                /// @returns True if at least the length is remained; otherwise false
+                bool Require(std::size_t length) const noexcept
+                {
+                    return length <= Remaining();
+                }
+
+                /// @brief Skip a number of bytes
+                /// @param length Number of bytes to skip
+                /// @returns True if the bytes are skipped; otherwise false without moving the cursor
+                bool Skip(std::size_t length) noexcept
+                {
+                    if (Require(length))
+                    {
+                        mOffset += length;
+                        return true;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+
+                /// @brief Read a byte without validation
+                /// @returns Read byte
+                /// @warning The remaining length should have been validated beforehand.
+                uint8_t ReadByte() noexcept
+                {
+                    return mData[mOffset++];
+                }
+
+                /// @brief Read a big-endian short value without validation
+                /// @returns Read short value
+                /// @warning The remaining length should have been validated beforehand.
+                uint16_t ReadShort() noexcept
+                {
+                    uint16_t _result;
+                    std::memcpy(&_result, mData + mOffset, sizeof(_result));
+                    mOffset += sizeof(_result);
+
+                    return fromBigEndian(_result);
+                }
+
+                /// @brief Read a big-endian integer value without validation
+                /// @returns Read integer value
+                /// @warning The remaining length should have been validated beforehand.
+                uint32_t ReadInteger() noexcept
+                {
+                    uint32_t _result;
+                    std::memcpy(&_result, mData + mOffset, sizeof(_result));
+                    mOffset += sizeof(_result);
+
+                    return fromBigEndian(_result);
+                }
+
+                /// @brief Try to read a byte
+                /// @param[out] value Read byte
+                /// @returns True if the byte is read; otherwise false
+                bool TryRead(uint8_t &value) noexcept
+                {
+                    if (Require(sizeof(value)))
+                    {
+                        value = ReadByte();
+                        return true;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+
+                /// @brief Try to read a big-endian short value
+                /// @param[out] value Read short value
+                /// @returns True if the value is read; otherwise false
+                bool TryRead(uint16_t &value) noexcept
+                {
+                    if (Require(sizeof(value)))
+                    {
+                        value = ReadShort();
+                        return true;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+
+                /// @brief Try to read a big-endian integer value
+                /// @param[out] value Read integer value
+                /// @returns True if the value is read; otherwise false
+                bool TryRead(uint32_t &value) noexcept
+                {
+                    if (Require(sizeof(value)))
+                    {
+                        value = ReadInteger();
+                        return true;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+            };
+        }
+    }
+}
+
+#endif
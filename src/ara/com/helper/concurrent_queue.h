@@ -20,11 +20,9 @@ namespace ara
                 std::mutex mMutex;
                 std::queue<T> mQueue;
                 std::atomic_size_t mSize;
-                std::unique_lock<std::mutex> mLock;
 
             public:
-                ConcurrentQueue() : mSize{0},
-                                    mLock{mMutex, std::defer_lock}
+                ConcurrentQueue() : mSize{0}
                 {
                 }
 
@@ -43,11 +41,11 @@ namespace ara
                 /// @note The insertion is based on move constructor emplacement rather than pushing.
                 bool TryEnqueue(T &&element)
                 {
-                    if (mLock.try_lock())
+                    std::unique_lock<std::mutex> _lock(mMutex, std::try_to_lock);
+                    if (_lock.owns_lock())
                     {
                         mQueue.emplace(std::move(element));
                         ++mSize;
-                        mLock.unlock();
                         return true;
                     }
                     else
@@ -59,13 +57,15 @@ namespace ara
                 /// @brief Try to peek an element from the queue by removing it
                 /// @param[out] element Element that is moved out from the queue
                 /// @returns True if the element is dequeued successfully, otherwise false
+                /// @note For a bounded lock-free alternative, see RingBuffer.
                 bool TryDequeue(T &element)
                 {
-                    if (mLock.try_lock())
+                    std::unique_lock<std::mutex> _lock(mMutex, std::try_to_lock);
+                    if (_lock.owns_lock() && !mQueue.empty())
                     {
                         element = std::move(mQueue.front());
+                        mQueue.pop();
                         --mSize;
-                        mLock.unlock();
                         return true;
                     }
                     else
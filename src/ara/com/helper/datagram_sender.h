@@ -0,0 +1,44 @@
+#ifndef DATAGRAM_SENDER_H
+#define DATAGRAM_SENDER_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+#include "./ipv4_address.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Unicast datagram destination
+            struct DatagramEndpoint
+            {
+                /// @brief Destination IP address
+                Ipv4Address Address;
+                /// @brief Destination port number
+                uint16_t Port;
+            };
+
+            /// @brief Abstraction of a transport which sends a datagram to many destinations
+            class DatagramSender
+            {
+            public:
+                virtual ~DatagramSender() noexcept = default;
+
+                /// @brief Send a datagram to multiple destinations
+                /// @param data Pointer to the first byte of the datagram
+                /// @param size Datagram size in bytes
+                /// @param endpoints Destinations to send the same datagram to
+                /// @returns Number of the destinations that the datagram is sent to
+                virtual std::size_t SendTo(
+                    const uint8_t *data,
+                    std::size_t size,
+                    const std::vector<DatagramEndpoint> &endpoints) = 0;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,56 @@
+#include <thread>
+#include "./dispatch_epoch.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const std::size_t DispatchEpoch::cEpochCount;
+
+            DispatchEpoch::Scope::Scope(DispatchEpoch &epoch) noexcept
+            {
+                while (true)
+                {
+                    const std::size_t cEpoch{epoch.mEpoch.load()};
+                    mDispatches = &epoch.mDispatches[cEpoch % cEpochCount];
+                    mDispatches->fetch_add(1);
+
+                    // A synchronization might have moved the epoch forward meanwhile, so join the new one.
+                    if (epoch.mEpoch.load() == cEpoch)
+                    {
+                        return;
+                    }
+
+                    mDispatches->fetch_sub(1);
+                }
+            }
+
+            DispatchEpoch::Scope::~Scope() noexcept
+            {
+                mDispatches->fetch_sub(1, std::memory_order_release);
+            }
+
+            DispatchEpoch::DispatchEpoch() noexcept : mEpoch{0}
+            {
+                for (auto &_dispatches : mDispatches)
+                {
+                    _dispatches = 0;
+                }
+            }
+
+            void DispatchEpoch::Synchronize() noexcept
+            {
+                // The dispatches that join the new epoch load the already published snapshot.
+                const std::size_t cPreviousEpoch{mEpoch.fetch_add(1)};
+                std::atomic_size_t &_previousDispatches{mDispatches[cPreviousEpoch % cEpochCount]};
+
+                while (_previousDispatches.load(std::memory_order_acquire) > 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef DISPATCH_EPOCH_H
+#define DISPATCH_EPOCH_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Grace period tracker of the dispatches over copy-on-write snapshots
+            /// @details Each dispatch joins the current epoch before loading a snapshot. Synchronizing after
+            /// publishing a new snapshot moves the epoch forward and waits only for the dispatches that joined
+            /// the previous epoch, so every older snapshot is released regardless of how many snapshots have
+            /// been published in between, and the dispatches that start meanwhile cannot starve the wait.
+            /// @note The epoch is not copyable.
+            class DispatchEpoch
+            {
+            private:
+                static const std::size_t cEpochCount = 2;
+
+                std::atomic_size_t mEpoch;
+                std::array<std::atomic_size_t, cEpochCount> mDispatches;
+
+            public:
+                /// @brief Dispatch membership in an epoch for the lifetime of the scope
+                /// @note The snapshot should be loaded only after the scope is constructed.
+                class Scope
+                {
+                private:
+                    std::atomic_size_t *mDispatches;
+
+                public:
+                    /// @brief Constructor
+                    /// @param epoch Epoch tracker to join its current epoch
+                    explicit Scope(DispatchEpoch &epoch) noexcept;
+
+                    Scope() = delete;
+                    Scope(const Scope &) = delete;
+                    Scope &operator=(const Scope &) = delete;
+                    ~Scope() noexcept;
+                };
+
+                DispatchEpoch() noexcept;
+                DispatchEpoch(const DispatchEpoch &) = delete;
+                DispatchEpoch &operator=(const DispatchEpoch &) = delete;
+
+                /// @brief Wait for the grace period of the previously published snapshots
+                /// @note The function should be called after publishing the new snapshot, and it returns
+                /// after all the dispatches that might still hold an older snapshot have been finished.
+                /// The synchronizations are expected to be serialized by the snapshot publisher lock.
+                /// @warning The function must not be called from within a dispatch scope of the same epoch tracker.
+                void Synchronize() noexcept;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,237 @@
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include "./epoll_poller.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const int EpollPoller::cMaxEvents;
+
+            EpollPoller::EpollPoller() : mFileDescriptor{epoll_create1(EPOLL_CLOEXEC)}
+            {
+                if (mFileDescriptor < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+            }
+
+            uint32_t EpollPoller::getEvents(const Entry &entry) noexcept
+            {
+                uint32_t _result = 0;
+
+                if (entry.Receiver)
+                {
+                    _result |= EPOLLIN;
+                }
+
+                if (entry.Sender)
+                {
+                    _result |= EPOLLOUT;
+                }
+
+                return _result;
+            }
+
+            bool EpollPoller::tryUpdate(int fileDescriptor, Entry &&entry, bool added)
+            {
+                epoll_event _event;
+                _event.events = getEvents(entry);
+                _event.data.fd = fileDescriptor;
+
+                int _result;
+                if (_event.events == 0)
+                {
+                    _result = epoll_ctl(mFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+                    mEntries.erase(fileDescriptor);
+                }
+                else if (added)
+                {
+                    _result = epoll_ctl(mFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &_event);
+                    if (_result == 0)
+                    {
+                        mEntries[fileDescriptor] = std::make_shared<const Entry>(std::move(entry));
+                    }
+                }
+                else
+                {
+                    _result = epoll_ctl(mFileDescriptor, EPOLL_CTL_MOD, fileDescriptor, &_event);
+                    if (_result == 0)
+                    {
+                        // The entries are immutable, because the polling thread may hold the current one.
+                        mEntries[fileDescriptor] = std::make_shared<const Entry>(std::move(entry));
+                    }
+                }
+
+                return _result == 0;
+            }
+
+            void EpollPoller::waitForGracePeriod(const std::shared_ptr<const Entry> &entry) const
+            {
+                // The polling thread cannot be in the middle of another invocation
+                if (mPollingThread.load() == std::this_thread::get_id())
+                {
+                    return;
+                }
+
+                // Wait for the on-going invocation which still holds the replaced entry
+                while (entry.use_count() > 1)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            bool EpollPoller::TryAddReceiver(int fileDescriptor, std::function<void()> callback)
+            {
+                std::lock_guard<std::mutex> _lock(mEntriesMutex);
+
+                Entry _entry;
+                auto _itr = mEntries.find(fileDescriptor);
+                bool _added = _itr == mEntries.end();
+
+                if (!_added)
+                {
+                    if (_itr->second->Receiver)
+                    {
+                        return false;
+                    }
+
+                    _entry.Sender = _itr->second->Sender;
+                }
+
+                _entry.Receiver = std::move(callback);
+
+                return tryUpdate(fileDescriptor, std::move(_entry), _added);
+            }
+
+            bool EpollPoller::TryRemoveReceiver(int fileDescriptor)
+            {
+                std::shared_ptr<const Entry> _current;
+
+                {
+                    std::lock_guard<std::mutex> _lock(mEntriesMutex);
+
+                    auto _itr = mEntries.find(fileDescriptor);
+                    if (_itr == mEntries.end() || !_itr->second->Receiver)
+                    {
+                        return false;
+                    }
+
+                    _current = _itr->second;
+                    Entry _entry;
+                    _entry.Sender = _current->Sender;
+                    tryUpdate(fileDescriptor, std::move(_entry), false);
+                }
+
+                waitForGracePeriod(_current);
+
+                return true;
+            }
+
+            bool EpollPoller::TryAddSender(int fileDescriptor, std::function<void()> callback)
+            {
+                std::lock_guard<std::mutex> _lock(mEntriesMutex);
+
+                Entry _entry;
+                auto _itr = mEntries.find(fileDescriptor);
+                bool _added = _itr == mEntries.end();
+
+                if (!_added)
+                {
+                    if (_itr->second->Sender)
+                    {
+                        return false;
+                    }
+
+                    _entry.Receiver = _itr->second->Receiver;
+                }
+
+                _entry.Sender = std::move(callback);
+
+                return tryUpdate(fileDescriptor, std::move(_entry), _added);
+            }
+
+            bool EpollPoller::TryRemoveSender(int fileDescriptor)
+            {
+                std::shared_ptr<const Entry> _current;
+
+                {
+                    std::lock_guard<std::mutex> _lock(mEntriesMutex);
+
+                    auto _itr = mEntries.find(fileDescriptor);
+                    if (_itr == mEntries.end() || !_itr->second->Sender)
+                    {
+                        return false;
+                    }
+
+                    _current = _itr->second;
+                    Entry _entry;
+                    _entry.Receiver = _current->Receiver;
+                    tryUpdate(fileDescriptor, std::move(_entry), false);
+                }
+
+                waitForGracePeriod(_current);
+
+                return true;
+            }
+
+            bool EpollPoller::TryPoll(int timeout)
+            {
+                const uint32_t cReceiveEvents = EPOLLIN | EPOLLHUP | EPOLLERR;
+                const uint32_t cSendEvents = EPOLLOUT | EPOLLERR;
+
+                std::array<epoll_event, cMaxEvents> _events;
+                mPollingThread = std::this_thread::get_id();
+
+                int _readyDescriptors =
+                    epoll_wait(mFileDescriptor, _events.data(), cMaxEvents, timeout);
+
+                if (_readyDescriptors < 0)
+                {
+                    // A signal interruption is not a polling failure.
+                    return errno == EINTR;
+                }
+
+                for (int i = 0; i < _readyDescriptors; ++i)
+                {
+                    std::shared_ptr<const Entry> _entry;
+
+                    {
+                        std::lock_guard<std::mutex> _lock(mEntriesMutex);
+                        auto _itr = mEntries.find(_events[i].data.fd);
+                        if (_itr != mEntries.end())
+                        {
+                            _entry = _itr->second;
+                        }
+                    }
+
+                    if (!_entry)
+                    {
+                        continue;
+                    }
+
+                    if ((_events[i].events & cReceiveEvents) && _entry->Receiver)
+                    {
+                        _entry->Receiver();
+                    }
+
+                    if ((_events[i].events & cSendEvents) && _entry->Sender)
+                    {
+                        _entry->Sender();
+                    }
+                }
+
+                return true;
+            }
+
+            EpollPoller::~EpollPoller() noexcept
+            {
+                close(mFileDescriptor);
+            }
+        }
+    }
+}
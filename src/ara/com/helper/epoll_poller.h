@@ -0,0 +1,94 @@
+#ifndef EPOLL_POLLER_H
+#define EPOLL_POLLER_H
+
+#include <sys/epoll.h>
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Level-triggered epoll readiness poller
+            /// @details A single thread drives the poller by calling TryPoll in a loop,
+            /// so all the registered descriptors are served from one thread (i.e., one core).
+            /// A descriptor can have a receiver for the readability and a sender for the writability.
+            class EpollPoller
+            {
+            private:
+                using Callback = std::function<void()>;
+
+                struct Entry
+                {
+                    Callback Receiver;
+                    Callback Sender;
+                };
+
+                int mFileDescriptor;
+                std::mutex mEntriesMutex;
+                std::map<int, std::shared_ptr<const Entry>> mEntries;
+                std::atomic<std::thread::id> mPollingThread;
+
+                static uint32_t getEvents(const Entry &entry) noexcept;
+                bool tryUpdate(int fileDescriptor, Entry &&entry, bool added);
+                void waitForGracePeriod(const std::shared_ptr<const Entry> &entry) const;
+
+            public:
+                /// @brief Maximum number of the ready descriptors that are served per poll
+                static const int cMaxEvents = 64;
+
+                /// @brief Constructor
+                /// @throws std::runtime_error Throws if the epoll instance cannot be created
+                EpollPoller();
+
+                EpollPoller(const EpollPoller &) = delete;
+                EpollPoller &operator=(const EpollPoller &) = delete;
+
+                ~EpollPoller() noexcept;
+
+                /// @brief Try to add a receiver for a descriptor
+                /// @param fileDescriptor Descriptor to be watched for being readable
+                /// @param callback Callback to be invoked from the polling thread when the descriptor is readable
+                /// @returns True if the receiver is added; otherwise false
+                bool TryAddReceiver(int fileDescriptor, std::function<void()> callback);
+
+                /// @brief Try to remove a descriptor receiver
+                /// @param fileDescriptor Watched descriptor
+                /// @returns True if the receiver is removed; otherwise false
+                /// @note Out of the polling thread, the function returns after the on-going invocation of
+                /// the descriptor callbacks has been finished.
+                bool TryRemoveReceiver(int fileDescriptor);
+
+                /// @brief Try to add a sender for a descriptor
+                /// @param fileDescriptor Descriptor to be watched for being writable
+                /// @param callback Callback to be invoked from the polling thread when the descriptor is writable
+                /// @returns True if the sender is added; otherwise false
+                /// @note The poller keeps invoking the sender as long as the descriptor is writable,
+                /// so the sender should be removed as soon as there is nothing left to write.
+                bool TryAddSender(int fileDescriptor, std::function<void()> callback);
+
+                /// @brief Try to remove a descriptor sender
+                /// @param fileDescriptor Watched descriptor
+                /// @returns True if the sender is removed; otherwise false
+                /// @note Out of the polling thread, the function returns after the on-going invocation of
+                /// the descriptor callbacks has been finished.
+                bool TryRemoveSender(int fileDescriptor);
+
+                /// @brief Try to wait for the ready descriptors and invoke their callbacks
+                /// @param timeout Waiting timeout in milliseconds, zero for no waiting, or -1 for infinite waiting
+                /// @returns True if the poll is done (including an interrupted or a timed out wait); otherwise false
+                bool TryPoll(int timeout);
+            };
+        }
+    }
+}
+
+#endif
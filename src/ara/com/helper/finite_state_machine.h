@@ -1,8 +1,10 @@
 #ifndef FINITE_MACHINE_STATE_H
 #define FINITE_MACHINE_STATE_H
 
-#include <map>
+#include <array>
+#include <atomic>
 #include <initializer_list>
+#include <stdexcept>
 #include "./machine_state.h"
 
 namespace ara
@@ -12,18 +14,66 @@ namespace ara
         namespace helper
         {
             /// @brief Finite State Machine (FMS) controller
-            /// @details FMS controller is responsible for transiting between added states to the machine
-            /// @tparam T State enumeration type
+            /// @details FMS controller is responsible for transiting between added states to the machine.
+            /// The states are indexed by their enumeration underlying value, and the transitions are checked
+            /// against the state enumeration transition table which is validated at compile time.
+            /// @tparam T State enumeration type with a StateTraits specialization
             /// @note FSM controller is not copyable
             template <typename T>
             class FiniteStateMachine : public AbstractStateMachine<T>
             {
             private:
-                std::map<T, MachineState<T> *> mStates;
-                T mCurrentState;
+                static const std::size_t cStateCount = StateTraits<T>::cStateCount;
+
+                static constexpr std::size_t getIndex(T state) noexcept
+                {
+                    return static_cast<std::size_t>(state);
+                }
+
+                static constexpr bool isAllowed(T previousState, T nextState) noexcept
+                {
+                    return (StateTraits<T>::GetTransitions(previousState) & GetStateMask(nextState)) != 0;
+                }
+
+                static constexpr bool isValidTable() noexcept
+                {
+                    const uint32_t cAllStates = (1ULL << cStateCount) - 1;
+                    uint32_t _reachedStates = 0;
+
+                    for (std::size_t i = 0; i < cStateCount; ++i)
+                    {
+                        const uint32_t cTransitions = StateTraits<T>::GetTransitions(static_cast<T>(i));
+
+                        // A state should neither be a dead end nor transit to an unknown or to itself.
+                        if (cTransitions == 0 ||
+                            (cTransitions & ~cAllStates) != 0 ||
+                            (cTransitions & (1U << i)) != 0)
+                        {
+                            return false;
+                        }
+
+                        _reachedStates |= cTransitions;
+                    }
+
+                    // Every state should be reachable from another state.
+                    return _reachedStates == cAllStates;
+                }
+
+                std::array<MachineState<T> *, cStateCount> mStates;
+                std::atomic<T> mCurrentState;
 
             public:
-                FiniteStateMachine() noexcept = default;
+                FiniteStateMachine() noexcept : mCurrentState{T()}
+                {
+                    static_assert(
+                        cStateCount > 0 && cStateCount <= 32,
+                        "The state count does not fit in the transition masks.");
+
+                    static_assert(isValidTable(), "The state transition table is invalid.");
+
+                    mStates.fill(nullptr);
+                }
+
                 ~FiniteStateMachine() noexcept = default;
                 FiniteStateMachine(const FiniteStateMachine &) = delete;
                 FiniteStateMachine &operator=(const FiniteStateMachine &) = delete;
@@ -31,15 +81,35 @@ namespace ara
                 /// @brief Initalize the FSM
                 /// @param states Machine state list
                 /// @param entrypoint Entrypoint state to initialize the FSM
+                /// @throws std::invalid_argument Throws if a state is out of range or added twice,
+                /// or if the entrypoint state is not added
                 void Initialize(std::initializer_list<MachineState<T> *> states, T entrypoint)
                 {
+                    // Validate the whole list before registering, so a rejected list leaves the FSM untouched.
+                    std::array<MachineState<T> *, cStateCount> _states = mStates;
+                    for (auto state : states)
+                    {
+                        const std::size_t cIndex = getIndex(state->GetState());
+                        if (cIndex >= cStateCount || _states[cIndex] != nullptr)
+                        {
+                            throw std::invalid_argument("The state is out of range or duplicated.");
+                        }
+
+                        _states[cIndex] = state;
+                    }
+
+                    if (getIndex(entrypoint) >= cStateCount || _states[getIndex(entrypoint)] == nullptr)
+                    {
+                        throw std::invalid_argument("The entrypoint state is not added.");
+                    }
+
+                    mStates = _states;
                     for (auto state : states)
                     {
-                        mStates.emplace(state->GetState(), state);
                         state->Register(this);
                     }
 
-                    auto _initialState = mStates.at(entrypoint);
+                    auto _initialState = mStates[getIndex(entrypoint)];
                     // At entrypoint the previous state and the next state are the same.
                     _initialState->Activate(entrypoint);
                     mCurrentState = entrypoint;
@@ -47,30 +117,39 @@ namespace ara
 
                 /// @brief Get the FSM current state
                 /// @returns Current state enumeration
+                /// @note It is safe to call the function concurrently with the transitions.
                 T GetState() const noexcept
                 {
-                    return mCurrentState;
+                    return mCurrentState.load();
                 }
 
                 /// @brief Get the current machine state object
-                /// @returns Machine state object pointer
-                MachineState<T> *GetMachineState() const
+                /// @returns Machine state object pointer, or null if the FSM is not initialized yet
+                MachineState<T> *GetMachineState() const noexcept
                 {
-                    return mStates.at(mCurrentState);
+                    return mStates[getIndex(mCurrentState.load())];
                 }
 
+                /// @throws std::logic_error Throws if the transition is not in the state transition table
                 void Transit(T previousState, T nextState) override
                 {
+                    if (!isAllowed(previousState, nextState))
+                    {
+                        throw std::logic_error("The state transition is not allowed.");
+                    }
+
                     // Only current state should be able to transit to another state
-                    if (previousState == mCurrentState)
+                    T _expectedState = previousState;
+                    if (mCurrentState.compare_exchange_strong(_expectedState, nextState))
                     {
-                        auto _nextMachineState = mStates.at(nextState);
-                        mCurrentState = nextState;
-                        _nextMachineState->Activate(previousState);
+                        mStates[getIndex(nextState)]->Activate(previousState);
                     }
                 }
             };
+
+            template <typename T>
+            const std::size_t FiniteStateMachine<T>::cStateCount;
         }
     }
 }
-#endif
\ No newline at end of file
+#endif
@@ -24,6 +24,17 @@ namespace ara
                     ipAddress.Octets.end());
             }
 
+            void Ipv4Address::Inject(
+                uint8_t *buffer,
+                std::size_t &offset,
+                Ipv4Address ipAddress) noexcept
+            {
+                for (uint8_t octet : ipAddress.Octets)
+                {
+                    buffer[offset++] = octet;
+                }
+            }
+
             Ipv4Address Ipv4Address::Extract(
                 const std::vector<uint8_t> &vector,
                 std::size_t &offset)
@@ -36,6 +47,17 @@ namespace ara
 
                 return _result;
             }
+
+            Ipv4Address Ipv4Address::Extract(ByteReader &reader) noexcept
+            {
+                uint8_t _octet0 = reader.ReadByte();
+                uint8_t _octet1 = reader.ReadByte();
+                uint8_t _octet2 = reader.ReadByte();
+                uint8_t _octet3 = reader.ReadByte();
+                Ipv4Address _result(_octet0, _octet1, _octet2, _octet3);
+
+                return _result;
+            }
         };
     }
 }
\ No newline at end of file
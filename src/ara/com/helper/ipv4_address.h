@@ -4,6 +4,7 @@
 #include <array>
 #include <vector>
 #include <stdint.h>
+#include "./byte_reader.h"
 
 namespace ara
 {
@@ -39,6 +40,16 @@ namespace ara
                     std::vector<uint8_t> &vector,
                     Ipv4Address ipAddress);
 
+                /// @brief Inject an IP address into a byte buffer
+                /// @param buffer Byte buffer
+                /// @param offset Inject offset at the buffer which is advanced by the address size
+                /// @param ipAddress IP address to be injected
+                /// @warning The buffer capacity is not checked.
+                static void Inject(
+                    uint8_t *buffer,
+                    std::size_t &offset,
+                    Ipv4Address ipAddress) noexcept;
+
                 /// @brief Extract an IPv4 address from a byte vector
                 /// @param vector Byte vector
                 /// @param offset Extract offset at the vector
@@ -46,6 +57,12 @@ namespace ara
                 static Ipv4Address Extract(
                     const std::vector<uint8_t> &vector,
                     std::size_t &offset);
+
+                /// @brief Extract an IPv4 address from a byte reader
+                /// @param reader Byte reader whose cursor is advanced by the address size
+                /// @returns Extracted IPv4 address
+                /// @warning The reader remaining length should have been validated beforehand.
+                static Ipv4Address Extract(ByteReader &reader) noexcept;
             };
 
             /// @brief Ipv4Address equality operator override
@@ -1,6 +1,8 @@
 #ifndef MACHINE_STATE_H
 #define MACHINE_STATE_H
 
+#include <stdint.h>
+#include <cstddef>
 #include <functional>
 #include "./abstract_state_machine.h"
 
@@ -38,6 +40,110 @@ namespace ara
                 Subscribed      ///< Service server is up, and there is at least a subscriber
             };
 
+            /// @brief Get the bit mask of a state within a transition table
+            /// @tparam T State enumeration type
+            /// @param state State enumeration
+            /// @returns Single bit at the state enumeration underlying value
+            template <typename T>
+            constexpr uint32_t GetStateMask(T state) noexcept
+            {
+                return 1U << static_cast<uint32_t>(state);
+            }
+
+            /// @brief Compile-time description of a state enumeration
+            /// @tparam T State enumeration type
+            /// @details A specialization provides the number of the states, whose enumerators should be dense
+            /// from zero, and the next states that each state is allowed to transit to as a bit mask.
+            template <typename T>
+            struct StateTraits;
+
+            /// @brief Service discovery server state transition table
+            template <>
+            struct StateTraits<SdServerState>
+            {
+                /// @brief Number of the states
+                static const std::size_t cStateCount = 4;
+
+                /// @brief Get the allowed next states of a state
+                /// @param state Current state
+                /// @returns Bit mask of the allowed next states
+                static constexpr uint32_t GetTransitions(SdServerState state) noexcept
+                {
+                    return state == SdServerState::NotReady
+                               ? GetStateMask(SdServerState::InitialWaitPhase)
+                           : state == SdServerState::InitialWaitPhase
+                               ? GetStateMask(SdServerState::RepetitionPhase) |
+                                     GetStateMask(SdServerState::NotReady)
+                           : state == SdServerState::RepetitionPhase
+                               ? GetStateMask(SdServerState::MainPhase) |
+                                     GetStateMask(SdServerState::NotReady)
+                           : state == SdServerState::MainPhase
+                               ? GetStateMask(SdServerState::NotReady)
+                               : 0;
+                }
+            };
+
+            /// @brief Service discovery client state transition table
+            template <>
+            struct StateTraits<SdClientState>
+            {
+                /// @brief Number of the states
+                static const std::size_t cStateCount = 6;
+
+                /// @brief Get the allowed next states of a state
+                /// @param state Current state
+                /// @returns Bit mask of the allowed next states
+                static constexpr uint32_t GetTransitions(SdClientState state) noexcept
+                {
+                    return state == SdClientState::ServiceNotSeen
+                               ? GetStateMask(SdClientState::ServiceSeen) |
+                                     GetStateMask(SdClientState::ServiceReady) |
+                                     GetStateMask(SdClientState::InitialWaitPhase)
+                           : state == SdClientState::ServiceSeen
+                               ? GetStateMask(SdClientState::ServiceNotSeen) |
+                                     GetStateMask(SdClientState::ServiceReady)
+                           : state == SdClientState::ServiceReady
+                               ? GetStateMask(SdClientState::ServiceSeen) |
+                                     GetStateMask(SdClientState::Stopped) |
+                                     GetStateMask(SdClientState::InitialWaitPhase)
+                           : state == SdClientState::Stopped
+                               ? GetStateMask(SdClientState::ServiceNotSeen) |
+                                     GetStateMask(SdClientState::ServiceReady)
+                           : state == SdClientState::InitialWaitPhase
+                               ? GetStateMask(SdClientState::ServiceReady) |
+                                     GetStateMask(SdClientState::Stopped) |
+                                     GetStateMask(SdClientState::RepetitionPhase)
+                           : state == SdClientState::RepetitionPhase
+                               ? GetStateMask(SdClientState::ServiceReady) |
+                                     GetStateMask(SdClientState::Stopped)
+                               : 0;
+                }
+            };
+
+            /// @brief Publish-subscribe server state transition table
+            template <>
+            struct StateTraits<PubSubState>
+            {
+                /// @brief Number of the states
+                static const std::size_t cStateCount = 3;
+
+                /// @brief Get the allowed next states of a state
+                /// @param state Current state
+                /// @returns Bit mask of the allowed next states
+                static constexpr uint32_t GetTransitions(PubSubState state) noexcept
+                {
+                    return state == PubSubState::ServiceDown
+                               ? GetStateMask(PubSubState::NotSubscribed)
+                           : state == PubSubState::NotSubscribed
+                               ? GetStateMask(PubSubState::Subscribed) |
+                                     GetStateMask(PubSubState::ServiceDown)
+                           : state == PubSubState::Subscribed
+                               ? GetStateMask(PubSubState::NotSubscribed) |
+                                     GetStateMask(PubSubState::ServiceDown)
+                               : 0;
+                }
+            };
+
             /// @brief Machine state abstract class
             /// @tparam T State enumeration type
             /// @note A machine state is not copyable
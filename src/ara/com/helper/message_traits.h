@@ -0,0 +1,23 @@
+#ifndef MESSAGE_TRAITS_H
+#define MESSAGE_TRAITS_H
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Wire format traits of a message type which is received through a network layer
+            /// @tparam T Message type
+            /// @details The message type specializes the traits next to its own definition,
+            /// so the network layer stays agnostic to the wire format. A specialization provides:
+            /// - `static const std::size_t cErrorCodeCount`: Exclusive upper bound of the reported error code values
+            /// - `static core::Result<std::shared_ptr<const T>> Decode(const uint8_t *data, std::size_t size)`:
+            /// Decode a received payload which is only borrowed during the call
+            template <typename T>
+            struct MessageTraits;
+        }
+    }
+}
+
+#endif
@@ -1,9 +1,19 @@
 #ifndef NETWORK_LAYER_H
 #define NETWORK_LAYER_H
 
+#include <stdint.h>
+#include <vector>
+#include <cstddef>
+#include <array>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <functional>
 #include <type_traits>
+#include "../../core/result.h"
+#include "./dispatch_epoch.h"
+#include "./message_traits.h"
 
 namespace ara
 {
@@ -12,49 +22,197 @@ namespace ara
         namespace helper
         {
             /// @brief Network communication abstraction layer
-            /// @tparam T Message type
+            /// @tparam T Message type which specializes MessageTraits
+            /// @details A received payload is decoded once and the resulted immutable message is
+            /// shared among all the receivers. Payload receivers get the raw bytes before decoding,
+            /// so they can inspect the payload in place and skip the decoding when it is not of interest.
+            /// The receivers are kept in a copy-on-write snapshot, so the dispatch never blocks on
+            /// (un)registering receivers.
             template <typename T>
             class NetworkLayer
             {
+            public:
+                /// @brief Receiver callback type
+                using ReceiverCallback = std::function<void(std::shared_ptr<const T>)>;
+
+                /// @brief Raw payload receiver callback type
+                /// @note The payload is only borrowed during the callback.
+                using PayloadReceiverCallback = std::function<void(const uint8_t *, std::size_t)>;
+
             private:
-                std::map<void *, std::function<void(T)>> mReceiverCallbacks;
+                struct Receivers
+                {
+                    std::map<void *, PayloadReceiverCallback> Payloads;
+                    std::map<void *, ReceiverCallback> Messages;
+                };
+
+                using Traits = MessageTraits<T>;
+
+                std::shared_ptr<const Receivers> mReceivers;
+                std::mutex mReceiversMutex;
+                DispatchEpoch mDispatchEpoch;
+                std::array<std::atomic_size_t, Traits::cErrorCodeCount> mDroppedPayloads;
+                std::atomic_size_t mTotalDroppedPayloads;
+
+                void dropPayload(const core::ErrorCode &reason) noexcept
+                {
+                    auto _index{static_cast<std::size_t>(reason.Value())};
+                    if (_index < mDroppedPayloads.size())
+                    {
+                        mDroppedPayloads[_index].fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    mTotalDroppedPayloads.fetch_add(1, std::memory_order_relaxed);
+                }
 
             protected:
                 /// @brief Fire all the set receiver callaback
-                /// @param payload Received payload
-                void FireReceiverCallbacks(const std::vector<uint8_t> &payload)
+                /// @param data Pointer to the first byte of the received payload
+                /// @param size Received payload size in bytes
+                /// @note A malformed payload is dropped and counted without firing any message receiver callback.
+                /// The payload is only borrowed during the call, so a transport can pass its receive buffer in place.
+                void FireReceiverCallbacks(const uint8_t *data, std::size_t size)
                 {
-                    for (auto objectCallbackPair : mReceiverCallbacks)
+                    DispatchEpoch::Scope _dispatchScope(mDispatchEpoch);
+                    std::shared_ptr<const Receivers> _receivers{std::atomic_load(&mReceivers)};
+                    if (!_receivers)
+                    {
+                        return;
+                    }
+
+                    for (const auto &objectCallbackPair : _receivers->Payloads)
+                    {
+                        objectCallbackPair.second(data, size);
+                    }
+
+                    if (_receivers->Messages.empty())
                     {
-                        // Create the received message from the received payload
-                        T _receivedMessage{T::Deserialize(payload)};
+                        return;
+                    }
 
-                        std::function<void(T)> _callback = objectCallbackPair.second;
-                        _callback(std::move(_receivedMessage));
+                    // Create the received message from the received payload once for all the receivers
+                    core::Result<std::shared_ptr<const T>> _decoded{Traits::Decode(data, size)};
+                    if (!_decoded.HasValue())
+                    {
+                        dropPayload(_decoded.Error());
+                        return;
                     }
+
+                    std::shared_ptr<const T> _sharedMessage{std::move(_decoded).Value()};
+                    for (const auto &objectCallbackPair : _receivers->Messages)
+                    {
+                        objectCallbackPair.second(_sharedMessage);
+                    }
+                }
+
+                /// @brief Fire all the set receiver callaback
+                /// @param payload Received payload
+                /// @note A malformed payload is dropped and counted without firing any message receiver callback.
+                void FireReceiverCallbacks(const std::vector<uint8_t> &payload)
+                {
+                    FireReceiverCallbacks(payload.data(), payload.size());
                 }
 
             public:
-                NetworkLayer() noexcept = default;
+                NetworkLayer() noexcept : mTotalDroppedPayloads{0}
+                {
+                    for (auto &_droppedPayloads : mDroppedPayloads)
+                    {
+                        _droppedPayloads = 0;
+                    }
+                }
+
                 virtual ~NetworkLayer() noexcept = default;
 
                 /// @brief Send a message through the network
                 /// @param message Message to be sent
                 virtual void Send(const T &message) = 0;
 
+                /// @brief Send an already serialized message through the network
+                /// @param payload Serialized message payload
+                /// @note The bytes are transmitted as they are without decoding them.
+                virtual void SendPayload(const std::vector<uint8_t> &payload) = 0;
+
                 /// @brief Set a receiver callback
                 /// @param object Object that owns the callback
                 /// @param receiver Receiver callback to be called when a message has been received
-                void SetReceiver(void *object, std::function<void(T)> receiver)
+                void SetReceiver(void *object, ReceiverCallback receiver)
                 {
-                    mReceiverCallbacks[object] = receiver;
+                    std::lock_guard<std::mutex> _lock(mReceiversMutex);
+
+                    std::shared_ptr<const Receivers> _current{std::atomic_load(&mReceivers)};
+                    auto _updated{
+                        _current ? std::make_shared<Receivers>(*_current)
+                                 : std::make_shared<Receivers>()};
+                    _updated->Messages[object] = std::move(receiver);
+
+                    std::atomic_store(&mReceivers, std::shared_ptr<const Receivers>{std::move(_updated)});
+                }
+
+                /// @brief Set a raw payload receiver callback
+                /// @param object Object that owns the callback
+                /// @param receiver Receiver callback to be called with the raw bytes when a payload has been received
+                /// @note The payload is not validated before firing the callback.
+                void SetPayloadReceiver(void *object, PayloadReceiverCallback receiver)
+                {
+                    std::lock_guard<std::mutex> _lock(mReceiversMutex);
+
+                    std::shared_ptr<const Receivers> _current{std::atomic_load(&mReceivers)};
+                    auto _updated{
+                        _current ? std::make_shared<Receivers>(*_current)
+                                 : std::make_shared<Receivers>()};
+                    _updated->Payloads[object] = std::move(receiver);
+
+                    std::atomic_store(&mReceivers, std::shared_ptr<const Receivers>{std::move(_updated)});
                 }
 
-                /// @brief Remove a receiver callback
+                /// @brief Remove the message and the payload receiver callbacks of an object
                 /// @param object Callback owner object
+                /// @note The function returns after all the on-going dispatches that may still call the removed callback
+                /// have been finished, so the owner can be safely destructed afterwards.
+                /// @warning The function must not be called from within a receiver callback.
                 void ResetReceiver(void *object)
                 {
-                    mReceiverCallbacks.erase(object);
+                    std::lock_guard<std::mutex> _lock(mReceiversMutex);
+
+                    std::shared_ptr<const Receivers> _current{std::atomic_load(&mReceivers)};
+                    if (!_current ||
+                        (_current->Messages.find(object) == _current->Messages.end() &&
+                         _current->Payloads.find(object) == _current->Payloads.end()))
+                    {
+                        return;
+                    }
+
+                    auto _updated{std::make_shared<Receivers>(*_current)};
+                    _updated->Messages.erase(object);
+                    _updated->Payloads.erase(object);
+                    std::atomic_store(&mReceivers, std::shared_ptr<const Receivers>{std::move(_updated)});
+
+                    // Wait for the grace period in which the dispatches may still hold any older snapshot
+                    mDispatchEpoch.Synchronize();
+                }
+
+                /// @brief Get the number of the dropped malformed payloads
+                /// @returns Total number of the dropped payloads
+                std::size_t DroppedPayloads() const noexcept
+                {
+                    return mTotalDroppedPayloads.load(std::memory_order_relaxed);
+                }
+
+                /// @brief Get the number of the dropped malformed payloads due to a certain reason
+                /// @param reason Error code value of the malformation reason
+                /// @returns Number of the dropped payloads due to the reason
+                std::size_t DroppedPayloads(core::ErrorDomain::CodeType reason) const noexcept
+                {
+                    auto _index{static_cast<std::size_t>(reason)};
+                    if (_index < mDroppedPayloads.size())
+                    {
+                        return mDroppedPayloads[_index].load(std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        return 0;
+                    }
                 }
             };
         }
@@ -0,0 +1,251 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Thread-safe bounded pool of raw memory blocks for a certain object type
+            /// @tparam T Pooled object type
+            /// @details Released blocks are kept in a free-list and handed out again on the next allocation,
+            /// so the heap is only hit until the pool warms up or when it runs out of free blocks.
+            /// The process-wide pool additionally keeps a small free-list per thread, and it only locks
+            /// the shared free-list to move half of a thread cache at once, so concurrent allocations
+            /// do not contend on every new/delete.
+            /// @note The pool is meant to back class-specific new/delete operators.
+            template <typename T>
+            class ObjectPool
+            {
+            private:
+                struct Block
+                {
+                    Block *Next;
+                };
+
+                struct ThreadCache
+                {
+                    Block *Head;
+                    std::size_t Count;
+
+                    ThreadCache() noexcept : Head{nullptr}, Count{0}
+                    {
+                    }
+
+                    ~ThreadCache() noexcept
+                    {
+                        // The cached blocks of an exiting thread are handed back to the shared free-list.
+                        Instance().release(Head);
+                    }
+                };
+
+                static_assert(
+                    sizeof(T) >= sizeof(Block),
+                    "The object type is too small to be pooled.");
+
+                static const std::size_t cThreadCacheSize = 64;
+
+                std::mutex mMutex;
+                Block *mHead;
+                std::size_t mFreeBlocks;
+                const std::size_t mCapacity;
+                const bool mThreadCached;
+
+                ObjectPool(std::size_t capacity, bool threadCached) noexcept : mHead{nullptr},
+                                                                               mFreeBlocks{0},
+                                                                               mCapacity{capacity},
+                                                                               mThreadCached{threadCached}
+                {
+                }
+
+                static ThreadCache &getThreadCache() noexcept
+                {
+                    static thread_local ThreadCache tCache;
+                    return tCache;
+                }
+
+                static void destroy(Block *head) noexcept
+                {
+                    while (head)
+                    {
+                        Block *_block = head;
+                        head = head->Next;
+                        ::operator delete(_block);
+                    }
+                }
+
+                /// @brief Move up to a number of blocks from the shared free-list to a thread cache
+                void acquire(ThreadCache &cache, std::size_t count) noexcept
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    for (std::size_t i = 0; i < count && mHead; ++i)
+                    {
+                        Block *_block = mHead;
+                        mHead = mHead->Next;
+                        --mFreeBlocks;
+
+                        _block->Next = cache.Head;
+                        cache.Head = _block;
+                        ++cache.Count;
+                    }
+                }
+
+                /// @brief Move a block list to the shared free-list and free the blocks beyond the capacity
+                void release(Block *head) noexcept
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        while (head && mFreeBlocks < mCapacity)
+                        {
+                            Block *_block = head;
+                            head = head->Next;
+
+                            _block->Next = mHead;
+                            mHead = _block;
+                            ++mFreeBlocks;
+                        }
+                    }
+
+                    destroy(head);
+                }
+
+            public:
+                /// @brief Default maximum number of kept free blocks
+                static const std::size_t cDefaultCapacity = 1024;
+
+                /// @brief Constructor
+                /// @param capacity Maximum number of kept free blocks
+                explicit ObjectPool(
+                    std::size_t capacity = cDefaultCapacity) noexcept : ObjectPool(capacity, false)
+                {
+                }
+
+                ObjectPool(const ObjectPool &) = delete;
+                ObjectPool &operator=(const ObjectPool &) = delete;
+
+                ~ObjectPool() noexcept
+                {
+                    destroy(mHead);
+                }
+
+                /// @brief Get the number of the free blocks kept in the pool
+                /// @returns Number of free blocks in the shared free-list excluding the thread caches
+                std::size_t FreeBlocks()
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    return mFreeBlocks;
+                }
+
+                /// @brief Allocate a memory block
+                /// @param size Requested size in bytes
+                /// @returns Pointer to the allocated memory
+                /// @throws std::bad_alloc Throws when the heap allocation fails
+                /// @note Requests that do not match the object size (e.g., from a derived type) bypass the pool.
+                void *Allocate(std::size_t size)
+                {
+                    if (size == sizeof(T))
+                    {
+                        if (mThreadCached)
+                        {
+                            ThreadCache &_cache = getThreadCache();
+                            if (_cache.Head == nullptr)
+                            {
+                                acquire(_cache, cThreadCacheSize / 2);
+                            }
+
+                            if (_cache.Head)
+                            {
+                                Block *_block = _cache.Head;
+                                _cache.Head = _block->Next;
+                                --_cache.Count;
+
+                                return _block;
+                            }
+                        }
+                        else
+                        {
+                            std::lock_guard<std::mutex> _lock(mMutex);
+                            if (mHead)
+                            {
+                                Block *_block = mHead;
+                                mHead = mHead->Next;
+                                --mFreeBlocks;
+
+                                return _block;
+                            }
+                        }
+                    }
+
+                    return ::operator new(size);
+                }
+
+                /// @brief Release a memory block
+                /// @param pointer Pointer to the memory previously allocated by the pool
+                /// @param size Size in bytes that was requested at the allocation
+                void Deallocate(void *pointer, std::size_t size) noexcept
+                {
+                    if (pointer == nullptr)
+                    {
+                        return;
+                    }
+
+                    Block *_block = static_cast<Block *>(pointer);
+
+                    if (size != sizeof(T))
+                    {
+                        ::operator delete(pointer);
+                    }
+                    else if (mThreadCached)
+                    {
+                        ThreadCache &_cache = getThreadCache();
+                        if (_cache.Count == cThreadCacheSize)
+                        {
+                            // Hand the older half of a full cache back at once
+                            Block *_tail = _cache.Head;
+                            for (std::size_t i = 1; i < cThreadCacheSize / 2; ++i)
+                            {
+                                _tail = _tail->Next;
+                            }
+
+                            release(_tail->Next);
+                            _tail->Next = nullptr;
+                            _cache.Count = cThreadCacheSize / 2;
+                        }
+
+                        _block->Next = _cache.Head;
+                        _cache.Head = _block;
+                        ++_cache.Count;
+                    }
+                    else
+                    {
+                        _block->Next = nullptr;
+                        release(_block);
+                    }
+                }
+
+                /// @brief Get the process-wide pool of the object type
+                /// @returns Pool instance which caches the free blocks per thread
+                /// @note The instance is intentionally never destroyed,
+                /// so objects released during the static destruction can still be returned to it.
+                static ObjectPool &Instance()
+                {
+                    static ObjectPool *cInstance = new ObjectPool(cDefaultCapacity, true);
+                    return *cInstance;
+                }
+            };
+
+            template <typename T>
+            const std::size_t ObjectPool<T>::cThreadCacheSize;
+
+            template <typename T>
+            const std::size_t ObjectPool<T>::cDefaultCapacity;
+        }
+    }
+}
+
+#endif
@@ -34,6 +34,20 @@ namespace ara
                 vector.push_back(_byte);
             }
 
+            void Inject(uint8_t *buffer, std::size_t &offset, uint16_t value) noexcept
+            {
+                buffer[offset++] = static_cast<uint8_t>(value >> 8);
+                buffer[offset++] = static_cast<uint8_t>(value);
+            }
+
+            void Inject(uint8_t *buffer, std::size_t &offset, uint32_t value) noexcept
+            {
+                buffer[offset++] = static_cast<uint8_t>(value >> 24);
+                buffer[offset++] = static_cast<uint8_t>(value >> 16);
+                buffer[offset++] = static_cast<uint8_t>(value >> 8);
+                buffer[offset++] = static_cast<uint8_t>(value);
+            }
+
             void Concat(std::vector<uint8_t> &vector1, std::vector<uint8_t> &&vector2)
             {
                 vector1.insert(vector1.end(), vector2.begin(), vector2.end());
@@ -22,6 +22,20 @@ namespace ara
             /// @param value Integer input value
             void Inject(std::vector<uint8_t> &vector, uint32_t value);
 
+            /// @brief Inject a short value into a byte buffer
+            /// @param buffer Byte buffer
+            /// @param offset Inject offset at the buffer which is advanced by the value size
+            /// @param value Short input value
+            /// @warning The buffer capacity is not checked.
+            void Inject(uint8_t *buffer, std::size_t &offset, uint16_t value) noexcept;
+
+            /// @brief Inject an integer value into a byte buffer
+            /// @param buffer Byte buffer
+            /// @param offset Inject offset at the buffer which is advanced by the value size
+            /// @param value Integer input value
+            /// @warning The buffer capacity is not checked.
+            void Inject(uint8_t *buffer, std::size_t &offset, uint32_t value) noexcept;
+
             /// @brief Concat the second vector into the end of the first vector
             /// @param vector1 First vector
             /// @param vector2 Second vector
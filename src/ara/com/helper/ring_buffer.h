@@ -0,0 +1,336 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Bounded lock-free ring buffer with optional blocking waits
+            /// @tparam T Buffer element type which should be default constructible and move assignable
+            /// @tparam cMultiProducer Indicates whether more than one thread may enqueue concurrently
+            /// @tparam cMultiConsumer Indicates whether more than one thread may dequeue concurrently
+            /// @details Each cell carries a sequence number which tells the producers and the consumers
+            /// whether the cell is free or filled for their current lap. A single producer or consumer side
+            /// just stores its position, so it is wait-free; a multiple side claims its position by CAS,
+            /// so it is lock-free. The producer and the consumer positions are kept on separate cache lines.
+            /// The mutex and the condition variables are only touched if a thread is blocked on the buffer.
+            template <typename T, bool cMultiProducer, bool cMultiConsumer>
+            class RingBuffer
+            {
+            private:
+                static const std::size_t cCacheLineSize = 64;
+
+                struct Cell
+                {
+                    std::atomic_size_t Sequence;
+                    T Element;
+                };
+
+                const std::size_t mMask;
+                std::unique_ptr<Cell[]> mCells;
+                uint8_t mHeadPadding[cCacheLineSize];
+                std::atomic_size_t mHead;
+                uint8_t mTailPadding[cCacheLineSize - sizeof(std::atomic_size_t)];
+                std::atomic_size_t mTail;
+                uint8_t mWaitingPadding[cCacheLineSize - sizeof(std::atomic_size_t)];
+                std::atomic_size_t mWaitingProducers;
+                std::atomic_size_t mWaitingConsumers;
+                std::mutex mMutex;
+                std::condition_variable mNotFullConditionVariable;
+                std::condition_variable mNotEmptyConditionVariable;
+
+                static std::size_t getCapacity(std::size_t capacity)
+                {
+                    if (capacity == 0)
+                    {
+                        throw std::invalid_argument("The ring buffer capacity should be positive.");
+                    }
+
+                    // The sequence numbers need at least two cells to tell a free cell from a filled one.
+                    std::size_t _result = 2;
+                    while (_result < capacity)
+                    {
+                        _result <<= 1;
+                    }
+
+                    return _result;
+                }
+
+                static std::ptrdiff_t getDistance(std::size_t sequence, std::size_t position) noexcept
+                {
+                    return static_cast<std::ptrdiff_t>(sequence - position);
+                }
+
+                void notify(
+                    std::atomic_size_t &waiters,
+                    std::condition_variable &conditionVariable)
+                {
+                    // Pairs with the fence of the waiter, so either the waiter sees the change or it is counted here.
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiters.load(std::memory_order_relaxed) > 0)
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        conditionVariable.notify_all();
+                    }
+                }
+
+                template <typename F>
+                bool wait(
+                    std::atomic_size_t &waiters,
+                    std::condition_variable &conditionVariable,
+                    std::chrono::milliseconds timeout,
+                    F tryOperation)
+                {
+                    if (tryOperation())
+                    {
+                        return true;
+                    }
+
+                    const auto cDeadline{std::chrono::steady_clock::now() + timeout};
+                    std::unique_lock<std::mutex> _lock(mMutex);
+                    waiters.fetch_add(1);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    bool _result = conditionVariable.wait_until(_lock, cDeadline, tryOperation);
+                    waiters.fetch_sub(1);
+
+                    return _result;
+                }
+
+                bool tryEnqueue(T &element)
+                {
+                    Cell *_cell;
+                    std::size_t _position = mHead.load(std::memory_order_relaxed);
+
+                    while (true)
+                    {
+                        _cell = &mCells[_position & mMask];
+                        const std::size_t cSequence = _cell->Sequence.load(std::memory_order_acquire);
+                        const std::ptrdiff_t cDistance = getDistance(cSequence, _position);
+
+                        if (cDistance == 0)
+                        {
+                            if (!cMultiProducer)
+                            {
+                                mHead.store(_position + 1, std::memory_order_relaxed);
+                                break;
+                            }
+                            else if (mHead.compare_exchange_weak(
+                                         _position, _position + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                        }
+                        else if (cDistance < 0)
+                        {
+                            // The cell is still filled from the previous lap, so the buffer is full.
+                            return false;
+                        }
+                        else
+                        {
+                            _position = mHead.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    _cell->Element = std::move(element);
+                    _cell->Sequence.store(_position + 1, std::memory_order_release);
+
+                    return true;
+                }
+
+                bool tryDequeue(T &element)
+                {
+                    Cell *_cell;
+                    std::size_t _position = mTail.load(std::memory_order_relaxed);
+
+                    while (true)
+                    {
+                        _cell = &mCells[_position & mMask];
+                        const std::size_t cSequence = _cell->Sequence.load(std::memory_order_acquire);
+                        const std::ptrdiff_t cDistance = getDistance(cSequence, _position + 1);
+
+                        if (cDistance == 0)
+                        {
+                            if (!cMultiConsumer)
+                            {
+                                mTail.store(_position + 1, std::memory_order_relaxed);
+                                break;
+                            }
+                            else if (mTail.compare_exchange_weak(
+                                         _position, _position + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                        }
+                        else if (cDistance < 0)
+                        {
+                            // The cell is not filled in the current lap yet, so the buffer is empty.
+                            return false;
+                        }
+                        else
+                        {
+                            _position = mTail.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    element = std::move(_cell->Element);
+                    // Release the resources of the moved-from element before handing the cell over.
+                    _cell->Element = T();
+                    _cell->Sequence.store(_position + mMask + 1, std::memory_order_release);
+
+                    return true;
+                }
+
+            public:
+                /// @brief Default buffer capacity
+                static const std::size_t cDefaultCapacity = 1024;
+
+                /// @brief Constructor
+                /// @param capacity Minimum number of the elements that can be buffered (rounded up to a power of two)
+                /// @throws std::invalid_argument Throws if the capacity is zero
+                explicit RingBuffer(std::size_t capacity = cDefaultCapacity) : mMask{getCapacity(capacity) - 1},
+                                                                               mCells{new Cell[mMask + 1]},
+                                                                               mHead{0},
+                                                                               mTail{0},
+                                                                               mWaitingProducers{0},
+                                                                               mWaitingConsumers{0}
+                {
+                    for (std::size_t i = 0; i <= mMask; ++i)
+                    {
+                        mCells[i].Sequence.store(i, std::memory_order_relaxed);
+                    }
+                }
+
+                RingBuffer(const RingBuffer &) = delete;
+                RingBuffer &operator=(const RingBuffer &) = delete;
+
+                ~RingBuffer() = default;
+
+                /// @brief Get the buffer capacity
+                /// @returns Maximum number of the buffered elements
+                std::size_t Capacity() const noexcept
+                {
+                    return mMask + 1;
+                }
+
+                /// @brief Get the number of the buffered elements
+                /// @returns Element count which is only a snapshot under concurrent access
+                std::size_t Size() const noexcept
+                {
+                    const std::size_t cTail = mTail.load(std::memory_order_acquire);
+                    const std::size_t cHead = mHead.load(std::memory_order_acquire);
+
+                    // The tail may be already advanced beyond the loaded head.
+                    return getDistance(cHead, cTail) > 0 ? cHead - cTail : 0;
+                }
+
+                /// @brief Indicate whether the buffer is empty or not
+                /// @returns True if the buffer is empty, otherwise false
+                /// @note Under concurrent access, the result is only a snapshot.
+                bool Empty() const noexcept
+                {
+                    return Size() == 0;
+                }
+
+                /// @brief Try to insert an element to the buffer without blocking
+                /// @param[in] element Element to be moved into the buffer
+                /// @returns True if the element is moved to the buffer; false if the buffer is full
+                /// @note The element is left untouched if it could not be inserted.
+                bool TryEnqueue(T &&element)
+                {
+                    bool _result = tryEnqueue(element);
+                    if (_result)
+                    {
+                        notify(mWaitingConsumers, mNotEmptyConditionVariable);
+                    }
+
+                    return _result;
+                }
+
+                /// @brief Try to insert an element to the buffer by waiting for a free cell
+                /// @param[in] element Element to be moved into the buffer
+                /// @param timeout Maximum waiting duration while the buffer is full
+                /// @returns True if the element is moved to the buffer; false on timeout
+                bool TryEnqueue(T &&element, std::chrono::milliseconds timeout)
+                {
+                    bool _result =
+                        wait(
+                            mWaitingProducers, mNotFullConditionVariable, timeout,
+                            [this, &element]()
+                            { return tryEnqueue(element); });
+
+                    if (_result)
+                    {
+                        notify(mWaitingConsumers, mNotEmptyConditionVariable);
+                    }
+
+                    return _result;
+                }
+
+                /// @brief Try to take the oldest element out of the buffer without blocking
+                /// @param[out] element Element that is moved out from the buffer
+                /// @returns True if the element is dequeued; false if the buffer is empty
+                bool TryDequeue(T &element)
+                {
+                    bool _result = tryDequeue(element);
+                    if (_result)
+                    {
+                        notify(mWaitingProducers, mNotFullConditionVariable);
+                    }
+
+                    return _result;
+                }
+
+                /// @brief Try to take the oldest element out of the buffer by waiting for an element
+                /// @param[out] element Element that is moved out from the buffer
+                /// @param timeout Maximum waiting duration while the buffer is empty
+                /// @returns True if the element is dequeued; false on timeout
+                bool TryDequeue(T &element, std::chrono::milliseconds timeout)
+                {
+                    bool _result =
+                        wait(
+                            mWaitingConsumers, mNotEmptyConditionVariable, timeout,
+                            [this, &element]()
+                            { return tryDequeue(element); });
+
+                    if (_result)
+                    {
+                        notify(mWaitingProducers, mNotFullConditionVariable);
+                    }
+
+                    return _result;
+                }
+            };
+
+            template <typename T, bool cMultiProducer, bool cMultiConsumer>
+            const std::size_t RingBuffer<T, cMultiProducer, cMultiConsumer>::cCacheLineSize;
+
+            template <typename T, bool cMultiProducer, bool cMultiConsumer>
+            const std::size_t RingBuffer<T, cMultiProducer, cMultiConsumer>::cDefaultCapacity;
+
+            /// @brief Single-producer single-consumer ring buffer with wait-free fast paths
+            template <typename T>
+            using SpscRingBuffer = RingBuffer<T, false, false>;
+
+            /// @brief Multi-producer single-consumer ring buffer with a wait-free consumer
+            template <typename T>
+            using MpscRingBuffer = RingBuffer<T, true, false>;
+
+            /// @brief Multi-producer multi-consumer ring buffer with lock-free fast paths
+            template <typename T>
+            using MpmcRingBuffer = RingBuffer<T, true, true>;
+        }
+    }
+}
+
+#endif
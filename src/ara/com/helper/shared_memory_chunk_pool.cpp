@@ -0,0 +1,271 @@
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include "./shared_memory_chunk_pool.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const uint32_t SharedMemoryChunkPool::cInitializedMagic;
+            const std::size_t SharedMemoryChunkPool::cCacheLineSize;
+            const uint32_t SharedMemoryChunkPool::cInvalidChunk;
+
+            SharedMemoryChunkPool::SharedMemoryChunkPool(
+                const std::string &name,
+                std::size_t chunkSize,
+                std::size_t chunkCount) : mObject(name, getObjectSize(chunkSize, chunkCount)),
+                                          mHeader{static_cast<Header *>(mObject.Address())}
+            {
+                if (mObject.IsOwner())
+                {
+                    initialize(chunkSize, chunkCount);
+                }
+                else
+                {
+                    setLayout();
+                }
+            }
+
+            SharedMemoryChunkPool::SharedMemoryChunkPool(
+                const std::string &name) : mObject(name),
+                                           mHeader{static_cast<Header *>(mObject.Address())}
+            {
+                setLayout();
+            }
+
+            std::size_t SharedMemoryChunkPool::getControlsSize(std::size_t chunkCount) noexcept
+            {
+                std::size_t _result =
+                    (chunkCount * sizeof(ChunkControl) + cCacheLineSize - 1) / cCacheLineSize * cCacheLineSize;
+
+                return _result;
+            }
+
+            std::size_t SharedMemoryChunkPool::getObjectSize(std::size_t chunkSize, std::size_t chunkCount)
+            {
+                if (chunkSize == 0 || chunkSize > UINT32_MAX)
+                {
+                    throw std::invalid_argument("Invalid chunk size.");
+                }
+
+                if (chunkCount == 0 || chunkCount >= cInvalidChunk)
+                {
+                    throw std::invalid_argument("Invalid number of chunks.");
+                }
+
+                const std::size_t cAlignedChunkSize =
+                    (chunkSize + cCacheLineSize - 1) / cCacheLineSize * cCacheLineSize;
+
+                std::size_t _result =
+                    sizeof(Header) + getControlsSize(chunkCount) + chunkCount * cAlignedChunkSize;
+
+                return _result;
+            }
+
+            void SharedMemoryChunkPool::initialize(std::size_t chunkSize, std::size_t chunkCount)
+            {
+                Header *_header = new (mHeader) Header();
+                _header->ChunkSize = static_cast<uint32_t>(chunkSize);
+                _header->ChunkCount = static_cast<uint32_t>(chunkCount);
+                _header->FreeChunks.store(_header->ChunkCount, std::memory_order_relaxed);
+                _header->FreeHead.store(0, std::memory_order_relaxed);
+
+                mControls = reinterpret_cast<ChunkControl *>(reinterpret_cast<uint8_t *>(mHeader) + sizeof(Header));
+                for (uint32_t i = 0; i < _header->ChunkCount; ++i)
+                {
+                    ChunkControl *_control = new (mControls + i) ChunkControl();
+                    _control->ReferenceCount.store(0, std::memory_order_relaxed);
+                    _control->NextFree.store(
+                        i + 1 < _header->ChunkCount ? i + 1 : cInvalidChunk,
+                        std::memory_order_relaxed);
+                    _control->Size = 0;
+                }
+
+                // Publish the initialized pool to the openers
+                _header->Initialized.store(cInitializedMagic, std::memory_order_release);
+
+                setLayout();
+            }
+
+            void SharedMemoryChunkPool::setLayout() noexcept
+            {
+                while (mHeader->Initialized.load(std::memory_order_acquire) != cInitializedMagic)
+                {
+                    std::this_thread::yield();
+                }
+
+                uint8_t *_base = reinterpret_cast<uint8_t *>(mHeader) + sizeof(Header);
+                mControls = reinterpret_cast<ChunkControl *>(_base);
+                mChunks = _base + getControlsSize(mHeader->ChunkCount);
+                mAlignedChunkSize =
+                    (mHeader->ChunkSize + cCacheLineSize - 1) / cCacheLineSize * cCacheLineSize;
+            }
+
+            void SharedMemoryChunkPool::push(uint32_t chunk) noexcept
+            {
+                uint64_t _head = mHeader->FreeHead.load(std::memory_order_relaxed);
+                uint64_t _newHead;
+
+                do
+                {
+                    mControls[chunk].NextFree.store(static_cast<uint32_t>(_head), std::memory_order_relaxed);
+                    _newHead = (((_head >> 32) + 1) << 32) | chunk;
+                } while (!mHeader->FreeHead.compare_exchange_weak(
+                    _head, _newHead, std::memory_order_release, std::memory_order_relaxed));
+
+                mHeader->FreeChunks.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            std::size_t SharedMemoryChunkPool::ChunkSize() const noexcept
+            {
+                return mHeader->ChunkSize;
+            }
+
+            std::size_t SharedMemoryChunkPool::ChunkCount() const noexcept
+            {
+                return mHeader->ChunkCount;
+            }
+
+            std::size_t SharedMemoryChunkPool::FreeChunks() const noexcept
+            {
+                return mHeader->FreeChunks.load(std::memory_order_relaxed);
+            }
+
+            uint32_t SharedMemoryChunkPool::TryLoan() noexcept
+            {
+                uint64_t _head = mHeader->FreeHead.load(std::memory_order_acquire);
+                uint32_t _chunk;
+                uint64_t _newHead;
+
+                do
+                {
+                    _chunk = static_cast<uint32_t>(_head);
+                    if (_chunk == cInvalidChunk)
+                    {
+                        return cInvalidChunk;
+                    }
+
+                    // The tag fails the exchange if the chunk has been loaned and freed again in the meantime.
+                    const uint32_t cNext = mControls[_chunk].NextFree.load(std::memory_order_relaxed);
+                    _newHead = (((_head >> 32) + 1) << 32) | cNext;
+                } while (!mHeader->FreeHead.compare_exchange_weak(
+                    _head, _newHead, std::memory_order_acquire, std::memory_order_acquire));
+
+                mHeader->FreeChunks.fetch_sub(1, std::memory_order_relaxed);
+                mControls[_chunk].Size = 0;
+                mControls[_chunk].ReferenceCount.store(1, std::memory_order_relaxed);
+
+                return _chunk;
+            }
+
+            uint8_t *SharedMemoryChunkPool::Data(uint32_t chunk) const noexcept
+            {
+                return mChunks + chunk * mAlignedChunkSize;
+            }
+
+            std::size_t SharedMemoryChunkPool::Size(uint32_t chunk) const noexcept
+            {
+                return mControls[chunk].Size;
+            }
+
+            void SharedMemoryChunkPool::SetSize(uint32_t chunk, std::size_t size) noexcept
+            {
+                mControls[chunk].Size =
+                    static_cast<uint32_t>(size < mHeader->ChunkSize ? size : mHeader->ChunkSize);
+            }
+
+            void SharedMemoryChunkPool::Retain(uint32_t chunk, uint32_t count) noexcept
+            {
+                mControls[chunk].ReferenceCount.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            void SharedMemoryChunkPool::Release(uint32_t chunk) noexcept
+            {
+                // The last releaser must observe all the accesses of the other holders before recycling.
+                if (mControls[chunk].ReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    push(chunk);
+                }
+            }
+
+            LoanedSample::LoanedSample() noexcept : mPool{nullptr},
+                                                    mChunk{SharedMemoryChunkPool::cInvalidChunk}
+            {
+            }
+
+            LoanedSample::LoanedSample(
+                SharedMemoryChunkPool *pool,
+                uint32_t chunk) noexcept : mPool{pool},
+                                           mChunk{chunk}
+            {
+            }
+
+            LoanedSample::LoanedSample(LoanedSample &&other) noexcept : mPool{other.mPool},
+                                                                        mChunk{other.Detach()}
+            {
+            }
+
+            LoanedSample &LoanedSample::operator=(LoanedSample &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    Reset();
+                    mPool = other.mPool;
+                    mChunk = other.Detach();
+                }
+
+                return *this;
+            }
+
+            LoanedSample::~LoanedSample() noexcept
+            {
+                Reset();
+            }
+
+            LoanedSample::operator bool() const noexcept
+            {
+                return mChunk != SharedMemoryChunkPool::cInvalidChunk;
+            }
+
+            uint32_t LoanedSample::Chunk() const noexcept
+            {
+                return mChunk;
+            }
+
+            uint8_t *LoanedSample::Data() const noexcept
+            {
+                return mPool->Data(mChunk);
+            }
+
+            std::size_t LoanedSample::Size() const noexcept
+            {
+                return mPool->Size(mChunk);
+            }
+
+            std::size_t LoanedSample::Capacity() const noexcept
+            {
+                return mPool->ChunkSize();
+            }
+
+            void LoanedSample::Reset() noexcept
+            {
+                if (mChunk != SharedMemoryChunkPool::cInvalidChunk)
+                {
+                    mPool->Release(mChunk);
+                    mChunk = SharedMemoryChunkPool::cInvalidChunk;
+                }
+            }
+
+            uint32_t LoanedSample::Detach() noexcept
+            {
+                uint32_t _result = mChunk;
+                mChunk = SharedMemoryChunkPool::cInvalidChunk;
+
+                return _result;
+            }
+        }
+    }
+}
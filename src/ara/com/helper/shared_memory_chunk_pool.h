@@ -0,0 +1,179 @@
+#ifndef SHARED_MEMORY_CHUNK_POOL_H
+#define SHARED_MEMORY_CHUNK_POOL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include "./shared_memory_object.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Pool of fixed-size chunks in a POSIX shared-memory object
+            /// @details A chunk is identified by its index, which is valid in all the processes that map the pool.
+            /// Each chunk carries an atomic reference count in the shared memory, so a chunk can be shared
+            /// among processes and returns to the lock-free free-list when its last reference is released.
+            /// @note The process that creates the pool initializes and eventually unlinks it.
+            class SharedMemoryChunkPool
+            {
+            private:
+                static const uint32_t cInitializedMagic = 0x43484b50;
+                static const std::size_t cCacheLineSize = 64;
+
+                struct alignas(64) Header
+                {
+                    std::atomic<uint32_t> Initialized;
+                    uint32_t ChunkSize;
+                    uint32_t ChunkCount;
+                    std::atomic<uint32_t> FreeChunks;
+                    /// @brief Free-list head index tagged by a change counter against the ABA problem
+                    std::atomic<uint64_t> FreeHead;
+                };
+
+                struct ChunkControl
+                {
+                    std::atomic<uint32_t> ReferenceCount;
+                    std::atomic<uint32_t> NextFree;
+                    uint32_t Size;
+                };
+
+                static_assert(
+                    ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                    "The shared atomics must be lock-free to work across processes.");
+
+                SharedMemoryObject mObject;
+                Header *const mHeader;
+                ChunkControl *mControls;
+                uint8_t *mChunks;
+                std::size_t mAlignedChunkSize;
+
+                static std::size_t getControlsSize(std::size_t chunkCount) noexcept;
+                static std::size_t getObjectSize(std::size_t chunkSize, std::size_t chunkCount);
+                void initialize(std::size_t chunkSize, std::size_t chunkCount);
+                void setLayout() noexcept;
+                void push(uint32_t chunk) noexcept;
+
+            public:
+                /// @brief Invalid chunk index
+                static const uint32_t cInvalidChunk = 0xffffffff;
+
+                SharedMemoryChunkPool() = delete;
+                SharedMemoryChunkPool(const SharedMemoryChunkPool &) = delete;
+                SharedMemoryChunkPool &operator=(const SharedMemoryChunkPool &) = delete;
+
+                /// @brief Constructor which creates the pool or opens the existing one
+                /// @param name POSIX shared-memory object name starting with a slash
+                /// @param chunkSize Chunk size in bytes if the pool is created
+                /// @param chunkCount Number of the chunks if the pool is created
+                /// @throws std::invalid_argument Throws if the pool is created with no chunk or zero-size chunks
+                /// @throws std::runtime_error Throws if the shared-memory object cannot be created, opened, or mapped
+                SharedMemoryChunkPool(
+                    const std::string &name,
+                    std::size_t chunkSize,
+                    std::size_t chunkCount);
+
+                /// @brief Constructor which only opens the existing pool
+                /// @param name POSIX shared-memory object name starting with a slash
+                /// @throws std::runtime_error Throws if the pool does not exist or cannot be mapped
+                explicit SharedMemoryChunkPool(const std::string &name);
+
+                /// @brief Get the chunk size
+                /// @returns Maximum chunk content size in bytes
+                std::size_t ChunkSize() const noexcept;
+
+                /// @brief Get the number of the pool chunks
+                /// @returns Total number of the chunks
+                std::size_t ChunkCount() const noexcept;
+
+                /// @brief Get the number of the free chunks
+                /// @returns Number of the chunks that can be loaned now
+                std::size_t FreeChunks() const noexcept;
+
+                /// @brief Try to loan a free chunk
+                /// @returns Index of the loaned chunk with a single reference, or the invalid index if the pool is exhausted
+                uint32_t TryLoan() noexcept;
+
+                /// @brief Get the chunk content
+                /// @param chunk Chunk index
+                /// @returns Pointer to the first chunk byte in this process
+                uint8_t *Data(uint32_t chunk) const noexcept;
+
+                /// @brief Get the chunk content size
+                /// @param chunk Chunk index
+                /// @returns Content size in bytes set by the chunk writer
+                std::size_t Size(uint32_t chunk) const noexcept;
+
+                /// @brief Set the chunk content size
+                /// @param chunk Chunk index
+                /// @param size Content size in bytes which does not exceed the chunk size
+                /// @note The size must be set before sharing the chunk with the readers.
+                void SetSize(uint32_t chunk, std::size_t size) noexcept;
+
+                /// @brief Add references to a chunk
+                /// @param chunk Chunk index
+                /// @param count Number of the references to add
+                void Retain(uint32_t chunk, uint32_t count = 1) noexcept;
+
+                /// @brief Release a chunk reference
+                /// @param chunk Chunk index
+                /// @note The chunk returns to the pool once its last reference is released.
+                void Release(uint32_t chunk) noexcept;
+            };
+
+            /// @brief Move-only owner of a single reference to a shared-memory pool chunk
+            class LoanedSample
+            {
+            private:
+                SharedMemoryChunkPool *mPool;
+                uint32_t mChunk;
+
+            public:
+                /// @brief Constructor of an empty sample
+                LoanedSample() noexcept;
+
+                /// @brief Constructor
+                /// @param pool Pool that owns the chunk
+                /// @param chunk Index of the chunk whose reference is taken over by the sample
+                LoanedSample(SharedMemoryChunkPool *pool, uint32_t chunk) noexcept;
+
+                LoanedSample(const LoanedSample &) = delete;
+                LoanedSample &operator=(const LoanedSample &) = delete;
+                LoanedSample(LoanedSample &&other) noexcept;
+                LoanedSample &operator=(LoanedSample &&other) noexcept;
+                ~LoanedSample() noexcept;
+
+                /// @brief Indicate whether the sample owns a chunk or not
+                explicit operator bool() const noexcept;
+
+                /// @brief Get the sample chunk index
+                /// @returns Chunk index, or the invalid index if the sample is empty
+                uint32_t Chunk() const noexcept;
+
+                /// @brief Get the sample content
+                /// @returns Pointer to the first content byte in the shared memory
+                uint8_t *Data() const noexcept;
+
+                /// @brief Get the sample content size
+                /// @returns Content size in bytes
+                std::size_t Size() const noexcept;
+
+                /// @brief Get the sample capacity
+                /// @returns Maximum content size in bytes
+                std::size_t Capacity() const noexcept;
+
+                /// @brief Release the sample reference and leave the sample empty
+                void Reset() noexcept;
+
+                /// @brief Give up the reference ownership without releasing it
+                /// @returns Index of the chunk whose reference is now owned by the caller
+                uint32_t Detach() noexcept;
+            };
+        }
+    }
+}
+
+#endif
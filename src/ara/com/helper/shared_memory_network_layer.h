@@ -0,0 +1,121 @@
+#ifndef SHARED_MEMORY_NETWORK_LAYER_H
+#define SHARED_MEMORY_NETWORK_LAYER_H
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "./network_layer.h"
+#include "./shared_memory_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Same-host network communication layer over a pair of shared-memory rings
+            /// @tparam T Message type
+            /// @details A sent message is serialized once directly into the send ring, and the receiving thread
+            /// dispatches the records in place from the receive ring. The two peers of a connection swap
+            /// the ring names, and whichever peer comes first creates the rings.
+            /// @note A message that does not fit into the free ring space is counted as a failed send.
+            template <typename T>
+            class SharedMemoryNetworkLayer : public NetworkLayer<T>
+            {
+            private:
+                static const int cWaitTimeout = 100;
+
+                SharedMemoryRing mSendRing;
+                SharedMemoryRing mReceiveRing;
+                std::mutex mSendMutex;
+                std::atomic_bool mRunning;
+                std::atomic_size_t mFailedSends;
+                std::thread mReceivingThread;
+
+                void receive()
+                {
+                    while (mRunning)
+                    {
+                        if (mReceiveRing.Wait(cWaitTimeout))
+                        {
+                            mReceiveRing.Receive(
+                                [this](const uint8_t *data, std::size_t size)
+                                {
+                                    this->FireReceiverCallbacks(data, size);
+                                });
+                        }
+                    }
+                }
+
+            public:
+                SharedMemoryNetworkLayer() = delete;
+                SharedMemoryNetworkLayer(const SharedMemoryNetworkLayer &) = delete;
+                SharedMemoryNetworkLayer &operator=(const SharedMemoryNetworkLayer &) = delete;
+
+                /// @brief Constructor
+                /// @param sendRingName Shared-memory object name of the ring to send to
+                /// @param receiveRingName Shared-memory object name of the ring to receive from
+                /// @param capacity Data capacity in bytes of each ring if the rings are created
+                /// @throws std::runtime_error Throws if the rings cannot be created or opened
+                SharedMemoryNetworkLayer(
+                    const std::string &sendRingName,
+                    const std::string &receiveRingName,
+                    std::size_t capacity = SharedMemoryRing::cDefaultCapacity) : mSendRing(sendRingName, capacity),
+                                                                                 mReceiveRing(receiveRingName, capacity),
+                                                                                 mRunning{true},
+                                                                                 mFailedSends{0},
+                                                                                 mReceivingThread(
+                                                                                     &SharedMemoryNetworkLayer::receive,
+                                                                                     this)
+                {
+                }
+
+                ~SharedMemoryNetworkLayer() noexcept override
+                {
+                    mRunning = false;
+                    mReceiveRing.Wake();
+                    mReceivingThread.join();
+                }
+
+                void Send(const T &message) override
+                {
+                    const std::size_t cSize = message.Size();
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+
+                    uint8_t *_record = mSendRing.TryReserve(cSize);
+                    if (_record == nullptr)
+                    {
+                        ++mFailedSends;
+                        return;
+                    }
+
+                    message.SerializeTo(_record, cSize);
+                    mSendRing.Commit(cSize);
+                }
+
+                void SendPayload(const std::vector<uint8_t> &payload) override
+                {
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+
+                    if (!mSendRing.TryWrite(payload.data(), payload.size()))
+                    {
+                        ++mFailedSends;
+                    }
+                }
+
+                /// @brief Get the number of the messages that could not be sent
+                /// @returns Number of the messages which did not fit into the send ring
+                std::size_t FailedSends() const noexcept
+                {
+                    return mFailedSends;
+                }
+            };
+
+            template <typename T>
+            const int SharedMemoryNetworkLayer<T>::cWaitTimeout;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,156 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include "./shared_memory_object.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            SharedMemoryObject::SharedMemoryObject(
+                const std::string &name,
+                std::size_t size) : mName{name},
+                                    mOwner{false},
+                                    mFileDescriptor{-1},
+                                    mSize{0},
+                                    mAddress{nullptr}
+            {
+                mFileDescriptor = shm_open(mName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+
+                if (mFileDescriptor >= 0)
+                {
+                    mOwner = true;
+                    create(size);
+                }
+                else if (errno == EEXIST)
+                {
+                    mFileDescriptor = shm_open(mName.c_str(), O_RDWR, 0);
+                    if (mFileDescriptor < 0)
+                    {
+                        throw std::runtime_error(std::strerror(errno));
+                    }
+
+                    open();
+                }
+                else
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+            }
+
+            SharedMemoryObject::SharedMemoryObject(
+                const std::string &name) : mName{name},
+                                           mOwner{false},
+                                           mFileDescriptor{-1},
+                                           mSize{0},
+                                           mAddress{nullptr}
+            {
+                mFileDescriptor = shm_open(mName.c_str(), O_RDWR, 0);
+                if (mFileDescriptor < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+
+                open();
+            }
+
+            void SharedMemoryObject::throwError()
+            {
+                std::runtime_error _exception(std::strerror(errno));
+
+                if (mAddress)
+                {
+                    munmap(mAddress, mSize);
+                }
+
+                close(mFileDescriptor);
+                if (mOwner)
+                {
+                    shm_unlink(mName.c_str());
+                }
+
+                throw _exception;
+            }
+
+            void SharedMemoryObject::map()
+            {
+                void *_address =
+                    mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFileDescriptor, 0);
+
+                if (_address == MAP_FAILED)
+                {
+                    throwError();
+                }
+
+                mAddress = _address;
+            }
+
+            void SharedMemoryObject::create(std::size_t size)
+            {
+                mSize = size;
+
+                if (ftruncate(mFileDescriptor, static_cast<off_t>(mSize)) < 0)
+                {
+                    throwError();
+                }
+
+                map();
+            }
+
+            void SharedMemoryObject::open()
+            {
+                // The creator may not have sized the object yet.
+                struct stat _status;
+                do
+                {
+                    if (fstat(mFileDescriptor, &_status) < 0)
+                    {
+                        throwError();
+                    }
+
+                    if (_status.st_size == 0)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                } while (_status.st_size == 0);
+
+                mSize = static_cast<std::size_t>(_status.st_size);
+                map();
+            }
+
+            bool SharedMemoryObject::IsOwner() const noexcept
+            {
+                return mOwner;
+            }
+
+            std::size_t SharedMemoryObject::Size() const noexcept
+            {
+                return mSize;
+            }
+
+            void *SharedMemoryObject::Address() const noexcept
+            {
+                return mAddress;
+            }
+
+            SharedMemoryObject::~SharedMemoryObject() noexcept
+            {
+                munmap(mAddress, mSize);
+                close(mFileDescriptor);
+
+                if (mOwner)
+                {
+                    shm_unlink(mName.c_str());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef SHARED_MEMORY_OBJECT_H
+#define SHARED_MEMORY_OBJECT_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Mapped POSIX shared-memory object
+            /// @details The process that creates the object sizes it and eventually unlinks it.
+            /// The object is zero-filled on creation, so the creator should publish its initialized
+            /// content via an atomic flag that the openers wait for.
+            class SharedMemoryObject
+            {
+            private:
+                const std::string mName;
+                bool mOwner;
+                int mFileDescriptor;
+                std::size_t mSize;
+                void *mAddress;
+
+                void create(std::size_t size);
+                void open();
+                void map();
+                void throwError();
+
+            public:
+                SharedMemoryObject() = delete;
+                SharedMemoryObject(const SharedMemoryObject &) = delete;
+                SharedMemoryObject &operator=(const SharedMemoryObject &) = delete;
+
+                /// @brief Constructor which creates the object or opens the existing one
+                /// @param name Object name starting with a slash
+                /// @param size Object size in bytes if the object is created
+                /// @throws std::runtime_error Throws if the object cannot be created, opened, or mapped
+                SharedMemoryObject(const std::string &name, std::size_t size);
+
+                /// @brief Constructor which only opens the existing object
+                /// @param name Object name starting with a slash
+                /// @throws std::runtime_error Throws if the object does not exist or cannot be mapped
+                explicit SharedMemoryObject(const std::string &name);
+
+                ~SharedMemoryObject() noexcept;
+
+                /// @brief Indicate whether the object is created by this instance or not
+                /// @returns True if the instance has created the object; otherwise false
+                bool IsOwner() const noexcept;
+
+                /// @brief Get the mapped object size
+                /// @returns Size in bytes
+                std::size_t Size() const noexcept;
+
+                /// @brief Get the mapped object address
+                /// @returns Address of the first object byte in this process
+                void *Address() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,211 @@
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <unistd.h>
+#include <ctime>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include "./shared_memory_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const uint32_t SharedMemoryRing::cInitializedMagic;
+            const uint32_t SharedMemoryRing::cWrapMarker;
+            const std::size_t SharedMemoryRing::cLengthSize;
+            const std::size_t SharedMemoryRing::cAlignment;
+            const std::size_t SharedMemoryRing::cDefaultCapacity;
+
+            SharedMemoryRing::SharedMemoryRing(
+                const std::string &name,
+                std::size_t capacity) : mObject(name, getObjectSize(capacity)),
+                                        mHeader{static_cast<Header *>(mObject.Address())},
+                                        mData{static_cast<uint8_t *>(mObject.Address()) + sizeof(Header)},
+                                        mReservedOffset{0},
+                                        mReservedPadding{0}
+            {
+                if (mObject.IsOwner())
+                {
+                    Header *_header = new (mHeader) Header();
+                    _header->Capacity = static_cast<uint32_t>(mObject.Size() - sizeof(Header));
+                    _header->Head.store(0, std::memory_order_relaxed);
+                    _header->Tail.store(0, std::memory_order_relaxed);
+                    _header->Sequence.store(0, std::memory_order_relaxed);
+                    _header->ReaderWaiting.store(0, std::memory_order_relaxed);
+                    // Publish the initialized header to the openers
+                    _header->Initialized.store(cInitializedMagic, std::memory_order_release);
+                }
+                else
+                {
+                    while (mHeader->Initialized.load(std::memory_order_acquire) != cInitializedMagic)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            std::size_t SharedMemoryRing::getObjectSize(std::size_t capacity)
+            {
+                if (capacity == 0)
+                {
+                    throw std::invalid_argument("The ring capacity must be positive.");
+                }
+
+                std::size_t _result =
+                    sizeof(Header) + (capacity + cAlignment - 1) / cAlignment * cAlignment;
+
+                return _result;
+            }
+
+            std::size_t SharedMemoryRing::getRecordSize(std::size_t size) noexcept
+            {
+                std::size_t _result = (cLengthSize + size + cAlignment - 1) / cAlignment * cAlignment;
+                return _result;
+            }
+
+            void SharedMemoryRing::wake(bool always) noexcept
+            {
+                mHeader->Sequence.fetch_add(1);
+
+                if (always || mHeader->ReaderWaiting.load(std::memory_order_seq_cst) != 0)
+                {
+                    syscall(
+                        SYS_futex,
+                        reinterpret_cast<uint32_t *>(&mHeader->Sequence),
+                        FUTEX_WAKE,
+                        1,
+                        nullptr,
+                        nullptr,
+                        0);
+                }
+            }
+
+            std::size_t SharedMemoryRing::Capacity() const noexcept
+            {
+                return mHeader->Capacity;
+            }
+
+            bool SharedMemoryRing::Empty() const noexcept
+            {
+                // The sequentially consistent load pairs with the committed head store: a waiting reader
+                // either sees the new head, or the writer sees the reader waiting flag and wakes it up.
+                bool _result =
+                    mHeader->Head.load(std::memory_order_seq_cst) ==
+                    mHeader->Tail.load(std::memory_order_relaxed);
+
+                return _result;
+            }
+
+            uint8_t *SharedMemoryRing::TryReserve(std::size_t size) noexcept
+            {
+                const std::size_t cCapacity = mHeader->Capacity;
+                const std::size_t cRecordSize = getRecordSize(size);
+                const uint64_t cHead = mHeader->Head.load(std::memory_order_relaxed);
+                const uint64_t cTail = mHeader->Tail.load(std::memory_order_acquire);
+                const auto cOffset = static_cast<std::size_t>(cHead % cCapacity);
+                const std::size_t cContiguousSize = cCapacity - cOffset;
+                const auto cFreeSize = static_cast<std::size_t>(cCapacity - (cHead - cTail));
+
+                if (cRecordSize > cContiguousSize)
+                {
+                    // The record does not fit before the ring end, so it goes to the beginning.
+                    if (cContiguousSize + cRecordSize > cFreeSize)
+                    {
+                        return nullptr;
+                    }
+
+                    std::memcpy(mData + cOffset, &cWrapMarker, cLengthSize);
+                    mReservedPadding = cContiguousSize;
+                    mReservedOffset = 0;
+                }
+                else
+                {
+                    if (cRecordSize > cFreeSize)
+                    {
+                        return nullptr;
+                    }
+
+                    mReservedPadding = 0;
+                    mReservedOffset = cOffset;
+                }
+
+                return mData + mReservedOffset + cLengthSize;
+            }
+
+            void SharedMemoryRing::Commit(std::size_t size) noexcept
+            {
+                const auto cLength = static_cast<uint32_t>(size);
+                std::memcpy(mData + mReservedOffset, &cLength, cLengthSize);
+
+                const uint64_t cHead = mHeader->Head.load(std::memory_order_relaxed);
+                // The sequentially consistent store pairs with the reader waiting flag load in wake.
+                mHeader->Head.store(cHead + mReservedPadding + getRecordSize(size), std::memory_order_seq_cst);
+
+                wake(false);
+            }
+
+            bool SharedMemoryRing::TryWrite(const uint8_t *data, std::size_t size) noexcept
+            {
+                uint8_t *_record = TryReserve(size);
+
+                if (_record == nullptr)
+                {
+                    return false;
+                }
+
+                std::memcpy(_record, data, size);
+                Commit(size);
+
+                return true;
+            }
+
+            bool SharedMemoryRing::Wait(int timeout) noexcept
+            {
+                // Yield for a while before sleeping to keep the round trip short under load
+                const int cYieldCount = 64;
+
+                for (int i = 0; i < cYieldCount; ++i)
+                {
+                    if (!Empty())
+                    {
+                        return true;
+                    }
+
+                    std::this_thread::yield();
+                }
+
+                const uint32_t cSequence = mHeader->Sequence.load();
+                mHeader->ReaderWaiting.store(1, std::memory_order_seq_cst);
+
+                // Recheck after announcing the wait, so a concurrent commit cannot be missed
+                if (Empty())
+                {
+                    timespec _timeout;
+                    _timeout.tv_sec = timeout / 1000;
+                    _timeout.tv_nsec = (timeout % 1000) * 1000000L;
+
+                    syscall(
+                        SYS_futex,
+                        reinterpret_cast<uint32_t *>(&mHeader->Sequence),
+                        FUTEX_WAIT,
+                        cSequence,
+                        &_timeout,
+                        nullptr,
+                        0);
+                }
+
+                mHeader->ReaderWaiting.store(0);
+
+                return !Empty();
+            }
+
+            void SharedMemoryRing::Wake() noexcept
+            {
+                wake(true);
+            }
+        }
+    }
+}
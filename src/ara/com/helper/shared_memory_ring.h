@@ -0,0 +1,152 @@
+#ifndef SHARED_MEMORY_RING_H
+#define SHARED_MEMORY_RING_H
+
+#include <stdint.h>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "./shared_memory_object.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Single-producer single-consumer byte ring in a POSIX shared-memory object
+            /// @details Each record is a length prefix followed by the record bytes, and it is padded to
+            /// an 8-byte boundary. A record never wraps; instead a wrap marker sends the reader back to
+            /// the ring beginning. The writer reserves a record in place, fills it, and commits it;
+            /// the reader consumes the records in place. The reader sleeps on a futex in the shared memory,
+            /// so the ring works across processes.
+            /// @note The process that creates the ring initializes and eventually unlinks it.
+            class SharedMemoryRing
+            {
+            private:
+                static const uint32_t cInitializedMagic = 0x534f4d45;
+                static const uint32_t cWrapMarker = 0xffffffff;
+                static const std::size_t cLengthSize = sizeof(uint32_t);
+                static const std::size_t cAlignment = 8;
+
+                struct alignas(64) Header
+                {
+                    std::atomic<uint32_t> Initialized;
+                    uint32_t Capacity;
+                    alignas(64) std::atomic<uint64_t> Head;
+                    alignas(64) std::atomic<uint64_t> Tail;
+                    alignas(64) std::atomic<uint32_t> Sequence;
+                    std::atomic<uint32_t> ReaderWaiting;
+                };
+
+                static_assert(
+                    ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                    "The shared atomics must be lock-free to work across processes.");
+
+                SharedMemoryObject mObject;
+                Header *const mHeader;
+                uint8_t *const mData;
+                std::size_t mReservedOffset;
+                std::size_t mReservedPadding;
+
+                static std::size_t getObjectSize(std::size_t capacity);
+                static std::size_t getRecordSize(std::size_t size) noexcept;
+                void wake(bool always) noexcept;
+
+            public:
+                /// @brief Default ring data capacity in bytes
+                static const std::size_t cDefaultCapacity = 1048576;
+
+                SharedMemoryRing() = delete;
+                SharedMemoryRing(const SharedMemoryRing &) = delete;
+                SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+
+                /// @brief Constructor which creates the ring or opens the existing one
+                /// @param name POSIX shared-memory object name starting with a slash
+                /// @param capacity Ring data capacity in bytes if the ring is created (rounded up to 8 bytes)
+                /// @throws std::invalid_argument Throws if the ring is created with zero capacity
+                /// @throws std::runtime_error Throws if the shared-memory object cannot be created, opened, or mapped
+                explicit SharedMemoryRing(
+                    const std::string &name,
+                    std::size_t capacity = cDefaultCapacity);
+
+                /// @brief Get the ring data capacity
+                /// @returns Capacity in bytes shared by all the records and their prefixes
+                std::size_t Capacity() const noexcept;
+
+                /// @brief Indicate whether the ring is empty or not
+                /// @returns True if there is no committed record to read; otherwise false
+                bool Empty() const noexcept;
+
+                /// @brief Try to reserve a record for writing in place
+                /// @param size Record size in bytes
+                /// @returns Pointer to the reserved record bytes, or null if the ring has not enough free space
+                /// @warning Only the single writer may call the function, and the reservation must be committed
+                /// before the next one.
+                uint8_t *TryReserve(std::size_t size) noexcept;
+
+                /// @brief Commit the reserved record and wake the reader up
+                /// @param size Record size in bytes which must be equal to the reserved size
+                void Commit(std::size_t size) noexcept;
+
+                /// @brief Try to write a copy of a record
+                /// @param data Pointer to the first byte of the record
+                /// @param size Record size in bytes
+                /// @returns True if the record is written; otherwise false
+                bool TryWrite(const uint8_t *data, std::size_t size) noexcept;
+
+                /// @brief Read all the committed records in place
+                /// @tparam F Callback type invocable with a record byte pointer and size
+                /// @param callback Callback to be invoked per record
+                /// @returns Number of the read records
+                /// @warning The record bytes are only valid within the callback invocation,
+                /// and only the single reader may call the function.
+                template <typename F>
+                std::size_t Receive(F &&callback)
+                {
+                    std::size_t _result = 0;
+                    uint64_t _tail = mHeader->Tail.load(std::memory_order_relaxed);
+                    const uint64_t cHead = mHeader->Head.load(std::memory_order_acquire);
+
+                    while (_tail != cHead)
+                    {
+                        const auto cOffset = static_cast<std::size_t>(_tail % mHeader->Capacity);
+                        uint32_t _length;
+                        std::memcpy(&_length, mData + cOffset, cLengthSize);
+
+                        if (_length == cWrapMarker)
+                        {
+                            _tail += mHeader->Capacity - cOffset;
+                        }
+                        else if (_length > mHeader->Capacity - cOffset - cLengthSize)
+                        {
+                            // A corrupted prefix: skip all the committed records
+                            _tail = cHead;
+                        }
+                        else
+                        {
+                            callback(mData + cOffset + cLengthSize, static_cast<std::size_t>(_length));
+                            _tail += getRecordSize(_length);
+                            ++_result;
+                        }
+
+                        // Release the record memory to the writer
+                        mHeader->Tail.store(_tail, std::memory_order_release);
+                    }
+
+                    return _result;
+                }
+
+                /// @brief Wait until there is a committed record to read
+                /// @param timeout Waiting timeout in milliseconds
+                /// @returns True if there is a record to read; otherwise false (e.g., timeout or woken up)
+                bool Wait(int timeout) noexcept;
+
+                /// @brief Wake the waiting reader up regardless of the ring content
+                void Wake() noexcept;
+            };
+        }
+    }
+}
+
+#endif
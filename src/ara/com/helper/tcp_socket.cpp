@@ -0,0 +1,196 @@
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include "./tcp_socket.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            namespace
+            {
+                sockaddr_in getAddress(Ipv4Address ipAddress, uint16_t port) noexcept
+                {
+                    sockaddr_in _result;
+                    std::memset(&_result, 0, sizeof(_result));
+                    _result.sin_family = AF_INET;
+                    _result.sin_port = htons(port);
+                    // The octets are already in the network byte order.
+                    std::memcpy(&_result.sin_addr.s_addr, ipAddress.Octets.data(), ipAddress.Octets.size());
+
+                    return _result;
+                }
+
+                void throwError(int fileDescriptor)
+                {
+                    std::runtime_error _exception(std::strerror(errno));
+                    close(fileDescriptor);
+                    throw _exception;
+                }
+            }
+
+            const int TcpSocket::cMaxVectors;
+
+            TcpSocket::TcpSocket(int fileDescriptor) : mFileDescriptor{fileDescriptor}
+            {
+                int _flags = fcntl(mFileDescriptor, F_GETFL, 0);
+                if (_flags < 0 || fcntl(mFileDescriptor, F_SETFL, _flags | O_NONBLOCK) < 0)
+                {
+                    throwError(mFileDescriptor);
+                }
+            }
+
+            int TcpSocket::FileDescriptor() const noexcept
+            {
+                return mFileDescriptor;
+            }
+
+            void TcpSocket::SetNoDelay(bool noDelay)
+            {
+                int _value = noDelay ? 1 : 0;
+                if (setsockopt(mFileDescriptor, IPPROTO_TCP, TCP_NODELAY, &_value, sizeof(_value)) < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+            }
+
+            ssize_t TcpSocket::Receive(uint8_t *buffer, std::size_t size) noexcept
+            {
+                ssize_t _result;
+
+                do
+                {
+                    _result = recv(mFileDescriptor, buffer, size, 0);
+                } while (_result < 0 && errno == EINTR);
+
+                return _result;
+            }
+
+            ssize_t TcpSocket::Send(const iovec *vectors, int count) noexcept
+            {
+                ssize_t _result;
+
+                if (count > cMaxVectors)
+                {
+                    count = cMaxVectors;
+                }
+
+                msghdr _header;
+                std::memset(&_header, 0, sizeof(_header));
+                // sendmsg does not modify the written bytes.
+                _header.msg_iov = const_cast<iovec *>(vectors);
+                _header.msg_iovlen = static_cast<std::size_t>(count);
+
+                do
+                {
+                    // Unlike writev, a closed peer is reported as EPIPE instead of raising SIGPIPE.
+                    _result = sendmsg(mFileDescriptor, &_header, MSG_NOSIGNAL);
+                } while (_result < 0 && errno == EINTR);
+
+                return _result;
+            }
+
+            std::unique_ptr<TcpSocket> TcpSocket::Connect(Ipv4Address ipAddress, uint16_t port)
+            {
+                int _fileDescriptor = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+                if (_fileDescriptor < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+
+                sockaddr_in _remoteAddress{getAddress(ipAddress, port)};
+                if (connect(
+                        _fileDescriptor,
+                        reinterpret_cast<const sockaddr *>(&_remoteAddress),
+                        sizeof(_remoteAddress)) < 0)
+                {
+                    throwError(_fileDescriptor);
+                }
+
+                return std::unique_ptr<TcpSocket>(new TcpSocket(_fileDescriptor));
+            }
+
+            TcpSocket::~TcpSocket() noexcept
+            {
+                close(mFileDescriptor);
+            }
+
+            TcpListener::TcpListener(
+                Ipv4Address ipAddress,
+                uint16_t port) : mFileDescriptor{
+                                     socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP)}
+            {
+                if (mFileDescriptor < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+
+                const int cEnabled = 1;
+                if (setsockopt(mFileDescriptor, SOL_SOCKET, SO_REUSEADDR, &cEnabled, sizeof(cEnabled)) < 0)
+                {
+                    throwError(mFileDescriptor);
+                }
+
+                sockaddr_in _localAddress{getAddress(ipAddress, port)};
+                if (bind(
+                        mFileDescriptor,
+                        reinterpret_cast<const sockaddr *>(&_localAddress),
+                        sizeof(_localAddress)) < 0)
+                {
+                    throwError(mFileDescriptor);
+                }
+
+                if (listen(mFileDescriptor, SOMAXCONN) < 0)
+                {
+                    throwError(mFileDescriptor);
+                }
+            }
+
+            int TcpListener::FileDescriptor() const noexcept
+            {
+                return mFileDescriptor;
+            }
+
+            uint16_t TcpListener::Port() const noexcept
+            {
+                sockaddr_in _localAddress;
+                socklen_t _length = sizeof(_localAddress);
+                getsockname(mFileDescriptor, reinterpret_cast<sockaddr *>(&_localAddress), &_length);
+
+                return ntohs(_localAddress.sin_port);
+            }
+
+            std::unique_ptr<TcpSocket> TcpListener::TryAccept()
+            {
+                int _fileDescriptor;
+
+                do
+                {
+                    _fileDescriptor = accept4(mFileDescriptor, nullptr, nullptr, SOCK_CLOEXEC);
+                } while (_fileDescriptor < 0 && errno == EINTR);
+
+                if (_fileDescriptor < 0)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    return std::unique_ptr<TcpSocket>(new TcpSocket(_fileDescriptor));
+                }
+            }
+
+            TcpListener::~TcpListener() noexcept
+            {
+                close(mFileDescriptor);
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#ifndef TCP_SOCKET_H
+#define TCP_SOCKET_H
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <stdint.h>
+#include <cstddef>
+#include <memory>
+#include "./ipv4_address.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Non-blocking connected TCP socket
+            class TcpSocket
+            {
+            private:
+                int mFileDescriptor;
+
+            public:
+                /// @brief Maximum number of buffers that are gathered per write
+                static const int cMaxVectors = 1024;
+
+                TcpSocket() = delete;
+                TcpSocket(const TcpSocket &) = delete;
+                TcpSocket &operator=(const TcpSocket &) = delete;
+
+                /// @brief Constructor
+                /// @param fileDescriptor Connected socket descriptor to be owned
+                /// @throws std::runtime_error Throws if the descriptor cannot be made non-blocking
+                explicit TcpSocket(int fileDescriptor);
+
+                ~TcpSocket() noexcept;
+
+                /// @brief Get the socket descriptor
+                /// @returns Descriptor to be watched by a poller
+                int FileDescriptor() const noexcept;
+
+                /// @brief Enable or disable the Nagle's algorithm bypass
+                /// @param noDelay True to send the small segments immediately (i.e., TCP_NODELAY); otherwise false
+                /// @throws std::runtime_error Throws if the option cannot be set
+                void SetNoDelay(bool noDelay);
+
+                /// @brief Receive the available bytes without blocking
+                /// @param buffer Receive buffer
+                /// @param size Receive buffer capacity
+                /// @returns Number of the received bytes, zero if the peer has closed the connection,
+                /// or -1 with errno set (EAGAIN if nothing is available)
+                ssize_t Receive(uint8_t *buffer, std::size_t size) noexcept;
+
+                /// @brief Write gathered buffers without blocking
+                /// @param vectors Buffers to be written in order
+                /// @param count Number of the buffers which is limited to the maximum vectors
+                /// @returns Number of the written bytes, or -1 with errno set (EAGAIN if the send buffer is full)
+                ssize_t Send(const iovec *vectors, int count) noexcept;
+
+                /// @brief Connect to a remote endpoint
+                /// @param ipAddress Remote IP address
+                /// @param port Remote TCP port number
+                /// @returns Connected socket
+                /// @throws std::runtime_error Throws if the connection cannot be established
+                static std::unique_ptr<TcpSocket> Connect(Ipv4Address ipAddress, uint16_t port);
+            };
+
+            /// @brief Non-blocking listening TCP socket
+            class TcpListener
+            {
+            private:
+                int mFileDescriptor;
+
+            public:
+                TcpListener() = delete;
+                TcpListener(const TcpListener &) = delete;
+                TcpListener &operator=(const TcpListener &) = delete;
+
+                /// @brief Constructor
+                /// @param ipAddress Local interface IP address to listen on
+                /// @param port Local TCP port number to listen on, or zero for an ephemeral port
+                /// @throws std::runtime_error Throws if the socket cannot be bound or listen
+                TcpListener(Ipv4Address ipAddress, uint16_t port);
+
+                ~TcpListener() noexcept;
+
+                /// @brief Get the socket descriptor
+                /// @returns Descriptor to be watched by a poller for the incoming connections
+                int FileDescriptor() const noexcept;
+
+                /// @brief Get the listening port
+                /// @returns Bound local TCP port number
+                uint16_t Port() const noexcept;
+
+                /// @brief Try to accept a pending connection without blocking
+                /// @returns Accepted socket, or null if there is no pending connection
+                std::unique_ptr<TcpSocket> TryAccept();
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,350 @@
+#include <algorithm>
+#include <stdexcept>
+#include "./timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const uint32_t TimerWheel::cNil;
+            const std::size_t TimerWheel::cLevelCount;
+            const uint32_t TimerWheel::cSlotBitLength;
+            const uint32_t TimerWheel::cSlotCount;
+            const uint64_t TimerWheel::cSlotMask;
+            const uint64_t TimerWheel::cMaxTicks;
+            const TimerWheel::TimerId TimerWheel::cInvalidTimer;
+            constexpr std::chrono::milliseconds TimerWheel::cDefaultTick;
+
+            TimerWheel::TimerWheel(std::chrono::milliseconds tick) : mTick{tick},
+                                                                     mStart{Clock::now()},
+                                                                     mFreeNode{cNil},
+                                                                     mPending{0},
+                                                                     mCurrentTick{0},
+                                                                     mFiringTimer{cInvalidTimer},
+                                                                     mRunning{true}
+            {
+                if (tick.count() <= 0)
+                {
+                    throw std::invalid_argument("The tick resolution should be positive.");
+                }
+
+                mSlots.fill(cNil);
+                mThread = std::thread(&TimerWheel::run, this);
+            }
+
+            TimerWheel &TimerWheel::Shared()
+            {
+                static TimerWheel _wheel;
+                return _wheel;
+            }
+
+            TimerWheel::TimerId TimerWheel::getId(uint32_t index, uint32_t generation) noexcept
+            {
+                const uint32_t cGenerationShift = 32;
+                TimerId _result = (static_cast<TimerId>(generation) << cGenerationShift) | index;
+
+                return _result;
+            }
+
+            uint64_t TimerWheel::getTick(Clock::time_point time) const noexcept
+            {
+                uint64_t _result = (time - mStart) / mTick;
+                return _result;
+            }
+
+            uint32_t TimerWheel::allocate()
+            {
+                uint32_t _result;
+
+                if (mFreeNode == cNil)
+                {
+                    const uint32_t cInitialGeneration = 1;
+                    _result = static_cast<uint32_t>(mNodes.size());
+                    mNodes.push_back(Node{0, cInitialGeneration, cNil, cNil, cNil, nullptr});
+                }
+                else
+                {
+                    _result = mFreeNode;
+                    mFreeNode = mNodes[_result].Next;
+                }
+
+                return _result;
+            }
+
+            void TimerWheel::release(uint32_t index) noexcept
+            {
+                Node &_node = mNodes[index];
+                _node.Callback = nullptr;
+                _node.Slot = cNil;
+
+                // Invalidate the released handle while never generating the invalid handle
+                if (++_node.Generation == 0)
+                {
+                    ++_node.Generation;
+                }
+
+                _node.Next = mFreeNode;
+                mFreeNode = index;
+            }
+
+            void TimerWheel::link(uint32_t index) noexcept
+            {
+                Node &_node = mNodes[index];
+                const uint64_t cDelta =
+                    _node.Expiry > mCurrentTick ? _node.Expiry - mCurrentTick : 0;
+                // A timer beyond the wheel span waits at the top level to be re-cascaded.
+                const uint64_t cExpiry =
+                    cDelta > cMaxTicks ? mCurrentTick + cMaxTicks : _node.Expiry;
+
+                std::size_t _level = 0;
+                while (_level + 1 < cLevelCount &&
+                       cDelta >= (1ULL << (cSlotBitLength * (_level + 1))))
+                {
+                    ++_level;
+                }
+
+                const uint32_t cSlot =
+                    static_cast<uint32_t>(
+                        _level * cSlotCount +
+                        ((cExpiry >> (cSlotBitLength * _level)) & cSlotMask));
+
+                _node.Slot = cSlot;
+                _node.Previous = cNil;
+                _node.Next = mSlots[cSlot];
+                if (_node.Next != cNil)
+                {
+                    mNodes[_node.Next].Previous = index;
+                }
+                mSlots[cSlot] = index;
+            }
+
+            void TimerWheel::unlink(uint32_t index) noexcept
+            {
+                Node &_node = mNodes[index];
+
+                if (_node.Previous == cNil)
+                {
+                    mSlots[_node.Slot] = _node.Next;
+                }
+                else
+                {
+                    mNodes[_node.Previous].Next = _node.Next;
+                }
+
+                if (_node.Next != cNil)
+                {
+                    mNodes[_node.Next].Previous = _node.Previous;
+                }
+            }
+
+            void TimerWheel::cascade(std::size_t level) noexcept
+            {
+                const uint32_t cSlot =
+                    static_cast<uint32_t>(
+                        level * cSlotCount +
+                        ((mCurrentTick >> (cSlotBitLength * level)) & cSlotMask));
+
+                uint32_t _index = mSlots[cSlot];
+                mSlots[cSlot] = cNil;
+
+                while (_index != cNil)
+                {
+                    const uint32_t cNext = mNodes[_index].Next;
+                    link(_index);
+                    _index = cNext;
+                }
+            }
+
+            void TimerWheel::advance(uint64_t tick, std::vector<uint32_t> &expired) noexcept
+            {
+                while (mCurrentTick < tick)
+                {
+                    ++mCurrentTick;
+
+                    // Turn the upper levels whose lower levels have wrapped around
+                    for (std::size_t _level = 1; _level < cLevelCount; ++_level)
+                    {
+                        const uint64_t cLowerMask = (1ULL << (cSlotBitLength * _level)) - 1;
+                        if ((mCurrentTick & cLowerMask) != 0)
+                        {
+                            break;
+                        }
+
+                        cascade(_level);
+                    }
+
+                    const uint32_t cSlot = static_cast<uint32_t>(mCurrentTick & cSlotMask);
+                    uint32_t _index = mSlots[cSlot];
+                    mSlots[cSlot] = cNil;
+
+                    while (_index != cNil)
+                    {
+                        const uint32_t cNext = mNodes[_index].Next;
+                        expired.push_back(_index);
+                        _index = cNext;
+                    }
+                }
+            }
+
+            uint64_t TimerWheel::getNextTick() const noexcept
+            {
+                // Either the next non-empty slot of the lowest level or the next cascade tick
+                uint64_t _result = mCurrentTick + 1;
+                while ((_result & cSlotMask) != 0 && mSlots[_result & cSlotMask] == cNil)
+                {
+                    ++_result;
+                }
+
+                return _result;
+            }
+
+            void TimerWheel::run()
+            {
+                std::vector<uint32_t> _expired;
+                std::vector<TimerId> _due;
+                std::unique_lock<std::mutex> _lock(mMutex);
+
+                while (mRunning)
+                {
+                    const uint64_t cNow = getTick(Clock::now());
+
+                    if (mPending == 0)
+                    {
+                        // Nothing to turn, so skip the idle ticks at once.
+                        mCurrentTick = std::max(mCurrentTick, cNow);
+                        mConditionVariable.wait(_lock);
+                    }
+                    else if (cNow > mCurrentTick)
+                    {
+                        _expired.clear();
+                        advance(cNow, _expired);
+
+                        // Hand the expired timers over one by one, so each of them can still be cancelled
+                        // until its callback is invoked.
+                        _due.clear();
+                        for (uint32_t _index : _expired)
+                        {
+                            mNodes[_index].Slot = cNil;
+                            _due.push_back(getId(_index, mNodes[_index].Generation));
+                        }
+
+                        for (std::size_t i = 0; i < _due.size() && mRunning; ++i)
+                        {
+                            const TimerId cTimer = _due[i];
+                            const uint32_t cIndex = _expired[i];
+                            Node &_node = mNodes[cIndex];
+                            if (getId(cIndex, _node.Generation) != cTimer)
+                            {
+                                // Cancelled while the previous callbacks were invoked
+                                continue;
+                            }
+
+                            std::function<void()> _callback{std::move(_node.Callback)};
+                            release(cIndex);
+                            --mPending;
+
+                            mFiringTimer = cTimer;
+                            _lock.unlock();
+                            _callback();
+                            _lock.lock();
+                            mFiringTimer = cInvalidTimer;
+                            mFiredConditionVariable.notify_all();
+                        }
+                    }
+                    else
+                    {
+                        const Clock::time_point cWakeUpTime{mStart + getNextTick() * mTick};
+                        mConditionVariable.wait_until(_lock, cWakeUpTime);
+                    }
+                }
+            }
+
+            TimerWheel::TimerId TimerWheel::Schedule(
+                std::chrono::milliseconds delay, std::function<void()> callback)
+            {
+                const Clock::time_point cNow{Clock::now()};
+                // Round up, so a timer never fires earlier than its delay.
+                const uint64_t cExpiry =
+                    (cNow - mStart + delay + mTick - Clock::duration(1)) / mTick;
+
+                TimerId _result;
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    if (mPending == 0)
+                    {
+                        // The idle wheel thread has not turned meanwhile, so skip the idle ticks at once.
+                        mCurrentTick = std::max(mCurrentTick, getTick(cNow));
+                    }
+
+                    const uint32_t cIndex = allocate();
+                    Node &_node = mNodes[cIndex];
+                    _node.Expiry = std::max(cExpiry, mCurrentTick + 1);
+                    _node.Callback = std::move(callback);
+                    link(cIndex);
+                    ++mPending;
+
+                    _result = getId(cIndex, _node.Generation);
+                }
+
+                // The wheel thread may sleep longer than the new timer delay.
+                mConditionVariable.notify_one();
+
+                return _result;
+            }
+
+            bool TimerWheel::Cancel(TimerId timer)
+            {
+                const uint32_t cGenerationShift = 32;
+                const uint32_t cIndex = static_cast<uint32_t>(timer);
+                const uint32_t cGeneration = static_cast<uint32_t>(timer >> cGenerationShift);
+
+                std::unique_lock<std::mutex> _lock(mMutex);
+
+                if (cIndex < mNodes.size() &&
+                    mNodes[cIndex].Generation == cGeneration &&
+                    mNodes[cIndex].Callback != nullptr)
+                {
+                    // An expired timer waiting for its turn is already detached from the wheel.
+                    if (mNodes[cIndex].Slot != cNil)
+                    {
+                        unlink(cIndex);
+                    }
+
+                    release(cIndex);
+                    --mPending;
+
+                    return true;
+                }
+
+                if (timer != cInvalidTimer && std::this_thread::get_id() != mThread.get_id())
+                {
+                    mFiredConditionVariable.wait(
+                        _lock, [this, timer]()
+                        { return mFiringTimer != timer; });
+                }
+
+                return false;
+            }
+
+            std::size_t TimerWheel::Pending()
+            {
+                std::lock_guard<std::mutex> _lock(mMutex);
+                return mPending;
+            }
+
+            TimerWheel::~TimerWheel()
+            {
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    mRunning = false;
+                }
+
+                mConditionVariable.notify_one();
+                mThread.join();
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Hierarchical timing wheel which drives many one-shot timers from a single thread
+            /// @details The timers are hashed by their expiration tick into four levels of 64 slots,
+            /// and each slot is an intrusive doubly-linked list over a node pool. Scheduling and cancelling
+            /// are O(1), and a timer of an upper level is cascaded to the lower levels as the wheel turns.
+            /// The wheel thread sleeps until the next non-empty slot or cascade, and indefinitely if no
+            /// timer is pending. The callbacks are invoked from the wheel thread in the expiration order.
+            class TimerWheel
+            {
+            public:
+                /// @brief Timer handle type
+                using TimerId = uint64_t;
+
+            private:
+                using Clock = std::chrono::steady_clock;
+
+                static const uint32_t cNil = 0xffffffff;
+                static const std::size_t cLevelCount = 4;
+                static const uint32_t cSlotBitLength = 6;
+                static const uint32_t cSlotCount = 1 << cSlotBitLength;
+                static const uint64_t cSlotMask = cSlotCount - 1;
+                static const uint64_t cMaxTicks = (1ULL << (cSlotBitLength * cLevelCount)) - 1;
+
+                struct Node
+                {
+                    uint64_t Expiry;
+                    uint32_t Generation;
+                    uint32_t Previous;
+                    uint32_t Next;
+                    uint32_t Slot;
+                    std::function<void()> Callback;
+                };
+
+                const Clock::duration mTick;
+                const Clock::time_point mStart;
+                std::vector<Node> mNodes;
+                std::array<uint32_t, cLevelCount * cSlotCount> mSlots;
+                uint32_t mFreeNode;
+                std::size_t mPending;
+                uint64_t mCurrentTick;
+                TimerId mFiringTimer;
+                std::mutex mMutex;
+                std::condition_variable mConditionVariable;
+                std::condition_variable mFiredConditionVariable;
+                bool mRunning;
+                std::thread mThread;
+
+                static TimerId getId(uint32_t index, uint32_t generation) noexcept;
+                uint64_t getTick(Clock::time_point time) const noexcept;
+                uint32_t allocate();
+                void release(uint32_t index) noexcept;
+                void link(uint32_t index) noexcept;
+                void unlink(uint32_t index) noexcept;
+                void cascade(std::size_t level) noexcept;
+                void advance(uint64_t tick, std::vector<uint32_t> &expired) noexcept;
+                uint64_t getNextTick() const noexcept;
+                void run();
+
+            public:
+                /// @brief Invalid timer handle which is never returned by scheduling
+                static const TimerId cInvalidTimer = 0;
+
+                /// @brief Default wheel tick resolution
+                static constexpr std::chrono::milliseconds cDefaultTick{1};
+
+                /// @brief Constructor
+                /// @param tick Tick resolution which rounds up the timer delays
+                /// @throws std::invalid_argument Throws if the tick is not positive
+                explicit TimerWheel(std::chrono::milliseconds tick = cDefaultTick);
+
+                TimerWheel(const TimerWheel &) = delete;
+                TimerWheel &operator=(const TimerWheel &) = delete;
+
+                ~TimerWheel();
+
+                /// @brief Get the process-wide wheel shared by all the timers of the communication stack
+                /// @returns Shared wheel with the default tick resolution
+                static TimerWheel &Shared();
+
+                /// @brief Schedule a one-shot timer
+                /// @param delay Delay after which the callback is invoked
+                /// @param callback Callback to be invoked from the wheel thread
+                /// @returns Handle to cancel the timer
+                /// @note A delay beyond the wheel span (i.e., about 4.6 hours at the default tick)
+                /// is served by re-cascading the timer from the top level.
+                TimerId Schedule(std::chrono::milliseconds delay, std::function<void()> callback);
+
+                /// @brief Cancel a pending timer
+                /// @param timer Timer handle
+                /// @returns True if the timer is cancelled before expiration; otherwise false
+                /// @note Out of the wheel thread, the function returns after the on-going invocation of
+                /// the timer callback has been finished, so the callback resources can be released afterwards.
+                bool Cancel(TimerId timer);
+
+                /// @brief Get the number of the pending timers
+                /// @returns Number of the scheduled timers which are neither expired nor cancelled
+                std::size_t Pending();
+            };
+        }
+    }
+}
+
+#endif
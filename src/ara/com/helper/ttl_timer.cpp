@@ -7,23 +7,36 @@ namespace ara
     {
         namespace helper
         {
-            TtlTimer::TtlTimer() noexcept : mLock(mMutex, std::defer_lock),
-                                            mRequested{false},
+            TtlTimer::TtlTimer() noexcept : mRequested{false},
                                             mDisposing{false},
-                                            mTtl{0}
+                                            mTtl{0},
+                                            mGeneration{0},
+                                            mTimer{TimerWheel::cInvalidTimer}
             {
             }
 
+            void TtlTimer::SetHandler(std::function<void()> handler)
+            {
+                mHandler = std::move(handler);
+            }
+
+            void TtlTimer::signal()
+            {
+                if (mHandler)
+                {
+                    mHandler();
+                }
+            }
+
             bool TtlTimer::GetRequested() const noexcept
             {
                 return mRequested;
             }
 
-            void TtlTimer::SetRequested(bool requested) noexcept
+            void TtlTimer::SetRequested(bool requested)
             {
                 mRequested = requested;
-                mSignalFlag = true;
-                mConditionVariable.notify_one();
+                signal();
             }
 
             bool TtlTimer::GetOffered() const noexcept
@@ -31,67 +44,67 @@ namespace ara
                 return mTtl > 0;
             }
 
-            void TtlTimer::SetOffered(uint32_t ttl) noexcept
-            {
-                mTtl = ttl;
-                mSignalFlag = true;
-                mConditionVariable.notify_one();
-            }
-
-            void TtlTimer::WaitForSignal()
+            void TtlTimer::SetOffered(uint32_t ttl)
             {
-                // If disposing, return immediately
-                if (mDisposing)
+                TimerWheel::TimerId _expiredTimer;
                 {
-                    return;
-                }
-                else
-                {
-                    mLock.lock();
-                    mConditionVariable.wait(mLock, [this]{ return mSignalFlag.load(); });
-                    mSignalFlag = false;
-                    mLock.unlock();
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    // The generation invalidates the expiration of the previous offer if it is already firing.
+                    ++mGeneration;
+                    _expiredTimer = mTimer;
+                    mTimer = TimerWheel::cInvalidTimer;
+                    mTtl = ttl;
+
+                    if (ttl > 0 && !mDisposing)
+                    {
+                        const std::chrono::seconds cTtl{ttl};
+                        mTimer =
+                            TimerWheel::Shared().Schedule(
+                                cTtl,
+                                std::bind(&TtlTimer::onExpired, this, mGeneration));
+                    }
                 }
+
+                TimerWheel::Shared().Cancel(_expiredTimer);
+                signal();
             }
 
-            bool TtlTimer::WaitForExpiration()
+            void TtlTimer::onExpired(uint64_t generation)
             {
-                // If disposing, return timeout immediately
-                if (mTtl == 0 || mDisposing)
                 {
-                    return true;
-                }
-                else
-                {
-                    mLock.lock();
-                    std::cv_status _status =
-                        mConditionVariable.wait_for(
-                            mLock, std::chrono::seconds(mTtl));
-                    mSignalFlag = false;
-                    mLock.unlock();
-
-                    // Due to the TTL delay above, re-check the TTL and disposing values
-                    if (_status == std::cv_status::timeout || mTtl == 0 || mDisposing)
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    if (generation != mGeneration)
                     {
-                        return true;
-                    }
-                    else
-                    {
-                        return false;
+                        // The offer has been renewed or withdrawn meanwhile.
+                        return;
                     }
+
+                    mTimer = TimerWheel::cInvalidTimer;
+                    mTtl = 0;
                 }
+
+                signal();
             }
 
-            void TtlTimer::Dispose() noexcept
+            void TtlTimer::Dispose()
             {
-                mDisposing = true;
+                TimerWheel::TimerId _timer;
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    mDisposing = true;
+                    ++mGeneration;
+                    _timer = mTimer;
+                    mTimer = TimerWheel::cInvalidTimer;
+                }
+
+                TimerWheel::Shared().Cancel(_timer);
             }
 
             TtlTimer::~TtlTimer() noexcept
             {
                 Dispose();
-                mConditionVariable.notify_one();
             }
         }
     }
-}
\ No newline at end of file
+}
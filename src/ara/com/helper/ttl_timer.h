@@ -1,9 +1,11 @@
 #ifndef TTL_TIMER_H
 #define TTL_TIMER_H
 
-#include <mutex>
-#include <condition_variable>
+#include <stdint.h>
 #include <atomic>
+#include <functional>
+#include <mutex>
+#include "./timer_wheel.h"
 
 namespace ara
 {
@@ -12,17 +14,22 @@ namespace ara
         namespace helper
         {
             /// @brief Time To Live countdown timer
+            /// @details The offer TTL is a one-shot timer of the shared timer wheel which is re-armed by each offer.
+            /// Instead of blocking a thread, the timer signals a handler on every status change and on the TTL expiration.
             /// @note The timer is not copyable.
             class TtlTimer
             {
             private:
                 std::mutex mMutex;
-                std::unique_lock<std::mutex> mLock;
-                std::condition_variable mConditionVariable;
-                bool mRequested;
-                bool mDisposing;
-                std::atomic_bool mSignalFlag;
-                uint32_t mTtl;
+                std::atomic_bool mRequested;
+                std::atomic_bool mDisposing;
+                std::atomic<uint32_t> mTtl;
+                uint64_t mGeneration;
+                TimerWheel::TimerId mTimer;
+                std::function<void()> mHandler;
+
+                void signal();
+                void onExpired(uint64_t generation);
 
             public:
                 TtlTimer() noexcept;
@@ -30,6 +37,11 @@ namespace ara
                 TtlTimer &operator=(const TtlTimer &) = delete;
                 ~TtlTimer() noexcept;
 
+                /// @brief Set the signal handler
+                /// @param handler Handler to be invoked on a signal from SetRequested, SetOffered or the TTL expiration
+                /// @note The handler should be set before the timer is used from the other threads.
+                void SetHandler(std::function<void()> handler);
+
                 /// @brief Indicate whether the service client is requested or not
                 /// @returns True if the service client is requested, otherwise false
                 /// @see SetRequested
@@ -38,7 +50,7 @@ namespace ara
                 /// @brief Set the service requested status
                 /// @param requested Service client requested status
                 /// @see GetRequested
-                void SetRequested(bool requested) noexcept;
+                void SetRequested(bool requested);
 
                 /// @brief Indicate whether the service server is offered or not
                 /// @returns True if the service server is offered, otherwise false
@@ -48,24 +60,15 @@ namespace ara
                 /// @brief Set the service offered status
                 /// @param ttl Received service offer entry TTL
                 /// @see GetOffered
-                /// @note Zero TTL indicates stop offering.
-                void SetOffered(uint32_t ttl) noexcept;
-
-                /// @brief Wait for a signal from SetRequested or SetOffered
-                /// @see SetRequested(bool)
-                /// @see SetOffered(uint32_t)
-                void WaitForSignal();
-
-                /// @brief Wait for the timer to expire or reset
-                /// @returns True if the TTL is expired, otherwise false in case of timer reset
-                bool WaitForExpiration();
+                /// @note Zero TTL indicates stop offering. The offer is withdrawn if it is not renewed within the TTL.
+                void SetOffered(uint32_t ttl);
 
-                /// @brief Dispose the timer which causes all the waitings return immediately
+                /// @brief Dispose the timer which cancels the pending TTL expiration
                 /// @remarks The side effect of this function call is irreversible.
-                void Dispose() noexcept;
+                void Dispose();
             };
         }
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,116 @@
+#ifndef UDP_NETWORK_LAYER_H
+#define UDP_NETWORK_LAYER_H
+
+#include <atomic>
+#include <stdexcept>
+#include "./network_layer.h"
+#include "./epoll_poller.h"
+#include "./udp_socket.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief UDP network communication layer
+            /// @tparam T Message type
+            /// @details The layer socket is served by an epoll poller. On each readiness all the pending datagrams
+            /// are drained via batched receives and dispatched in place from the socket receive buffers.
+            template <typename T>
+            class UdpNetworkLayer : public NetworkLayer<T>
+            {
+            private:
+                EpollPoller *const mPoller;
+                UdpSocket mSocket;
+                std::atomic_size_t mFailedSends;
+
+                void onReceive()
+                {
+                    mSocket.Receive(
+                        [this](const uint8_t *data, std::size_t size)
+                        {
+                            this->FireReceiverCallbacks(data, size);
+                        });
+                }
+
+            public:
+                UdpNetworkLayer() = delete;
+                UdpNetworkLayer(const UdpNetworkLayer &) = delete;
+                UdpNetworkLayer &operator=(const UdpNetworkLayer &) = delete;
+
+                /// @brief Constructor
+                /// @param poller Poller whose polling thread serves the layer receptions
+                /// @param localIpAddress Local interface IP address to bind to
+                /// @param localPort Local UDP port number to bind to
+                /// @param remoteIpAddress Remote unicast or multicast IP address to send to
+                /// @param remotePort Remote UDP port number to send to
+                /// @throws std::runtime_error Throws if the socket cannot be set up or added to the poller
+                UdpNetworkLayer(
+                    EpollPoller *poller,
+                    Ipv4Address localIpAddress,
+                    uint16_t localPort,
+                    Ipv4Address remoteIpAddress,
+                    uint16_t remotePort) : mPoller{poller},
+                                           mSocket(localIpAddress, localPort, remoteIpAddress, remotePort),
+                                           mFailedSends{0}
+                {
+                    bool _successful =
+                        mPoller->TryAddReceiver(
+                            mSocket.FileDescriptor(),
+                            std::bind(&UdpNetworkLayer::onReceive, this));
+
+                    if (!_successful)
+                    {
+                        throw std::runtime_error("Adding the socket to the poller failed.");
+                    }
+                }
+
+                ~UdpNetworkLayer() noexcept override
+                {
+                    mPoller->TryRemoveReceiver(mSocket.FileDescriptor());
+                }
+
+                void Send(const T &message) override
+                {
+                    SendPayload(message.Payload());
+                }
+
+                void SendPayload(const std::vector<uint8_t> &payload) override
+                {
+                    if (!mSocket.Send(payload.data(), payload.size()))
+                    {
+                        ++mFailedSends;
+                    }
+                }
+
+                /// @brief Send already serialized messages in batches
+                /// @param payloads Serialized message payloads to be sent in order
+                /// @returns Number of the sent payloads
+                std::size_t SendPayloads(const std::vector<std::vector<uint8_t>> &payloads)
+                {
+                    std::size_t _result = mSocket.Send(payloads);
+                    mFailedSends += payloads.size() - _result;
+
+                    return _result;
+                }
+
+                /// @brief Get the number of the payloads that could not be sent
+                /// @returns Number of the failed sends
+                std::size_t FailedSends() const noexcept
+                {
+                    return mFailedSends;
+                }
+
+                /// @brief Get the number of the dropped truncated datagrams
+                /// @returns Number of the received datagrams that exceeded the maximum datagram size
+                std::size_t TruncatedDatagrams() const noexcept
+                {
+                    return mSocket.TruncatedDatagrams();
+                }
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,275 @@
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include "./udp_socket.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const std::size_t UdpSocket::cBatchSize;
+            const std::size_t UdpSocket::cMaxDatagramSize;
+
+            UdpSocket::UdpSocket(
+                Ipv4Address localIpAddress,
+                uint16_t localPort,
+                Ipv4Address remoteIpAddress,
+                uint16_t remotePort) : mFileDescriptor{socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP)},
+                                       mRemoteAddress(getAddress(remoteIpAddress, remotePort)),
+                                       mReceiveBuffers(cBatchSize * cMaxDatagramSize),
+                                       mTruncatedDatagrams{0},
+                                       mFailedDatagrams{0}
+            {
+                if (mFileDescriptor < 0)
+                {
+                    throw std::runtime_error(std::strerror(errno));
+                }
+
+                const int cEnabled = 1;
+                sockaddr_in _localAddress{getAddress(localIpAddress, localPort)};
+
+                if (isMulticast(remoteIpAddress))
+                {
+                    // Let the other local agents share the group port.
+                    setOption(SOL_SOCKET, SO_REUSEADDR, &cEnabled, sizeof(cEnabled));
+                    // Bind to the wildcard address, otherwise the group datagrams are filtered out.
+                    _localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+
+                    ip_mreq _membership;
+                    _membership.imr_multiaddr = mRemoteAddress.sin_addr;
+                    _membership.imr_interface = getAddress(localIpAddress, localPort).sin_addr;
+                    setOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, &_membership, sizeof(_membership));
+                    setOption(IPPROTO_IP, IP_MULTICAST_IF, &_membership.imr_interface, sizeof(in_addr));
+                    setOption(IPPROTO_IP, IP_MULTICAST_LOOP, &cEnabled, sizeof(cEnabled));
+                }
+
+                if (bind(
+                        mFileDescriptor,
+                        reinterpret_cast<const sockaddr *>(&_localAddress),
+                        sizeof(_localAddress)) < 0)
+                {
+                    throwError();
+                }
+
+                for (std::size_t i = 0; i < cBatchSize; ++i)
+                {
+                    mReceiveVectors[i].iov_base = mReceiveBuffers.data() + i * cMaxDatagramSize;
+                    mReceiveVectors[i].iov_len = cMaxDatagramSize;
+
+                    std::memset(&mReceiveHeaders[i], 0, sizeof(mmsghdr));
+                    mReceiveHeaders[i].msg_hdr.msg_iov = &mReceiveVectors[i];
+                    mReceiveHeaders[i].msg_hdr.msg_iovlen = 1;
+                }
+            }
+
+            sockaddr_in UdpSocket::getAddress(Ipv4Address ipAddress, uint16_t port) noexcept
+            {
+                sockaddr_in _result;
+                std::memset(&_result, 0, sizeof(_result));
+                _result.sin_family = AF_INET;
+                _result.sin_port = htons(port);
+                // The octets are already in the network byte order.
+                std::memcpy(&_result.sin_addr.s_addr, ipAddress.Octets.data(), ipAddress.Octets.size());
+
+                return _result;
+            }
+
+            bool UdpSocket::isMulticast(Ipv4Address ipAddress) noexcept
+            {
+                // Class D addresses: 224.0.0.0 to 239.255.255.255
+                const uint8_t cMulticastPrefix = 0xe0;
+                const uint8_t cMulticastMask = 0xf0;
+
+                return (ipAddress.Octets[0] & cMulticastMask) == cMulticastPrefix;
+            }
+
+            void UdpSocket::throwError()
+            {
+                std::runtime_error _exception(std::strerror(errno));
+                close(mFileDescriptor);
+                throw _exception;
+            }
+
+            void UdpSocket::setOption(int level, int name, const void *value, socklen_t length)
+            {
+                if (setsockopt(mFileDescriptor, level, name, value, length) < 0)
+                {
+                    throwError();
+                }
+            }
+
+            int UdpSocket::receiveBatch() noexcept
+            {
+                int _result;
+
+                do
+                {
+                    _result =
+                        recvmmsg(
+                            mFileDescriptor,
+                            mReceiveHeaders.data(),
+                            static_cast<unsigned int>(cBatchSize),
+                            MSG_DONTWAIT,
+                            nullptr);
+                } while (_result < 0 && errno == EINTR);
+
+                return _result;
+            }
+
+            int UdpSocket::FileDescriptor() const noexcept
+            {
+                return mFileDescriptor;
+            }
+
+            std::size_t UdpSocket::TruncatedDatagrams() const noexcept
+            {
+                return mTruncatedDatagrams;
+            }
+
+            std::size_t UdpSocket::FailedDatagrams() const noexcept
+            {
+                return mFailedDatagrams;
+            }
+
+            bool UdpSocket::Send(const uint8_t *data, std::size_t size) noexcept
+            {
+                ssize_t _sentBytes;
+
+                do
+                {
+                    _sentBytes =
+                        sendto(
+                            mFileDescriptor,
+                            data,
+                            size,
+                            0,
+                            reinterpret_cast<const sockaddr *>(&mRemoteAddress),
+                            sizeof(mRemoteAddress));
+                } while (_sentBytes < 0 && errno == EINTR);
+
+                return _sentBytes == static_cast<ssize_t>(size);
+            }
+
+            std::size_t UdpSocket::Send(const std::vector<std::vector<uint8_t>> &payloads) noexcept
+            {
+                std::array<iovec, cBatchSize> _vectors;
+                std::array<mmsghdr, cBatchSize> _headers;
+                std::size_t _result = 0;
+
+                while (_result < payloads.size())
+                {
+                    std::size_t _batchSize = payloads.size() - _result;
+                    if (_batchSize > cBatchSize)
+                    {
+                        _batchSize = cBatchSize;
+                    }
+
+                    for (std::size_t i = 0; i < _batchSize; ++i)
+                    {
+                        const std::vector<uint8_t> &_payload = payloads[_result + i];
+                        // sendmmsg does not modify the sent bytes.
+                        _vectors[i].iov_base = const_cast<uint8_t *>(_payload.data());
+                        _vectors[i].iov_len = _payload.size();
+
+                        std::memset(&_headers[i], 0, sizeof(mmsghdr));
+                        _headers[i].msg_hdr.msg_name = &mRemoteAddress;
+                        _headers[i].msg_hdr.msg_namelen = sizeof(mRemoteAddress);
+                        _headers[i].msg_hdr.msg_iov = &_vectors[i];
+                        _headers[i].msg_hdr.msg_iovlen = 1;
+                    }
+
+                    int _sentDatagrams =
+                        sendmmsg(
+                            mFileDescriptor,
+                            _headers.data(),
+                            static_cast<unsigned int>(_batchSize),
+                            0);
+
+                    if (_sentDatagrams < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        else
+                        {
+                            break;
+                        }
+                    }
+
+                    _result += static_cast<std::size_t>(_sentDatagrams);
+                }
+
+                return _result;
+            }
+
+            std::size_t UdpSocket::SendTo(
+                const uint8_t *data,
+                std::size_t size,
+                const std::vector<DatagramEndpoint> &endpoints) noexcept
+            {
+                // sendmmsg does not modify the sent bytes.
+                iovec _vector{const_cast<uint8_t *>(data), size};
+                std::array<sockaddr_in, cBatchSize> _addresses;
+                std::array<mmsghdr, cBatchSize> _headers;
+                std::size_t _index = 0;
+                std::size_t _result = 0;
+
+                while (_index < endpoints.size())
+                {
+                    std::size_t _batchSize = endpoints.size() - _index;
+                    if (_batchSize > cBatchSize)
+                    {
+                        _batchSize = cBatchSize;
+                    }
+
+                    for (std::size_t i = 0; i < _batchSize; ++i)
+                    {
+                        const DatagramEndpoint &_endpoint = endpoints[_index + i];
+                        _addresses[i] = getAddress(_endpoint.Address, _endpoint.Port);
+
+                        std::memset(&_headers[i], 0, sizeof(mmsghdr));
+                        _headers[i].msg_hdr.msg_name = &_addresses[i];
+                        _headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                        _headers[i].msg_hdr.msg_iov = &_vector;
+                        _headers[i].msg_hdr.msg_iovlen = 1;
+                    }
+
+                    int _sentDatagrams =
+                        sendmmsg(
+                            mFileDescriptor,
+                            _headers.data(),
+                            static_cast<unsigned int>(_batchSize),
+                            0);
+
+                    if (_sentDatagrams < 0)
+                    {
+                        if (errno != EINTR)
+                        {
+                            // The batch head is the failing destination, so skip it
+                            // and carry on with the rest of the destinations.
+                            ++mFailedDatagrams;
+                            ++_index;
+                        }
+
+                        continue;
+                    }
+
+                    _index += static_cast<std::size_t>(_sentDatagrams);
+                    _result += static_cast<std::size_t>(_sentDatagrams);
+                }
+
+                return _result;
+            }
+
+            UdpSocket::~UdpSocket() noexcept
+            {
+                close(mFileDescriptor);
+            }
+        }
+    }
+}
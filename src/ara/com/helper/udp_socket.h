@@ -0,0 +1,143 @@
+#ifndef UDP_SOCKET_H
+#define UDP_SOCKET_H
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "./datagram_sender.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief UDP socket with batched datagram I/O
+            /// @details Datagrams are moved in batches via recvmmsg/sendmmsg, so a single system call carries
+            /// up to a whole batch. The received datagrams land in a ring of buffers that is allocated once
+            /// at construction and reused for every batch.
+            /// @note A multicast remote address makes the socket join the group on the local interface.
+            class UdpSocket : public DatagramSender
+            {
+            public:
+                /// @brief Maximum number of datagrams per system call
+                static const std::size_t cBatchSize = 64;
+
+                /// @brief Maximum received datagram size (Ethernet MTU minus the IPv4 and UDP headers)
+                static const std::size_t cMaxDatagramSize = 1472;
+
+            private:
+                int mFileDescriptor;
+                sockaddr_in mRemoteAddress;
+                std::vector<uint8_t> mReceiveBuffers;
+                std::array<iovec, cBatchSize> mReceiveVectors;
+                std::array<mmsghdr, cBatchSize> mReceiveHeaders;
+                std::atomic_size_t mTruncatedDatagrams;
+                std::atomic_size_t mFailedDatagrams;
+
+                static sockaddr_in getAddress(Ipv4Address ipAddress, uint16_t port) noexcept;
+                static bool isMulticast(Ipv4Address ipAddress) noexcept;
+                void throwError();
+                void setOption(int level, int name, const void *value, socklen_t length);
+                int receiveBatch() noexcept;
+
+            public:
+                UdpSocket() = delete;
+                UdpSocket(const UdpSocket &) = delete;
+                UdpSocket &operator=(const UdpSocket &) = delete;
+
+                /// @brief Constructor
+                /// @param localIpAddress Local interface IP address to bind to
+                /// @param localPort Local UDP port number to bind to
+                /// @param remoteIpAddress Remote unicast or multicast IP address to send to
+                /// @param remotePort Remote UDP port number to send to
+                /// @throws std::runtime_error Throws if the socket cannot be created, configured, or bound
+                UdpSocket(
+                    Ipv4Address localIpAddress,
+                    uint16_t localPort,
+                    Ipv4Address remoteIpAddress,
+                    uint16_t remotePort);
+
+                ~UdpSocket() noexcept override;
+
+                /// @brief Get the socket descriptor
+                /// @returns Descriptor to be watched by a poller
+                int FileDescriptor() const noexcept;
+
+                /// @brief Get the number of the dropped truncated datagrams
+                /// @returns Number of the received datagrams that did not fit in a receive buffer
+                std::size_t TruncatedDatagrams() const noexcept;
+
+                /// @brief Get the number of the datagrams that could not be sent to a destination
+                /// @returns Number of the destinations skipped by the multi-destination sending
+                std::size_t FailedDatagrams() const noexcept;
+
+                /// @brief Send a datagram to the remote endpoint
+                /// @param data Pointer to the first byte of the datagram
+                /// @param size Datagram size in bytes
+                /// @returns True if the datagram is sent; otherwise false
+                bool Send(const uint8_t *data, std::size_t size) noexcept;
+
+                /// @brief Send datagrams to the remote endpoint in batches
+                /// @param payloads Datagrams to be sent in order
+                /// @returns Number of the sent datagrams which stops short at the first failure
+                std::size_t Send(const std::vector<std::vector<uint8_t>> &payloads) noexcept;
+
+                /// @note The datagram is sent to the destinations in batches, and all the headers of a batch
+                /// share the same datagram bytes. A destination that the datagram cannot be sent to
+                /// is skipped and counted as a failed datagram, so it does not hold back the rest.
+                std::size_t SendTo(
+                    const uint8_t *data,
+                    std::size_t size,
+                    const std::vector<DatagramEndpoint> &endpoints) noexcept override;
+
+                /// @brief Receive all the pending datagrams without blocking
+                /// @tparam F Callback type invocable with a datagram byte pointer and size
+                /// @param callback Callback to be invoked per received datagram
+                /// @returns Number of the received datagrams including the dropped truncated ones
+                /// @warning The datagram bytes are only valid within the callback invocation,
+                /// and the function must be called from one thread at a time.
+                template <typename F>
+                std::size_t Receive(F &&callback)
+                {
+                    std::size_t _result = 0;
+                    int _receivedDatagrams;
+
+                    do
+                    {
+                        _receivedDatagrams = receiveBatch();
+
+                        for (int i = 0; i < _receivedDatagrams; ++i)
+                        {
+                            const msghdr &_header = mReceiveHeaders[i].msg_hdr;
+                            if (_header.msg_flags & MSG_TRUNC)
+                            {
+                                ++mTruncatedDatagrams;
+                            }
+                            else
+                            {
+                                const auto *_data =
+                                    static_cast<const uint8_t *>(_header.msg_iov->iov_base);
+                                callback(_data, static_cast<std::size_t>(mReceiveHeaders[i].msg_len));
+                            }
+                        }
+
+                        if (_receivedDatagrams > 0)
+                        {
+                            _result += static_cast<std::size_t>(_receivedDatagrams);
+                        }
+                        // A full batch may mean more datagrams are still pending.
+                    } while (_receivedDatagrams == static_cast<int>(cBatchSize));
+
+                    return _result;
+                }
+            };
+        }
+    }
+}
+
+#endif
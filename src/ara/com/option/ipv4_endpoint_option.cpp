@@ -1,4 +1,5 @@
 #include "./ipv4_endpoint_option.h"
+#include "../helper/object_pool.h"
 
 namespace ara
 {
@@ -8,7 +9,6 @@ namespace ara
         {
             uint16_t Ipv4EndpointOption::Length() const noexcept
             {
-                const uint8_t cOptionLength = 9;
                 return cOptionLength;
             }
 
@@ -27,21 +27,21 @@ namespace ara
                 return mPort;
             }
 
-            std::vector<uint8_t> Ipv4EndpointOption::Payload() const
+            std::size_t Ipv4EndpointOption::SerializeTo(uint8_t *dst, std::size_t cap) const
             {
-                auto _result = Option::BasePayload();
+                std::size_t _offset = Option::BaseSerializeTo(dst, cap);
 
-                helper::Ipv4Address::Inject(_result, mIpAddress);
+                helper::Ipv4Address::Inject(dst, _offset, mIpAddress);
 
                 const uint8_t cReservedByte = 0x00;
-                _result.push_back(cReservedByte);
+                dst[_offset++] = cReservedByte;
 
                 uint8_t _protocolByte = static_cast<uint8_t>(mL4Proto);
-                _result.push_back(_protocolByte);
+                dst[_offset++] = _protocolByte;
 
-                helper::Inject(_result, mPort);
+                helper::Inject(dst, _offset, mPort);
 
-                return _result;
+                return _offset;
             }
 
             std::unique_ptr<Ipv4EndpointOption> Ipv4EndpointOption::CreateUnitcastEndpoint(
@@ -61,17 +61,25 @@ namespace ara
                 return _result;
             }
 
-            std::unique_ptr<Ipv4EndpointOption> Ipv4EndpointOption::CreateMulticastEndpoint(
-                bool discardable,
-                helper::Ipv4Address ipAddress,
-                uint16_t port)
+            bool Ipv4EndpointOption::isMulticast(helper::Ipv4Address ipAddress) noexcept
             {
                 const uint8_t cMulticastOctetMin = 224;
                 const uint8_t cMulticastOctetMax = 239;
 
                 uint8_t _firstOctet = ipAddress.Octets[0];
-                if ((_firstOctet < cMulticastOctetMin) ||
-                    (_firstOctet > cMulticastOctetMax))
+                bool _result =
+                    (_firstOctet >= cMulticastOctetMin) &&
+                    (_firstOctet <= cMulticastOctetMax);
+
+                return _result;
+            }
+
+            std::unique_ptr<Ipv4EndpointOption> Ipv4EndpointOption::CreateMulticastEndpoint(
+                bool discardable,
+                helper::Ipv4Address ipAddress,
+                uint16_t port)
+            {
+                if (!isMulticast(ipAddress))
                 {
                     throw std::invalid_argument("IP address is out of range.");
                 }
@@ -103,42 +111,91 @@ namespace ara
                 return _result;
             }
 
-            std::unique_ptr<Ipv4EndpointOption> Ipv4EndpointOption::Deserialize(
-                const std::vector<uint8_t> &payload,
-                std::size_t &offset,
-                OptionType type,
-                bool discardable)
+            std::unique_ptr<Ipv4EndpointOption> Ipv4EndpointOption::FromRecord(
+                const OptionRecord &record)
             {
-                helper::Ipv4Address _ipAddress =
-                    helper::Ipv4Address::Extract(payload, offset);
-
-                // Apply the reserved byte length field offset
-                offset++;
+                helper::Ipv4Address _ipAddress(
+                    record.Ipv4Endpoint.Octets[0],
+                    record.Ipv4Endpoint.Octets[1],
+                    record.Ipv4Endpoint.Octets[2],
+                    record.Ipv4Endpoint.Octets[3]);
 
-                auto _protocol =
-                    static_cast<Layer4ProtocolType>(payload.at(offset++));
-
-                uint16_t _port = helper::ExtractShort(payload, offset);
-
-                switch (type)
+                switch (record.Type)
                 {
                 case OptionType::IPv4Endpoint:
                     return CreateUnitcastEndpoint(
-                        discardable, _ipAddress, _protocol, _port);
+                        record.Discardable,
+                        _ipAddress,
+                        record.Ipv4Endpoint.Protocol,
+                        record.Ipv4Endpoint.Port);
 
                 case OptionType::IPv4Multicast:
                     return CreateMulticastEndpoint(
-                        discardable, _ipAddress, _port);
+                        record.Discardable,
+                        _ipAddress,
+                        record.Ipv4Endpoint.Port);
 
                 case OptionType::IPv4SdEndpoint:
                     return CreateSdEndpoint(
-                        discardable, _ipAddress, _protocol, _port);
+                        record.Discardable,
+                        _ipAddress,
+                        record.Ipv4Endpoint.Protocol,
+                        record.Ipv4Endpoint.Port);
 
                 default:
                     throw std::out_of_range(
                         "The option type does not belong to IPv4 endpoint option series.");
                 }
             }
+
+            bool Ipv4EndpointOption::DeserializeRecord(
+                helper::ByteReader &reader,
+                OptionType type,
+                bool discardable,
+                OptionRecord &record) noexcept
+            {
+                helper::Ipv4Address _ipAddress =
+                    helper::Ipv4Address::Extract(reader);
+
+                // Apply the reserved byte length field offset
+                reader.ReadByte();
+
+                record.Type = type;
+                record.Discardable = discardable;
+                record.Ipv4Endpoint.Octets = _ipAddress.Octets;
+                record.Ipv4Endpoint.Protocol =
+                    static_cast<Layer4ProtocolType>(reader.ReadByte());
+                record.Ipv4Endpoint.Port = reader.ReadShort();
+
+                if (type == OptionType::IPv4Multicast)
+                {
+                    return isMulticast(_ipAddress);
+                }
+                else
+                {
+                    return true;
+                }
+            }
+
+            OptionRecord Ipv4EndpointOption::Record() const noexcept
+            {
+                OptionRecord _result = Option::BaseRecord();
+                _result.Ipv4Endpoint.Octets = mIpAddress.Octets;
+                _result.Ipv4Endpoint.Protocol = mL4Proto;
+                _result.Ipv4Endpoint.Port = mPort;
+
+                return _result;
+            }
+
+            void *Ipv4EndpointOption::operator new(std::size_t size)
+            {
+                return helper::ObjectPool<Ipv4EndpointOption>::Instance().Allocate(size);
+            }
+
+            void Ipv4EndpointOption::operator delete(void *pointer, std::size_t size) noexcept
+            {
+                helper::ObjectPool<Ipv4EndpointOption>::Instance().Deallocate(pointer, size);
+            }
         }
     }
 }
\ No newline at end of file
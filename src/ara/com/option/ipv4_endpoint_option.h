@@ -23,6 +23,8 @@ namespace ara
                 Layer4ProtocolType mL4Proto;
                 uint16_t mPort;
 
+                static bool isMulticast(helper::Ipv4Address ipAddress) noexcept;
+
                 constexpr Ipv4EndpointOption(
                     OptionType type,
                     bool discardable,
@@ -36,6 +38,9 @@ namespace ara
                 }
 
             public:
+                /// @brief Serialized option length field value
+                static const uint16_t cOptionLength = 9;
+
                 Ipv4EndpointOption() = delete;
                 virtual uint16_t Length() const noexcept override;
 
@@ -51,7 +56,9 @@ namespace ara
                 /// @returns Network port number
                 uint16_t Port() const noexcept;
 
-                virtual std::vector<uint8_t> Payload() const override;
+                virtual std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const override;
+
+                virtual OptionRecord Record() const noexcept override;
 
                 /// @brief Unitcast endpoint factory
                 /// @param discardable Indicates whether the option can be discarded or not
@@ -87,18 +94,36 @@ namespace ara
                     Layer4ProtocolType protocol = cDefaultSdProtocol,
                     uint16_t port = cDefaultSdPort) noexcept;
 
-                /// @brief Deserialize an option payload
-                /// @param payload Serialized option payload byte array
-                /// @param offset Deserializing offset in the payload
+                /// @brief Instantiate an IPv4 endpoint option from its decoded record
+                /// @param record Decoded IPv4 endpoint option record
+                /// @returns IPv4 endpoint option
+                /// @throws std::out_of_range Throws when the option type is not an IPv4 endpoint
+                /// @throws std::invalid_argument Throws when the multicast address is out of range
+                static std::unique_ptr<Ipv4EndpointOption> FromRecord(
+                    const OptionRecord &record);
+
+                /// @brief Decode the IPv4 endpoint option specific fields into a plain value record
+                /// @param reader Byte reader positioned at the IP address field
                 /// @param type IPv4 endpoint option type
                 /// @param discardable Indicates whether the option can be discarded or not
-                /// @returns Deserialized option
-                /// @throws std::out_of_range Throws when the option type is not an IPv4 endpoint
-                static std::unique_ptr<Ipv4EndpointOption> Deserialize(
-                    const std::vector<uint8_t> &payload,
-                    std::size_t &offset,
+                /// @param[out] record Decoded option record
+                /// @returns True if the option is decoded; false if the multicast address is out of range
+                /// @warning The reader remaining length should have been validated for the whole option.
+                static bool DeserializeRecord(
+                    helper::ByteReader &reader,
                     OptionType type,
-                    bool discardable);
+                    bool discardable,
+                    OptionRecord &record) noexcept;
+
+                /// @brief Allocate an IPv4 endpoint option from the object pool
+                /// @param size Requested size in bytes
+                /// @returns Pointer to the allocated memory
+                static void *operator new(std::size_t size);
+
+                /// @brief Release an IPv4 endpoint option to the object pool
+                /// @param pointer Pointer to the allocated memory
+                /// @param size Requested size in bytes at the allocation
+                static void operator delete(void *pointer, std::size_t size) noexcept;
             };
         }
     }
@@ -1,4 +1,5 @@
 #include "./loadbalancing_option.h"
+#include "../helper/object_pool.h"
 
 namespace ara
 {
@@ -8,7 +9,6 @@ namespace ara
         {
             uint16_t LoadBalancingOption::Length() const noexcept
             {
-                const uint8_t cOptionLength = 5;
                 return cOptionLength;
             }
 
@@ -22,29 +22,65 @@ namespace ara
                 return mWeight;
             }
 
-            std::vector<uint8_t> LoadBalancingOption::Payload() const
+            std::size_t LoadBalancingOption::SerializeTo(uint8_t *dst, std::size_t cap) const
             {
-                auto _result = Option::BasePayload();
+                std::size_t _offset = Option::BaseSerializeTo(dst, cap);
 
-                helper::Inject(_result, mPriority);
-                helper::Inject(_result, mWeight);
+                helper::Inject(dst, _offset, mPriority);
+                helper::Inject(dst, _offset, mWeight);
 
-                return _result;
+                return _offset;
             }
 
-            std::unique_ptr<LoadBalancingOption> LoadBalancingOption::Deserialize(
-                const std::vector<uint8_t> &payload,
-                std::size_t &offset,
-                bool discardable)
+            std::unique_ptr<LoadBalancingOption> LoadBalancingOption::FromRecord(
+                const OptionRecord &record)
             {
-                uint16_t _priority = helper::ExtractShort(payload, offset);
-                uint16_t _weight = helper::ExtractShort(payload, offset);
+                if (record.Type != OptionType::LoadBalancing)
+                {
+                    throw std::out_of_range(
+                        "The option type is not load-balancing.");
+                }
+
                 auto _result =
                     std::make_unique<LoadBalancingOption>(
-                        discardable, _priority, _weight);
+                        record.Discardable,
+                        record.LoadBalancing.Priority,
+                        record.LoadBalancing.Weight);
+
+                return _result;
+            }
+
+            OptionRecord LoadBalancingOption::DeserializeRecord(
+                helper::ByteReader &reader,
+                bool discardable) noexcept
+            {
+                OptionRecord _result;
+                _result.Type = OptionType::LoadBalancing;
+                _result.Discardable = discardable;
+                _result.LoadBalancing.Priority = reader.ReadShort();
+                _result.LoadBalancing.Weight = reader.ReadShort();
+
+                return _result;
+            }
+
+            OptionRecord LoadBalancingOption::Record() const noexcept
+            {
+                OptionRecord _result = Option::BaseRecord();
+                _result.LoadBalancing.Priority = mPriority;
+                _result.LoadBalancing.Weight = mWeight;
 
                 return _result;
             }
+
+            void *LoadBalancingOption::operator new(std::size_t size)
+            {
+                return helper::ObjectPool<LoadBalancingOption>::Instance().Allocate(size);
+            }
+
+            void LoadBalancingOption::operator delete(void *pointer, std::size_t size) noexcept
+            {
+                helper::ObjectPool<LoadBalancingOption>::Instance().Deallocate(pointer, size);
+            }
         }
     }
 }
\ No newline at end of file
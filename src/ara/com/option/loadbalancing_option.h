@@ -18,6 +18,9 @@ namespace ara
                 uint16_t mWeight;
 
             public:
+                /// @brief Serialized option length field value
+                static const uint16_t cOptionLength = 5;
+
                 LoadBalancingOption() = delete;
 
                 /// @brief Constructor
@@ -43,17 +46,35 @@ namespace ara
                 /// @returns Servince instance random selection weight
                 uint16_t Weight() const noexcept;
 
-                virtual std::vector<uint8_t> Payload() const override;
+                virtual std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const override;
+
+                virtual OptionRecord Record() const noexcept override;
+
+                /// @brief Instantiate a load-balancing option from its decoded record
+                /// @param record Decoded load-balancing option record
+                /// @returns Load-balancing option
+                /// @throws std::out_of_range Throws when the option type is not load-balancing
+                static std::unique_ptr<LoadBalancingOption> FromRecord(
+                    const OptionRecord &record);
 
-                /// @brief Deserialize an option payload
-                /// @param payload Serialized option payload byte array
-                /// @param offset Deserializing offset in the payload
+                /// @brief Decode the load-balancing option specific fields into a plain value record
+                /// @param reader Byte reader positioned at the priority field
                 /// @param discardable Indicates whether the option can be discarded or not
-                /// @returns Deserialized option
-                static std::unique_ptr<LoadBalancingOption> Deserialize(
-                    const std::vector<uint8_t> &payload,
-                    std::size_t &offset,
-                    bool discardable);
+                /// @returns Decoded option record
+                /// @warning The reader remaining length should have been validated for the whole option.
+                static OptionRecord DeserializeRecord(
+                    helper::ByteReader &reader,
+                    bool discardable) noexcept;
+
+                /// @brief Allocate a load-balancing option from the object pool
+                /// @param size Requested size in bytes
+                /// @returns Pointer to the allocated memory
+                static void *operator new(std::size_t size);
+
+                /// @brief Release a load-balancing option to the object pool
+                /// @param pointer Pointer to the allocated memory
+                /// @param size Requested size in bytes at the allocation
+                static void operator delete(void *pointer, std::size_t size) noexcept;
             };
         }
     }
@@ -16,17 +16,54 @@ namespace ara
                 return mDiscardable;
             }
 
-            std::vector<uint8_t> Option::BasePayload() const
+            std::size_t Option::Size() const noexcept
             {
-                std::vector<uint8_t> _result;
+                std::size_t _result = cHeaderSize + Length();
+                return _result;
+            }
+
+            std::size_t Option::BaseSerializeTo(uint8_t *dst, std::size_t cap) const
+            {
+                if (cap < Size())
+                {
+                    throw std::out_of_range(
+                        "The buffer capacity is not enough for the option.");
+                }
 
-                helper::Inject(_result, Length());
+                std::size_t _offset = 0;
+                helper::Inject(dst, _offset, Length());
 
                 uint8_t _type = static_cast<uint8_t>(mType);
-                _result.push_back(_type);
+                dst[_offset++] = _type;
 
                 const uint8_t _discardableFlag = static_cast<uint8_t>(mDiscardable);
-                _result.push_back(_discardableFlag);
+                dst[_offset++] = _discardableFlag;
+
+                return _offset;
+            }
+
+            OptionRecord Option::BaseRecord() const noexcept
+            {
+                OptionRecord _result;
+                _result.Type = mType;
+                _result.Discardable = mDiscardable;
+
+                return _result;
+            }
+
+            void Option::Serialize(std::vector<uint8_t> &payload) const
+            {
+                std::size_t _offset = payload.size();
+                std::size_t _size = Size();
+                payload.resize(_offset + _size);
+                SerializeTo(payload.data() + _offset, _size);
+            }
+
+            std::vector<uint8_t> Option::Payload() const
+            {
+                std::vector<uint8_t> _result;
+                _result.reserve(Size());
+                Serialize(_result);
 
                 return _result;
             }
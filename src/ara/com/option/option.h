@@ -2,8 +2,11 @@
 #define OPTION_H
 
 #include <stdint.h>
+#include <array>
 #include <vector>
+#include <stdexcept>
 #include "../helper/payload_helper.h"
+#include "../helper/byte_reader.h"
 
 namespace ara
 {
@@ -32,6 +35,45 @@ namespace ara
                 Udp = 0x11  ///< User datagram protocol
             };
 
+            /// @brief Plain value representation of an entry option
+            /// @details The option-specific fields are held in a small tagged union
+            /// which should be accessed based on the option type.
+            struct OptionRecord
+            {
+                /// @brief IPv4 endpoint option fields
+                struct Ipv4EndpointFields
+                {
+                    /// @brief IPv4 address octets
+                    std::array<uint8_t, 4> Octets;
+                    /// @brief OSI layer-4 protocol
+                    Layer4ProtocolType Protocol;
+                    /// @brief Network port number
+                    uint16_t Port;
+                };
+
+                /// @brief Load-balancing option fields
+                struct LoadBalancingFields
+                {
+                    /// @brief Service instance priority
+                    uint16_t Priority;
+                    /// @brief Service instance weight
+                    uint16_t Weight;
+                };
+
+                /// @brief Option type
+                OptionType Type;
+                /// @brief Discardable flag
+                bool Discardable;
+
+                union
+                {
+                    /// @brief Valid for the IPv4 endpoint, multicast and SD endpoint option types
+                    Ipv4EndpointFields Ipv4Endpoint;
+                    /// @brief Valid for the load-balancing option type
+                    LoadBalancingFields LoadBalancing;
+                };
+            };
+
             /// @brief Communication message entry abstract option
             class Option
             {
@@ -48,11 +90,21 @@ namespace ara
                 {
                 }
 
-                /// @brief Get base option payload
-                /// @returns Byte array
-                std::vector<uint8_t> BasePayload() const;
+                /// @brief Serialize the base option fields into a byte buffer
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
+                /// @returns Offset right after the serialized base fields
+                /// @throws std::out_of_range Throws when the capacity does not fit the whole option
+                std::size_t BaseSerializeTo(uint8_t *dst, std::size_t cap) const;
+
+                /// @brief Get the base option fields as a record
+                /// @returns Record filled with the option type and discardable flag
+                OptionRecord BaseRecord() const noexcept;
 
             public:
+                /// @brief Option length and type fields size in bytes
+                static const uint8_t cHeaderSize = 3;
+
                 virtual ~Option() noexcept = default;
 
                 /// @brief Get option length
@@ -67,9 +119,29 @@ namespace ara
                 /// @returns True if the option can be discarded; otherwise false
                 bool Discardable() const noexcept;
 
+                /// @brief Get option size
+                /// @returns Serialized option size in bytes including the length and type fields
+                std::size_t Size() const noexcept;
+
+                /// @brief Serialize the option into a caller-provided byte buffer
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
+                /// @returns Number of written bytes
+                /// @throws std::out_of_range Throws when the capacity does not fit the option
+                virtual std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const = 0;
+
+                /// @brief Serialize the option at the end of a byte array
+                /// @param[out] payload Byte array to append the option to
+                /// @note No allocation happens if the payload has enough reserved capacity.
+                void Serialize(std::vector<uint8_t> &payload) const;
+
                 /// @brief Get option payload
                 /// @returns Byte array
-                virtual std::vector<uint8_t> Payload() const = 0;
+                virtual std::vector<uint8_t> Payload() const;
+
+                /// @brief Get the option as a plain value record
+                /// @returns Option record
+                virtual OptionRecord Record() const noexcept = 0;
             };
         }
     }
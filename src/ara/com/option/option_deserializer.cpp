@@ -10,29 +10,109 @@ namespace ara
                 const std::vector<uint8_t> &payload,
                 std::size_t &offset)
             {
-                // Apply the option length field offset
-                offset += 2;
+                helper::ByteReader _reader(payload);
+                std::unique_ptr<Option> _result;
 
-                auto _type = static_cast<OptionType>(payload.at(offset++));
-                auto _discardable = static_cast<bool>(payload.at(offset++));
+                bool _successful =
+                    _reader.Skip(offset) && TryDeserialize(_reader, _result);
+
+                if (!_successful)
+                {
+                    throw std::out_of_range(
+                        "Option is corrupted or its type is not supported for deserializing.");
+                }
+
+                offset = _reader.Offset();
+
+                return _result;
+            }
+
+            bool OptionDeserializer::TryDeserialize(
+                helper::ByteReader &reader,
+                std::unique_ptr<Option> &option)
+            {
+                // The option is instantiated from the decoded record, so both paths share one decoder.
+                OptionRecord _record;
+                if (!TryDeserialize(reader, _record))
+                {
+                    return false;
+                }
+
+                option = FromRecord(_record);
+
+                return option != nullptr;
+            }
+
+            std::unique_ptr<Option> OptionDeserializer::FromRecord(const OptionRecord &record)
+            {
+                switch (record.Type)
+                {
+                case OptionType::IPv4Endpoint:
+                case OptionType::IPv4Multicast:
+                case OptionType::IPv4SdEndpoint:
+                    return Ipv4EndpointOption::FromRecord(record);
+
+                case OptionType::LoadBalancing:
+                    return LoadBalancingOption::FromRecord(record);
+
+                default:
+                    return nullptr;
+                }
+            }
+
+            bool OptionDeserializer::TryDeserialize(
+                helper::ByteReader &reader,
+                OptionRecord &record) noexcept
+            {
+                if (!reader.Require(Option::cHeaderSize))
+                {
+                    return false;
+                }
+
+                uint16_t _length = reader.ReadShort();
+                auto _type = static_cast<OptionType>(reader.ReadByte());
+
+                // The length field covers the discardable flag and the option specific fields.
+                if (!reader.Require(_length))
+                {
+                    return false;
+                }
 
                 switch (_type)
                 {
                 case OptionType::IPv4Endpoint:
                 case OptionType::IPv4Multicast:
                 case OptionType::IPv4SdEndpoint:
-                    return Ipv4EndpointOption::Deserialize(
-                        payload, offset, _type, _discardable);
+                {
+                    if (_length != Ipv4EndpointOption::cOptionLength)
+                    {
+                        return false;
+                    }
+
+                    auto _discardable = static_cast<bool>(reader.ReadByte());
+
+                    return Ipv4EndpointOption::DeserializeRecord(
+                        reader, _type, _discardable, record);
+                }
 
                 case OptionType::LoadBalancing:
-                    return LoadBalancingOption::Deserialize(
-                        payload, offset, _discardable);
+                {
+                    if (_length != LoadBalancingOption::cOptionLength)
+                    {
+                        return false;
+                    }
+
+                    auto _discardable = static_cast<bool>(reader.ReadByte());
+                    record = LoadBalancingOption::DeserializeRecord(
+                        reader, _discardable);
+
+                    return true;
+                }
 
                 default:
-                    throw std::out_of_range(
-                        "Option type is not supported for deserializing.");
+                    return false;
                 }
             }
         }
     }
-}
\ No newline at end of file
+}
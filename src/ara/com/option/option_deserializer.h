@@ -18,10 +18,32 @@ namespace ara
                 /// @param payload Serialized option payload byte array
                 /// @param offset Deserializing offset in the payload
                 /// @returns Deserialized option
-                /// @throws std::out_of_range Throws when the option type for deserializing is not supported
+                /// @throws std::out_of_range Throws when the option is corrupted or its type is not supported
                 static std::unique_ptr<Option> Deserialize(
                     const std::vector<uint8_t> &payload,
                     std::size_t &offset);
+
+                /// @brief Try to deserialize an option
+                /// @param reader Byte reader positioned at the option
+                /// @param[out] option Deserialized option
+                /// @returns True if the option is deserialized; false if it is corrupted or its type is not supported
+                /// @note The remaining length is validated once for the whole option.
+                static bool TryDeserialize(
+                    helper::ByteReader &reader,
+                    std::unique_ptr<Option> &option);
+
+                /// @brief Instantiate an option from a decoded record
+                /// @param record Option record
+                /// @returns Option, or null if the option type is not supported
+                static std::unique_ptr<Option> FromRecord(const OptionRecord &record);
+
+                /// @brief Try to decode an option into a plain value record without instantiating it
+                /// @param reader Byte reader positioned at the option
+                /// @param[out] record Decoded option record
+                /// @returns True if the option is decoded; false if it is corrupted or its type is not supported
+                static bool TryDeserialize(
+                    helper::ByteReader &reader,
+                    OptionRecord &record) noexcept;
             };
         }
     }
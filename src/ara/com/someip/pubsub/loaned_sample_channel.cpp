@@ -0,0 +1,124 @@
+#include "./loaned_sample_channel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                LoanedSamplePublisher::LoanedSamplePublisher(
+                    const std::string &poolName,
+                    std::size_t chunkSize,
+                    std::size_t chunkCount) : mPool(poolName, chunkSize, chunkCount),
+                                              mDroppedSamples{0}
+                {
+                }
+
+                helper::LoanedSample LoanedSamplePublisher::Loan() noexcept
+                {
+                    uint32_t _chunk = mPool.TryLoan();
+                    if (_chunk == helper::SharedMemoryChunkPool::cInvalidChunk)
+                    {
+                        return helper::LoanedSample();
+                    }
+                    else
+                    {
+                        return helper::LoanedSample(&mPool, _chunk);
+                    }
+                }
+
+                void LoanedSamplePublisher::AddSubscriber(const std::string &queueName)
+                {
+                    std::unique_ptr<helper::SharedMemoryRing> _queue{
+                        new helper::SharedMemoryRing(queueName, LoanedSampleSubscriber::cDefaultQueueCapacity)};
+
+                    std::lock_guard<std::mutex> _lock(mSubscribersMutex);
+                    mSubscribers[queueName] = std::move(_queue);
+                }
+
+                void LoanedSamplePublisher::RemoveSubscriber(const std::string &queueName)
+                {
+                    std::lock_guard<std::mutex> _lock(mSubscribersMutex);
+                    mSubscribers.erase(queueName);
+                }
+
+                std::size_t LoanedSamplePublisher::Publish(
+                    helper::LoanedSample &&sample,
+                    std::size_t size)
+                {
+                    if (!sample)
+                    {
+                        return 0;
+                    }
+
+                    const uint32_t cChunk = sample.Chunk();
+                    mPool.SetSize(cChunk, size);
+
+                    std::size_t _result = 0;
+                    std::lock_guard<std::mutex> _lock(mSubscribersMutex);
+
+                    if (!mSubscribers.empty())
+                    {
+                        // Take all the subscriber references before the first one can be released.
+                        mPool.Retain(cChunk, static_cast<uint32_t>(mSubscribers.size()));
+
+                        for (auto &_subscriber : mSubscribers)
+                        {
+                            bool _written =
+                                _subscriber.second->TryWrite(
+                                    reinterpret_cast<const uint8_t *>(&cChunk), sizeof(cChunk));
+
+                            if (_written)
+                            {
+                                ++_result;
+                            }
+                            else
+                            {
+                                mPool.Release(cChunk);
+                                ++mDroppedSamples;
+                            }
+                        }
+                    }
+
+                    // Release the publisher reference
+                    sample.Reset();
+
+                    return _result;
+                }
+
+                std::size_t LoanedSamplePublisher::DroppedSamples() const noexcept
+                {
+                    return mDroppedSamples;
+                }
+
+                std::size_t LoanedSamplePublisher::FreeChunks() const noexcept
+                {
+                    return mPool.FreeChunks();
+                }
+
+                const std::size_t LoanedSampleSubscriber::cDefaultQueueCapacity;
+
+                LoanedSampleSubscriber::LoanedSampleSubscriber(
+                    const std::string &poolName,
+                    const std::string &queueName,
+                    std::size_t queueCapacity) : mPool(poolName),
+                                                 mQueue(queueName, queueCapacity)
+                {
+                }
+
+                bool LoanedSampleSubscriber::Wait(int timeout) noexcept
+                {
+                    return mQueue.Wait(timeout);
+                }
+
+                LoanedSampleSubscriber::~LoanedSampleSubscriber() noexcept
+                {
+                    // Return the pending events to the pool
+                    Take([](helper::LoanedSample &&) {});
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef LOANED_SAMPLE_CHANNEL_H
+#define LOANED_SAMPLE_CHANNEL_H
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "../../helper/shared_memory_chunk_pool.h"
+#include "../../helper/shared_memory_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                /// @brief Same-host event publisher which shares loaned pool chunks instead of copying payloads
+                /// @details The publisher writes an event directly into a chunk loaned from its shared-memory pool.
+                /// Publishing only pushes the chunk index to each subscriber queue, and the chunk returns to the pool
+                /// once all the subscribers have released it.
+                /// @note The subscriptions themselves are still negotiated via the service discovery
+                /// (e.g., by SomeIpPubSubServer); a subscriber queue should be added after acknowledging
+                /// the subscription and removed on the unsubscription.
+                class LoanedSamplePublisher
+                {
+                private:
+                    helper::SharedMemoryChunkPool mPool;
+                    std::mutex mSubscribersMutex;
+                    std::map<std::string, std::unique_ptr<helper::SharedMemoryRing>> mSubscribers;
+                    std::atomic_size_t mDroppedSamples;
+
+                public:
+                    LoanedSamplePublisher() = delete;
+                    LoanedSamplePublisher(const LoanedSamplePublisher &) = delete;
+                    LoanedSamplePublisher &operator=(const LoanedSamplePublisher &) = delete;
+
+                    /// @brief Constructor
+                    /// @param poolName Shared-memory object name of the chunk pool to create
+                    /// @param chunkSize Maximum event size in bytes
+                    /// @param chunkCount Number of the events that can be loaned or in flight at the same time
+                    /// @throws std::invalid_argument Throws if the pool dimensions are invalid
+                    /// @throws std::runtime_error Throws if the pool cannot be created
+                    LoanedSamplePublisher(
+                        const std::string &poolName,
+                        std::size_t chunkSize,
+                        std::size_t chunkCount);
+
+                    /// @brief Loan a chunk to write an event into
+                    /// @returns Loaned sample, or an empty sample if all the chunks are in use
+                    helper::LoanedSample Loan() noexcept;
+
+                    /// @brief Add a subscriber queue
+                    /// @param queueName Shared-memory object name of the subscriber queue
+                    /// @throws std::runtime_error Throws if the queue cannot be opened
+                    void AddSubscriber(const std::string &queueName);
+
+                    /// @brief Remove a subscriber queue
+                    /// @param queueName Shared-memory object name of the subscriber queue
+                    void RemoveSubscriber(const std::string &queueName);
+
+                    /// @brief Publish a loaned event to all the subscribers
+                    /// @param sample Sample loaned from this publisher
+                    /// @param size Written event size in bytes
+                    /// @returns Number of the subscribers that the event is delivered to
+                    /// @note An event is dropped for a subscriber whose queue is full.
+                    std::size_t Publish(helper::LoanedSample &&sample, std::size_t size);
+
+                    /// @brief Get the number of the dropped events
+                    /// @returns Number of the event deliveries dropped due to the full subscriber queues
+                    std::size_t DroppedSamples() const noexcept;
+
+                    /// @brief Get the number of the free pool chunks
+                    /// @returns Number of the chunks that can be loaned now
+                    std::size_t FreeChunks() const noexcept;
+                };
+
+                /// @brief Same-host event subscriber which reads the published chunks in place
+                /// @note The subscriber should be removed from the publisher before its destruction,
+                /// otherwise the chunks published in the meantime are not returned to the pool.
+                class LoanedSampleSubscriber
+                {
+                private:
+                    helper::SharedMemoryChunkPool mPool;
+                    helper::SharedMemoryRing mQueue;
+
+                public:
+                    /// @brief Default queue capacity in bytes which fits 512 pending events
+                    static const std::size_t cDefaultQueueCapacity = 4096;
+
+                    LoanedSampleSubscriber() = delete;
+                    LoanedSampleSubscriber(const LoanedSampleSubscriber &) = delete;
+                    LoanedSampleSubscriber &operator=(const LoanedSampleSubscriber &) = delete;
+
+                    /// @brief Constructor
+                    /// @param poolName Shared-memory object name of the publisher chunk pool
+                    /// @param queueName Shared-memory object name of the subscriber queue to create
+                    /// @param queueCapacity Subscriber queue capacity in bytes
+                    /// @throws std::runtime_error Throws if the pool does not exist or the queue cannot be created
+                    LoanedSampleSubscriber(
+                        const std::string &poolName,
+                        const std::string &queueName,
+                        std::size_t queueCapacity = cDefaultQueueCapacity);
+
+                    ~LoanedSampleSubscriber() noexcept;
+
+                    /// @brief Wait for a published event
+                    /// @param timeout Waiting timeout in milliseconds
+                    /// @returns True if there is an event to take; otherwise false
+                    bool Wait(int timeout) noexcept;
+
+                    /// @brief Take all the published events
+                    /// @tparam F Callback type invocable with a loaned sample rvalue
+                    /// @param callback Callback to be invoked per event which can keep the sample by moving it
+                    /// @returns Number of the taken events
+                    template <typename F>
+                    std::size_t Take(F &&callback)
+                    {
+                        std::size_t _result =
+                            mQueue.Receive(
+                                [this, &callback](const uint8_t *data, std::size_t size)
+                                {
+                                    uint32_t _chunk;
+                                    if (size == sizeof(_chunk))
+                                    {
+                                        std::memcpy(&_chunk, data, sizeof(_chunk));
+                                        callback(helper::LoanedSample(&mPool, _chunk));
+                                    }
+                                });
+
+                        return _result;
+                    }
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,197 @@
+#include <stdexcept>
+#include "./someip_event_publisher.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                SomeIpEventPublisher::SomeIpEventPublisher(
+                    SomeIpPubSubMultiServer *server,
+                    helper::DatagramSender *sender,
+                    std::chrono::milliseconds coalescingWindow,
+                    std::size_t maxDatagramSize) : mServer{server},
+                                                   mSender{sender},
+                                                   mCoalescingWindow{coalescingWindow},
+                                                   mMaxDatagramSize{maxDatagramSize},
+                                                   mRunning{true}
+                {
+                    if (mCoalescingWindow < std::chrono::milliseconds::zero())
+                    {
+                        throw std::invalid_argument("The coalescing window cannot be negative.");
+                    }
+
+                    if (mMaxDatagramSize == 0)
+                    {
+                        throw std::invalid_argument("The maximum datagram size cannot be zero.");
+                    }
+
+                    if (mCoalescingWindow > std::chrono::milliseconds::zero())
+                    {
+                        mFlusher = std::thread(&SomeIpEventPublisher::flushElapsedWindows, this);
+                    }
+                }
+
+                bool SomeIpEventPublisher::flush(uint16_t eventgroupId, Batch &batch)
+                {
+                    // A flush closes the current window, so its timer is not needed anymore.
+                    // The window callback does not lock the batches, hence cancelling under the lock is safe.
+                    if (batch.Timer != helper::TimerWheel::cInvalidTimer)
+                    {
+                        helper::TimerWheel::Shared().Cancel(batch.Timer);
+                        batch.Timer = helper::TimerWheel::cInvalidTimer;
+                    }
+                    ++batch.Window;
+
+                    if (batch.Datagram.empty())
+                    {
+                        return false;
+                    }
+
+                    // Refilling the member endpoints keeps their capacity across the flushes.
+                    mServer->GetSubscribers(eventgroupId, mEndpoints);
+
+                    bool _result = !mEndpoints.empty();
+                    if (_result)
+                    {
+                        mSender->SendTo(batch.Datagram.data(), batch.Datagram.size(), mEndpoints);
+                    }
+
+                    // Clearing keeps the datagram capacity for the next batch.
+                    batch.Datagram.clear();
+
+                    return _result;
+                }
+
+                void SomeIpEventPublisher::onWindowElapsed(uint16_t eventgroupId, uint32_t window)
+                {
+                    // Invoked by the shared timer wheel thread, so only post the window to the flusher.
+                    {
+                        std::lock_guard<std::mutex> _lock(mWindowMutex);
+                        mElapsedWindows.push_back(ElapsedWindow{eventgroupId, window});
+                    }
+
+                    mConditionVariable.notify_one();
+                }
+
+                void SomeIpEventPublisher::flushElapsedWindows()
+                {
+                    std::vector<ElapsedWindow> _elapsedWindows;
+                    std::unique_lock<std::mutex> _windowLock(mWindowMutex);
+
+                    while (mRunning)
+                    {
+                        mConditionVariable.wait(
+                            _windowLock, [this]()
+                            { return !mRunning || !mElapsedWindows.empty(); });
+
+                        _elapsedWindows.swap(mElapsedWindows);
+                        _windowLock.unlock();
+
+                        {
+                            std::lock_guard<std::mutex> _lock(mMutex);
+                            for (const auto &_elapsedWindow : _elapsedWindows)
+                            {
+                                Batch &_batch = mBatches[_elapsedWindow.EventgroupId];
+                                // The window may have already been flushed before its timer was cancelled.
+                                if (_batch.Window == _elapsedWindow.Window)
+                                {
+                                    flush(_elapsedWindow.EventgroupId, _batch);
+                                }
+                            }
+                        }
+
+                        _elapsedWindows.clear();
+                        _windowLock.lock();
+                    }
+                }
+
+                void SomeIpEventPublisher::Publish(uint16_t eventgroupId, SomeIpEventMessage &event)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mBatches.find(eventgroupId);
+                    if (_itr == mBatches.end())
+                    {
+                        Batch _batch;
+                        _batch.Datagram.reserve(mMaxDatagramSize);
+                        _batch.Timer = helper::TimerWheel::cInvalidTimer;
+                        _batch.Window = 0;
+                        _itr = mBatches.emplace(eventgroupId, std::move(_batch)).first;
+                    }
+
+                    Batch &_batch = _itr->second;
+
+                    // Send the pending events first if the event does not fit next to them.
+                    if (_batch.Datagram.size() + event.Size() > mMaxDatagramSize)
+                    {
+                        flush(eventgroupId, _batch);
+                    }
+
+                    event.Serialize(_batch.Datagram);
+                    event.IncrementSessionId();
+
+                    if (mCoalescingWindow == std::chrono::milliseconds::zero() ||
+                        _batch.Datagram.size() >= mMaxDatagramSize)
+                    {
+                        flush(eventgroupId, _batch);
+                    }
+                    else if (_batch.Timer == helper::TimerWheel::cInvalidTimer)
+                    {
+                        _batch.Timer =
+                            helper::TimerWheel::Shared().Schedule(
+                                mCoalescingWindow,
+                                std::bind(
+                                    &SomeIpEventPublisher::onWindowElapsed,
+                                    this,
+                                    eventgroupId,
+                                    _batch.Window));
+                    }
+                }
+
+                std::size_t SomeIpEventPublisher::Flush()
+                {
+                    std::size_t _result = 0;
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    for (auto &_batchPair : mBatches)
+                    {
+                        if (flush(_batchPair.first, _batchPair.second))
+                        {
+                            ++_result;
+                        }
+                    }
+
+                    return _result;
+                }
+
+                SomeIpEventPublisher::~SomeIpEventPublisher()
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        for (const auto &_batchPair : mBatches)
+                        {
+                            helper::TimerWheel::Shared().Cancel(_batchPair.second.Timer);
+                        }
+                    }
+
+                    if (mFlusher.joinable())
+                    {
+                        {
+                            std::lock_guard<std::mutex> _lock(mWindowMutex);
+                            mRunning = false;
+                        }
+
+                        mConditionVariable.notify_one();
+                        mFlusher.join();
+                    }
+
+                    Flush();
+                }
+            }
+        }
+    }
+}
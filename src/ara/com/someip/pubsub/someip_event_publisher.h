@@ -0,0 +1,102 @@
+#ifndef SOMEIP_EVENT_PUBLISHER_H
+#define SOMEIP_EVENT_PUBLISHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../../helper/datagram_sender.h"
+#include "../../helper/timer_wheel.h"
+#include "../../helper/udp_socket.h"
+#include "../someip_event_message.h"
+#include "./someip_pubsub_multi_server.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                /// @brief SOME/IP event publisher which notifies the event-group subscribers
+                /// @details An event is serialized once into its event-group datagram, and the datagram is sent to all
+                /// the UDP subscribers of the event-group at once. Given a coalescing window, the events of an
+                /// event-group which are published within the window are packed into the same datagram as
+                /// consecutive SOME/IP messages, so each subscriber receives a single datagram per window.
+                /// @note The window is started by the first pending event of an event-group, and a datagram is
+                /// sent earlier if the next event does not fit in it. An elapsed window is flushed by the
+                /// publisher's own thread, so the shared timer wheel thread never waits for the sending.
+                class SomeIpEventPublisher
+                {
+                private:
+                    struct Batch
+                    {
+                        std::vector<uint8_t> Datagram;
+                        helper::TimerWheel::TimerId Timer;
+                        uint32_t Window;
+                    };
+
+                    struct ElapsedWindow
+                    {
+                        uint16_t EventgroupId;
+                        uint32_t Window;
+                    };
+
+                    SomeIpPubSubMultiServer *const mServer;
+                    helper::DatagramSender *const mSender;
+                    const std::chrono::milliseconds mCoalescingWindow;
+                    const std::size_t mMaxDatagramSize;
+                    std::map<uint16_t, Batch> mBatches;
+                    std::vector<helper::DatagramEndpoint> mEndpoints;
+                    std::mutex mMutex;
+                    std::vector<ElapsedWindow> mElapsedWindows;
+                    std::mutex mWindowMutex;
+                    std::condition_variable mConditionVariable;
+                    bool mRunning;
+                    std::thread mFlusher;
+
+                    bool flush(uint16_t eventgroupId, Batch &batch);
+                    void onWindowElapsed(uint16_t eventgroupId, uint32_t window);
+                    void flushElapsedWindows();
+
+                public:
+                    SomeIpEventPublisher() = delete;
+                    SomeIpEventPublisher(const SomeIpEventPublisher &) = delete;
+                    SomeIpEventPublisher &operator=(const SomeIpEventPublisher &) = delete;
+
+                    /// @brief Constructor
+                    /// @param server Publish/subscribe server which holds the event-groups subscribers
+                    /// @param sender Unicast datagram sender to the subscribers
+                    /// @param coalescingWindow Duration within which the events of an event-group are packed
+                    /// into the same datagram, or zero to send each event immediately
+                    /// @param maxDatagramSize Maximum coalesced datagram size in bytes
+                    /// @throws std::invalid_argument Throws if the window is negative or the datagram size is zero
+                    SomeIpEventPublisher(
+                        SomeIpPubSubMultiServer *server,
+                        helper::DatagramSender *sender,
+                        std::chrono::milliseconds coalescingWindow = std::chrono::milliseconds::zero(),
+                        std::size_t maxDatagramSize = helper::UdpSocket::cMaxDatagramSize);
+
+                    /// @brief Destructor
+                    /// @note The pending coalesced events are sent before destruction.
+                    ~SomeIpEventPublisher();
+
+                    /// @brief Publish an event to an event-group subscribers
+                    /// @param eventgroupId Event-group ID that the event belongs to
+                    /// @param event Event notification message whose session ID is incremented after publishing
+                    /// @note An event larger than the maximum datagram size is sent on its own.
+                    void Publish(uint16_t eventgroupId, SomeIpEventMessage &event);
+
+                    /// @brief Send all the pending coalesced events without waiting for their windows
+                    /// @returns Number of the event-groups whose pending events are sent
+                    std::size_t Flush();
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -24,11 +24,11 @@ namespace ara
                     mCommunicationLayer->SetReceiver(this, _receiver);
                 }
 
-                void SomeIpPubSubClient::onMessageReceived(sd::SomeIpSdMessage &&message)
+                void SomeIpPubSubClient::onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message)
                 {
-                    for (auto &entry : message.Entries())
+                    for (const auto &_entry : message->EntryRecords())
                     {
-                        if (entry->Type() == entry::EntryType::Acknowledging)
+                        if (_entry.Type == entry::EntryType::Acknowledging)
                         {
                             bool _enqueued = mMessageBuffer.TryEnqueue(std::move(message));
 
@@ -36,6 +36,9 @@ namespace ara
                             {
                                 mSubscriptionConditionVariable.notify_one();
                             }
+
+                            // The message is buffered once regardless of its number of acknowledgements.
+                            return;
                         }
                     }
                 }
@@ -74,7 +77,7 @@ namespace ara
 
                 bool SomeIpPubSubClient::TryGetProcessedSubscription(
                     int duration,
-                    sd::SomeIpSdMessage &message)
+                    std::shared_ptr<const sd::SomeIpSdMessage> &message)
                 {
                     bool _result;
 
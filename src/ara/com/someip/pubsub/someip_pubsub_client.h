@@ -4,7 +4,7 @@
 #include <condition_variable>
 #include "../../entry/eventgroup_entry.h"
 #include "../../helper/network_layer.h"
-#include "../../helper/concurrent_queue.h"
+#include "../../helper/ring_buffer.h"
 #include "../sd/someip_sd_message.h"
 
 namespace ara
@@ -19,7 +19,7 @@ namespace ara
                 class SomeIpPubSubClient
                 {
                 private:
-                    helper::ConcurrentQueue<sd::SomeIpSdMessage> mMessageBuffer;
+                    helper::MpmcRingBuffer<std::shared_ptr<const sd::SomeIpSdMessage>> mMessageBuffer;
                     std::mutex mSubscriptionMutex;
                     std::unique_lock<std::mutex> mSubscriptionLock;
                     std::condition_variable mSubscriptionConditionVariable;
@@ -27,7 +27,7 @@ namespace ara
                     uint8_t mCounter;
                     bool mValidNotify;
 
-                    void onMessageReceived(sd::SomeIpSdMessage &&message);
+                    void onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message);
 
                 public:
                     SomeIpPubSubClient() = delete;
@@ -68,7 +68,7 @@ namespace ara
                     /// @returns True, if the service offering is stopped before the timeout; otherwise false
                     bool TryGetProcessedSubscription(
                         int duration,
-                        sd::SomeIpSdMessage &message);
+                        std::shared_ptr<const sd::SomeIpSdMessage> &message);
                 };
             }
         }
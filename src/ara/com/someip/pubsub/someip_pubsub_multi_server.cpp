@@ -0,0 +1,429 @@
+#include <algorithm>
+#include <stdexcept>
+#include "./someip_pubsub_multi_server.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                const uint32_t SomeIpPubSubMultiServer::cInfiniteTtl;
+
+                SomeIpPubSubMultiServer::SomeIpPubSubMultiServer(
+                    helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    std::size_t maxMessageSize) : SomeIpPubSubMultiServer(
+                                                      networkLayer, nullptr,
+                                                      serviceId, instanceId, majorVersion,
+                                                      maxMessageSize)
+                {
+                }
+
+                SomeIpPubSubMultiServer::SomeIpPubSubMultiServer(
+                    sd::SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    std::size_t maxMessageSize) : SomeIpPubSubMultiServer(
+                                                      dispatcher->GetNetworkLayer(), dispatcher,
+                                                      serviceId, instanceId, majorVersion,
+                                                      maxMessageSize)
+                {
+                }
+
+                SomeIpPubSubMultiServer::SomeIpPubSubMultiServer(
+                    helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                    sd::SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    std::size_t maxMessageSize) : mCommunicationLayer{networkLayer},
+                                                  mDispatcher{dispatcher},
+                                                  mServiceId{serviceId},
+                                                  mInstanceId{instanceId},
+                                                  mMajorVersion{majorVersion},
+                                                  mMaxMessageSize{maxMessageSize},
+                                                  mRunning{false}
+                {
+                    // Validate the message size once rather than on each received message
+                    sd::SomeIpSdPacketizer _packetizer(maxMessageSize);
+
+                    // The subscriptions are routed per event-group via the dispatcher as the event-groups are added.
+                    if (mDispatcher == nullptr)
+                    {
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpPubSubMultiServer::onMessageReceived,
+                                this,
+                                std::placeholders::_1);
+                        mCommunicationLayer->SetReceiver(this, _receiver);
+                    }
+                }
+
+                bool SomeIpPubSubMultiServer::matchSubscription(const entry::EntryRecord &entry) const noexcept
+                {
+                    // Compare service ID, instance ID, and major version
+                    bool _result =
+                        (entry.Type == entry::EntryType::Subscribing) &&
+                        (entry.ServiceId == mServiceId) &&
+                        (entry.InstanceId == entry::Entry::cAnyInstanceId ||
+                         entry.InstanceId == mInstanceId) &&
+                        (entry.MajorVersion == entry::Entry::cAnyMajorVersion ||
+                         entry.MajorVersion == mMajorVersion);
+
+                    return _result;
+                }
+
+                bool SomeIpPubSubMultiServer::tryGetEndpoint(
+                    const sd::SomeIpSdMessage &message,
+                    const entry::EntryRecord &entry,
+                    EventgroupSubscriber &subscriber) noexcept
+                {
+                    const auto &cOptions = message.OptionRecords();
+
+                    // Search both the option runs for the first unicast endpoint of the subscriber
+                    const std::size_t cOptionCount =
+                        static_cast<std::size_t>(entry.FirstOptionCount + entry.SecondOptionCount);
+                    for (std::size_t i = 0; i < cOptionCount; ++i)
+                    {
+                        const std::size_t cIndex =
+                            i < entry.FirstOptionCount ? entry.FirstOptionIndex + i
+                                                       : entry.SecondOptionIndex + i - entry.FirstOptionCount;
+
+                        if (cIndex < cOptions.size() &&
+                            cOptions[cIndex].Type == option::OptionType::IPv4Endpoint)
+                        {
+                            const auto &cEndpoint = cOptions[cIndex].Ipv4Endpoint;
+                            subscriber.Address =
+                                helper::Ipv4Address(
+                                    cEndpoint.Octets[0],
+                                    cEndpoint.Octets[1],
+                                    cEndpoint.Octets[2],
+                                    cEndpoint.Octets[3]);
+                            subscriber.Port = cEndpoint.Port;
+                            subscriber.Protocol = cEndpoint.Protocol;
+
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                std::size_t SomeIpPubSubMultiServer::purge(Eventgroup &eventgroup, Clock::time_point now)
+                {
+                    auto &_subscribers = eventgroup.Subscribers;
+                    const std::size_t cSize = _subscribers.size();
+
+                    _subscribers.erase(
+                        std::remove_if(
+                            _subscribers.begin(),
+                            _subscribers.end(),
+                            [now](const Subscriber &subscriber)
+                            { return subscriber.Expiry <= now; }),
+                        _subscribers.end());
+
+                    return cSize - _subscribers.size();
+                }
+
+                bool SomeIpPubSubMultiServer::process(
+                    const sd::SomeIpSdMessage &message,
+                    const entry::EntryRecord &entry,
+                    Clock::time_point now,
+                    sd::SomeIpSdPacketizer &packetizer)
+                {
+                    const bool cDiscardableEndpoint{true};
+
+                    auto _itr = mEventgroups.find(entry.Eventgroup.EventgroupId);
+                    if (_itr == mEventgroups.end())
+                    {
+                        // The event-group may be served by another server on the same network layer.
+                        return false;
+                    }
+
+                    Eventgroup &_eventgroup = _itr->second;
+                    EventgroupSubscriber _endpoint{
+                        helper::Ipv4Address(0, 0, 0, 0), 0, option::Layer4ProtocolType::Udp,
+                        entry.Eventgroup.Counter, entry.TTL};
+                    const bool cHasEndpoint = tryGetEndpoint(message, entry, _endpoint);
+
+                    auto _subscriber =
+                        std::find_if(
+                            _eventgroup.Subscribers.begin(),
+                            _eventgroup.Subscribers.end(),
+                            [&_endpoint](const Subscriber &subscriber)
+                            {
+                                return subscriber.Endpoint.Address == _endpoint.Address &&
+                                       subscriber.Endpoint.Port == _endpoint.Port &&
+                                       subscriber.Endpoint.Protocol == _endpoint.Protocol &&
+                                       subscriber.Endpoint.Counter == _endpoint.Counter;
+                            });
+
+                    if (entry.TTL == 0)
+                    {
+                        // A stop subscribing entry is not acknowledged.
+                        if (cHasEndpoint && _subscriber != _eventgroup.Subscribers.end())
+                        {
+                            _eventgroup.Subscribers.erase(_subscriber);
+                        }
+
+                        return false;
+                    }
+
+                    // A subscription is only accepted while the server is running and the subscriber is reachable.
+                    if (mRunning && cHasEndpoint)
+                    {
+                        const Clock::time_point cExpiry =
+                            entry.TTL == cInfiniteTtl ? Clock::time_point::max()
+                                                      : now + std::chrono::seconds(entry.TTL);
+
+                        if (_subscriber == _eventgroup.Subscribers.end())
+                        {
+                            _eventgroup.Subscribers.push_back(Subscriber{_endpoint, cExpiry});
+                        }
+                        else
+                        {
+                            // Renewal of an existing subscription
+                            _subscriber->Expiry = cExpiry;
+                        }
+
+                        auto _acknowledgeEntry = entry::EventgroupEntry::CreateAcknowledgeEntry(entry);
+                        _acknowledgeEntry->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateMulticastEndpoint(
+                                cDiscardableEndpoint,
+                                _eventgroup.MulticastAddress,
+                                _eventgroup.MulticastPort));
+                        packetizer.Add(std::move(_acknowledgeEntry));
+                    }
+                    else
+                    {
+                        packetizer.Add(entry::EventgroupEntry::CreateNegativeAcknowledgeEntry(entry));
+                    }
+
+                    return true;
+                }
+
+                void SomeIpPubSubMultiServer::send(sd::SomeIpSdPacketizer &packetizer)
+                {
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+
+                    packetizer.Flush(
+                        [this](sd::SomeIpSdMessage &message)
+                        {
+                            // Only the shared session ID and the reboot flag are patched into the batched message.
+                            mImage.Reset(message);
+                            mImage.Refresh(mSessionMessage);
+                            mCommunicationLayer->SendPayload(mImage.Payload());
+                            mSessionMessage.IncrementSessionId();
+                        });
+                }
+
+                void SomeIpPubSubMultiServer::onSubscribe(
+                    const std::shared_ptr<const sd::SomeIpSdMessage> &message,
+                    const entry::EntryRecord & /*entry*/)
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+
+                        // The dispatcher routes the entries of a message one by one, but the first routed entry
+                        // already answers the whole message.
+                        if (!mLastMessage.owner_before(message) && !message.owner_before(mLastMessage))
+                        {
+                            return;
+                        }
+
+                        mLastMessage = message;
+                    }
+
+                    onMessageReceived(message);
+                }
+
+                void SomeIpPubSubMultiServer::onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message)
+                {
+                    const Clock::time_point cNow{Clock::now()};
+                    sd::SomeIpSdPacketizer _packetizer(mMaxMessageSize);
+
+                    for (const auto &_entry : message->EntryRecords())
+                    {
+                        if (matchSubscription(_entry))
+                        {
+                            std::lock_guard<std::mutex> _lock(mMutex);
+                            process(*message, _entry, cNow, _packetizer);
+                        }
+                    }
+
+                    // All the acknowledgements of the message are sent together.
+                    if (_packetizer.Pending() > 0)
+                    {
+                        send(_packetizer);
+                    }
+                }
+
+                void SomeIpPubSubMultiServer::AddEventgroup(
+                    uint16_t eventgroupId, helper::Ipv4Address ipAddress, uint16_t port)
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+
+                        auto _result =
+                            mEventgroups.emplace(
+                                eventgroupId,
+                                Eventgroup{ipAddress, port, std::vector<Subscriber>()});
+
+                        if (!_result.second)
+                        {
+                            throw std::invalid_argument("The event-group is already added.");
+                        }
+                    }
+
+                    if (mDispatcher)
+                    {
+                        auto _handler =
+                            std::bind(
+                                &SomeIpPubSubMultiServer::onSubscribe,
+                                this,
+                                std::placeholders::_1,
+                                std::placeholders::_2);
+                        mDispatcher->Register(
+                            this,
+                            entry::EntryType::Subscribing,
+                            mServiceId,
+                            mInstanceId,
+                            eventgroupId,
+                            _handler);
+                    }
+                }
+
+                void SomeIpPubSubMultiServer::Start()
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    mRunning = true;
+                }
+
+                void SomeIpPubSubMultiServer::Stop()
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    mRunning = false;
+
+                    for (auto &_eventgroupPair : mEventgroups)
+                    {
+                        _eventgroupPair.second.Subscribers.clear();
+                    }
+                }
+
+                helper::PubSubState SomeIpPubSubMultiServer::GetState(uint16_t eventgroupId)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mEventgroups.find(eventgroupId);
+                    if (!mRunning || _itr == mEventgroups.end())
+                    {
+                        return helper::PubSubState::ServiceDown;
+                    }
+
+                    purge(_itr->second, Clock::now());
+
+                    if (_itr->second.Subscribers.empty())
+                    {
+                        return helper::PubSubState::NotSubscribed;
+                    }
+                    else
+                    {
+                        return helper::PubSubState::Subscribed;
+                    }
+                }
+
+                std::vector<EventgroupSubscriber> SomeIpPubSubMultiServer::GetSubscribers(uint16_t eventgroupId)
+                {
+                    std::vector<EventgroupSubscriber> _result;
+                    const Clock::time_point cNow{Clock::now()};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mEventgroups.find(eventgroupId);
+                    if (_itr == mEventgroups.end())
+                    {
+                        return _result;
+                    }
+
+                    purge(_itr->second, cNow);
+
+                    for (const auto &_subscriber : _itr->second.Subscribers)
+                    {
+                        EventgroupSubscriber _endpoint{_subscriber.Endpoint};
+
+                        // An infinite TTL is kept as it is; otherwise the remaining seconds are rounded up.
+                        if (_subscriber.Expiry != Clock::time_point::max())
+                        {
+                            const auto cSeconds =
+                                std::chrono::duration_cast<std::chrono::seconds>(
+                                    _subscriber.Expiry - cNow + std::chrono::seconds(1) - Clock::duration(1));
+                            _endpoint.TTL = static_cast<uint32_t>(cSeconds.count());
+                        }
+
+                        _result.push_back(_endpoint);
+                    }
+
+                    return _result;
+                }
+
+                std::size_t SomeIpPubSubMultiServer::GetSubscribers(
+                    uint16_t eventgroupId,
+                    std::vector<helper::DatagramEndpoint> &endpoints)
+                {
+                    endpoints.clear();
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mEventgroups.find(eventgroupId);
+                    if (_itr == mEventgroups.end())
+                    {
+                        return 0;
+                    }
+
+                    purge(_itr->second, Clock::now());
+
+                    for (const auto &_subscriber : _itr->second.Subscribers)
+                    {
+                        const EventgroupSubscriber &_endpoint{_subscriber.Endpoint};
+                        if (_endpoint.Protocol == option::Layer4ProtocolType::Udp)
+                        {
+                            endpoints.push_back(helper::DatagramEndpoint{_endpoint.Address, _endpoint.Port});
+                        }
+                    }
+
+                    return endpoints.size();
+                }
+
+                std::size_t SomeIpPubSubMultiServer::Purge()
+                {
+                    std::size_t _result = 0;
+                    const Clock::time_point cNow{Clock::now()};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    for (auto &_eventgroupPair : mEventgroups)
+                    {
+                        _result += purge(_eventgroupPair.second, cNow);
+                    }
+
+                    return _result;
+                }
+
+                SomeIpPubSubMultiServer::~SomeIpPubSubMultiServer()
+                {
+                    if (mDispatcher)
+                    {
+                        mDispatcher->Unregister(this);
+                    }
+                    else
+                    {
+                        mCommunicationLayer->ResetReceiver(this);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#ifndef SOMEIP_PUBSUB_MULTI_SERVER
+#define SOMEIP_PUBSUB_MULTI_SERVER
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "../../helper/datagram_sender.h"
+#include "../../helper/ipv4_address.h"
+#include "../../helper/machine_state.h"
+#include "../../helper/network_layer.h"
+#include "../../entry/eventgroup_entry.h"
+#include "../../option/ipv4_endpoint_option.h"
+#include "../sd/someip_sd_dispatcher.h"
+#include "../sd/someip_sd_packetizer.h"
+#include "../sd/someip_sd_wire_image.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                /// @brief Event-group subscriber which is identified by its endpoint and its counter
+                struct EventgroupSubscriber
+                {
+                    /// @brief Subscriber unicast IP address
+                    helper::Ipv4Address Address;
+                    /// @brief Subscriber unicast port number
+                    uint16_t Port;
+                    /// @brief Subscriber OSI layer-4 protocol
+                    option::Layer4ProtocolType Protocol;
+                    /// @brief Counter to distinguish between the subscribers of the same endpoint
+                    uint8_t Counter;
+                    /// @brief Remaining subscription time to live in seconds
+                    uint32_t TTL;
+                };
+
+                /// @brief SOME/IP publish/subscribe server which serves multiple event-groups of a service instance
+                /// @details The server keeps a subscriber table per event-group instead of a state machine per
+                /// event-group. A subscriber is added or renewed by a subscribing entry with an IPv4 endpoint option,
+                /// and it is removed by a stop subscribing entry or once its TTL is elapsed. All the subscribing entries
+                /// of a received SD message are acknowledged together in as few SD messages as the maximum
+                /// message size allows.
+                class SomeIpPubSubMultiServer
+                {
+                private:
+                    using Clock = std::chrono::steady_clock;
+
+                    struct Subscriber
+                    {
+                        EventgroupSubscriber Endpoint;
+                        Clock::time_point Expiry;
+                    };
+
+                    struct Eventgroup
+                    {
+                        helper::Ipv4Address MulticastAddress;
+                        uint16_t MulticastPort;
+                        std::vector<Subscriber> Subscribers;
+                    };
+
+                    helper::NetworkLayer<sd::SomeIpSdMessage> *const mCommunicationLayer;
+                    sd::SomeIpSdDispatcher *const mDispatcher;
+                    const uint16_t mServiceId;
+                    const uint16_t mInstanceId;
+                    const uint8_t mMajorVersion;
+                    const std::size_t mMaxMessageSize;
+                    std::map<uint16_t, Eventgroup> mEventgroups;
+                    std::weak_ptr<const sd::SomeIpSdMessage> mLastMessage;
+                    bool mRunning;
+                    std::mutex mMutex;
+                    std::mutex mSendMutex;
+                    sd::SomeIpSdMessage mSessionMessage;
+                    sd::SomeIpSdWireImage mImage;
+
+                    SomeIpPubSubMultiServer(
+                        helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                        sd::SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        std::size_t maxMessageSize);
+
+                    bool matchSubscription(const entry::EntryRecord &entry) const noexcept;
+                    static bool tryGetEndpoint(
+                        const sd::SomeIpSdMessage &message,
+                        const entry::EntryRecord &entry,
+                        EventgroupSubscriber &subscriber) noexcept;
+                    static std::size_t purge(Eventgroup &eventgroup, Clock::time_point now);
+                    bool process(
+                        const sd::SomeIpSdMessage &message,
+                        const entry::EntryRecord &entry,
+                        Clock::time_point now,
+                        sd::SomeIpSdPacketizer &packetizer);
+                    void send(sd::SomeIpSdPacketizer &packetizer);
+                    void onSubscribe(
+                        const std::shared_ptr<const sd::SomeIpSdMessage> &message,
+                        const entry::EntryRecord &entry);
+                    void onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message);
+
+                public:
+                    /// @brief Infinite subscription TTL which never expires
+                    static const uint32_t cInfiniteTtl = 0xffffff;
+
+                    SomeIpPubSubMultiServer() = delete;
+                    SomeIpPubSubMultiServer(const SomeIpPubSubMultiServer &) = delete;
+                    SomeIpPubSubMultiServer &operator=(const SomeIpPubSubMultiServer &) = delete;
+
+                    /// @brief Constructor
+                    /// @param networkLayer Network communication abstraction layer
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @param majorVersion Service major version
+                    /// @param maxMessageSize Maximum serialized acknowledgement SD message size in bytes
+                    /// @throws std::invalid_argument Throws if the maximum message size is invalid
+                    SomeIpPubSubMultiServer(
+                        helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        std::size_t maxMessageSize = sd::SomeIpSdPacketizer::cDefaultMaxMessageSize);
+
+                    /// @brief Constructor
+                    /// @param dispatcher Entry dispatcher which routes only the added event-groups subscribing entries to the server
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @param majorVersion Service major version
+                    /// @param maxMessageSize Maximum serialized acknowledgement SD message size in bytes
+                    /// @throws std::invalid_argument Throws if the maximum message size is invalid
+                    SomeIpPubSubMultiServer(
+                        sd::SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        std::size_t maxMessageSize = sd::SomeIpSdPacketizer::cDefaultMaxMessageSize);
+
+                    ~SomeIpPubSubMultiServer();
+
+                    /// @brief Add an event-group to serve
+                    /// @param eventgroupId Event-group ID
+                    /// @param ipAddress Multicast IP address that clients should listen to for receiving events
+                    /// @param port Multicast port number that clients should listen to for receiving events
+                    /// @throws std::invalid_argument Throws if the event-group is already added
+                    void AddEventgroup(uint16_t eventgroupId, helper::Ipv4Address ipAddress, uint16_t port);
+
+                    /// @brief Start the server, so the subscriptions are acknowledged
+                    void Start();
+
+                    /// @brief Stop the server by dropping all the subscribers
+                    /// @note While the server is stopped, the subscriptions are negatively acknowledged.
+                    void Stop();
+
+                    /// @brief Get an event-group state
+                    /// @param eventgroupId Event-group ID
+                    /// @returns Service-down state if the server is stopped or the event-group is unknown;
+                    /// otherwise, subscribed state if the event-group has at least a live subscriber
+                    helper::PubSubState GetState(uint16_t eventgroupId);
+
+                    /// @brief Get the live subscribers of an event-group
+                    /// @param eventgroupId Event-group ID
+                    /// @returns Subscribers whose subscription is not expired yet
+                    std::vector<EventgroupSubscriber> GetSubscribers(uint16_t eventgroupId);
+
+                    /// @brief Get the live UDP subscriber endpoints of an event-group
+                    /// @param eventgroupId Event-group ID
+                    /// @param endpoints Endpoints to be overwritten by the subscribers which reuses their capacity
+                    /// @returns Number of the filled endpoints
+                    /// @note Only the UDP subscribers are reachable via datagrams, so the TCP ones are skipped.
+                    std::size_t GetSubscribers(
+                        uint16_t eventgroupId,
+                        std::vector<helper::DatagramEndpoint> &endpoints);
+
+                    /// @brief Remove the expired subscribers of all the event-groups
+                    /// @returns Number of the removed subscribers
+                    std::size_t Purge();
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -16,7 +16,37 @@ namespace ara
                     uint8_t majorVersion,
                     uint16_t eventgroupId,
                     helper::Ipv4Address ipAddress,
+                    uint16_t port) : SomeIpPubSubServer(
+                                         networkLayer, nullptr,
+                                         serviceId, instanceId, majorVersion, eventgroupId,
+                                         ipAddress, port)
+                {
+                }
+
+                SomeIpPubSubServer::SomeIpPubSubServer(
+                    sd::SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint16_t eventgroupId,
+                    helper::Ipv4Address ipAddress,
+                    uint16_t port) : SomeIpPubSubServer(
+                                         dispatcher->GetNetworkLayer(), dispatcher,
+                                         serviceId, instanceId, majorVersion, eventgroupId,
+                                         ipAddress, port)
+                {
+                }
+
+                SomeIpPubSubServer::SomeIpPubSubServer(
+                    helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                    sd::SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint16_t eventgroupId,
+                    helper::Ipv4Address ipAddress,
                     uint16_t port) : mCommunicationLayer{networkLayer},
+                                     mDispatcher{dispatcher},
                                      mServiceId{serviceId},
                                      mInstanceId{instanceId},
                                      mMajorVersion{majorVersion},
@@ -29,54 +59,86 @@ namespace ara
                                               &mSubscribedState},
                                              helper::PubSubState::ServiceDown);
 
-                    auto _receiver =
-                        std::bind(
-                            &SomeIpPubSubServer::onMessageReceived,
+                    if (dispatcher)
+                    {
+                        auto _handler =
+                            std::bind(
+                                &SomeIpPubSubServer::onSubscribe,
+                                this,
+                                std::placeholders::_1,
+                                std::placeholders::_2);
+                        mDispatcher->Register(
                             this,
-                            std::placeholders::_1);
-                    mCommunicationLayer->SetReceiver(this, _receiver);
+                            entry::EntryType::Subscribing,
+                            serviceId,
+                            instanceId,
+                            eventgroupId,
+                            _handler);
+                    }
+                    else
+                    {
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpPubSubServer::onMessageReceived,
+                                this,
+                                std::placeholders::_1);
+                        mCommunicationLayer->SetReceiver(this, _receiver);
+                    }
+                }
+
+                bool SomeIpPubSubServer::matchSubscription(const entry::EntryRecord &entry) const
+                {
+                    // Compare service ID, instance ID, major version, and event-group ID
+                    bool _result =
+                        (entry.ServiceId == mServiceId) &&
+                        (entry.InstanceId == entry::Entry::cAnyInstanceId ||
+                         entry.InstanceId == mInstanceId) &&
+                        (entry.MajorVersion == entry::Entry::cAnyMajorVersion ||
+                         entry.MajorVersion == mMajorVersion) &&
+                        (entry.Eventgroup.EventgroupId == mEventgroupId);
+
+                    return _result;
+                }
+
+                void SomeIpPubSubServer::onSubscribe(
+                    const std::shared_ptr<const sd::SomeIpSdMessage> & /*message*/,
+                    const entry::EntryRecord &entry)
+                {
+                    if (!matchSubscription(entry))
+                    {
+                        return;
+                    }
+
+                    if (entry.TTL > 0)
+                    {
+                        // Subscription
+                        processEntry(entry);
+                    }
+                    else
+                    {
+                        // Unsubscription
+                        helper::PubSubState _state = GetState();
+                        if (_state == helper::PubSubState::Subscribed)
+                        {
+                            mSubscribedState.Unsubscribed();
+                        }
+                    }
                 }
 
-                void SomeIpPubSubServer::onMessageReceived(sd::SomeIpSdMessage &&message)
+                void SomeIpPubSubServer::onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message)
                 {
-                    // Iterate over all the message entry to search for the first Event-group Subscribing entry
-                    for (auto &_entry : message.Entries())
+                    // Iterate over all the message entry records to search for the first Event-group Subscribing entry
+                    for (const auto &_entry : message->EntryRecords())
                     {
-                        if (_entry->Type() == entry::EntryType::Subscribing)
+                        if (_entry.Type == entry::EntryType::Subscribing && matchSubscription(_entry))
                         {
-                            if (auto _eventgroupEntry = dynamic_cast<entry::EventgroupEntry *>(_entry.get()))
-                            {
-                                // Compare service ID, instance ID, major version, and event-group ID
-                                if ((_eventgroupEntry->ServiceId() == mServiceId) &&
-                                    (_eventgroupEntry->InstanceId() == entry::Entry::cAnyInstanceId ||
-                                     _eventgroupEntry->InstanceId() == mInstanceId) &&
-                                    (_eventgroupEntry->MajorVersion() == entry::Entry::cAnyMajorVersion ||
-                                     _eventgroupEntry->MajorVersion() == mMajorVersion) &&
-                                    (_eventgroupEntry->EventgroupId() == mEventgroupId))
-                                {
-                                    if (_eventgroupEntry->TTL() > 0)
-                                    {
-                                        // Subscription
-                                        processEntry(_eventgroupEntry);
-                                    }
-                                    else
-                                    {
-                                        // Unsubscription
-                                        helper::PubSubState _state = GetState();
-                                        if (_state == helper::PubSubState::Subscribed)
-                                        {
-                                            mSubscribedState.Unsubscribed();
-                                        }
-                                    }
-
-                                    return;
-                                }
-                            }
+                            onSubscribe(message, _entry);
+                            return;
                         }
                     }
                 }
 
-                void SomeIpPubSubServer::processEntry(const entry::EventgroupEntry *entry)
+                void SomeIpPubSubServer::processEntry(const entry::EntryRecord &entry)
                 {
                     const bool cDiscardableEndpoint{true};
 
@@ -142,6 +204,15 @@ namespace ara
                 SomeIpPubSubServer::~SomeIpPubSubServer()
                 {
                     Stop();
+
+                    if (mDispatcher)
+                    {
+                        mDispatcher->Unregister(this);
+                    }
+                    else
+                    {
+                        mCommunicationLayer->ResetReceiver(this);
+                    }
                 }
             }
         }
@@ -4,6 +4,7 @@
 #include "../../helper/finite_state_machine.h"
 #include "../../helper/network_layer.h"
 #include "../sd/someip_sd_message.h"
+#include "../sd/someip_sd_dispatcher.h"
 #include "../../entry/eventgroup_entry.h"
 #include "../../option/ipv4_endpoint_option.h"
 #include "./fsm/service_down_state.h"
@@ -24,6 +25,7 @@ namespace ara
                 private:
                     helper::FiniteStateMachine<helper::PubSubState> mStateMachine;
                     helper::NetworkLayer<sd::SomeIpSdMessage> *mCommunicationLayer;
+                    sd::SomeIpSdDispatcher *mDispatcher;
                     const uint16_t mServiceId;
                     const uint16_t mInstanceId;
                     const uint8_t mMajorVersion;
@@ -34,8 +36,22 @@ namespace ara
                     fsm::NotSubscribedState mNotSubscribedState;
                     fsm::SubscribedState mSubscribedState;
 
-                    void onMessageReceived(sd::SomeIpSdMessage &&message);
-                    void processEntry(const entry::EventgroupEntry *entry);
+                    SomeIpPubSubServer(
+                        helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
+                        sd::SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint16_t eventgroupId,
+                        helper::Ipv4Address ipAddress,
+                        uint16_t port);
+
+                    bool matchSubscription(const entry::EntryRecord &entry) const;
+                    void onSubscribe(
+                        const std::shared_ptr<const sd::SomeIpSdMessage> &message,
+                        const entry::EntryRecord &entry);
+                    void onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message);
+                    void processEntry(const entry::EntryRecord &entry);
 
                 public:
                     SomeIpPubSubServer() = delete;
@@ -58,6 +74,23 @@ namespace ara
                         helper::Ipv4Address ipAddress,
                         uint16_t port);
 
+                    /// @brief Constructor
+                    /// @param dispatcher Entry dispatcher which routes only the event-group subscribing entries to the server
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @param majorVersion Service major version
+                    /// @param eventgroupId Service event-group ID
+                    /// @param ipAddress Multicast IP address that clients should listen to for receiving events
+                    /// @param port Multicast port number that clients should listen to for receiving events
+                    SomeIpPubSubServer(
+                        sd::SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint16_t eventgroupId,
+                        helper::Ipv4Address ipAddress,
+                        uint16_t port);
+
                     /// @brief Start the server
                     void Start();
 
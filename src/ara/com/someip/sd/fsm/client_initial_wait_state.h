@@ -19,7 +19,7 @@ namespace ara
                     {
                     protected:
                         void Activate(helper::SdClientState previousState) override;
-                        void SetTimer() override;
+                        void HandleTimer() override;
 
                     public:
                         /// @brief Constructor
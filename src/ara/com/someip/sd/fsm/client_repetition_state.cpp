@@ -32,27 +32,20 @@ namespace ara
                         TimerSetState::Activate(previousState);
                     }
 
-                    void ClientRepetitionState::SetTimer()
+                    void ClientRepetitionState::HandleTimer()
                     {
-                        for (uint32_t i = 0; i < this->RepetitionsMax; ++i)
+                        if (Timer->GetOffered())
                         {
-                            int _doubledDelay = std::pow(2, i) * this->RepetitionsBaseDelay;
-                            auto _delay = std::chrono::milliseconds(_doubledDelay);
-                            bool _interrupted = this->WaitFor(_delay);
-
-                            if (Timer->GetOffered())
-                            {
-                                SetNextState(helper::SdClientState::ServiceReady);
-                                break;
-                            }
-                            else if (_interrupted)
-                            {
-                                break;
-                            }
-                            else
+                            SetNextState(helper::SdClientState::ServiceReady);
+                            Finish();
+                        }
+                        else
+                        {
+                            // Invoke the on timer expiration callback
+                            this->OnTimerExpired();
+                            if (!ScheduleRepetition())
                             {
-                                // Invoke the on timer expiration callback
-                                this->OnTimerExpired();
+                                Finish();
                             }
                         }
                     }
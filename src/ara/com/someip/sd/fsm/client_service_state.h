@@ -15,7 +15,8 @@ namespace ara
                 namespace fsm
                 {
                     /// @brief Abstract client's service state
-                    /// @details The class forces its children to react on service offering.
+                    /// @details The class forces its children to react on service offering. The reaction is driven by the
+                    /// TTL timer signals, so the states do not block any thread while waiting for the next state.
                     /// @note The state is not copyable
                     class ClientServiceState : virtual public helper::MachineState<helper::SdClientState>
                     {
@@ -30,6 +31,13 @@ namespace ara
                         }
 
                     public:
+                        /// @brief React on a change of the requested or offered status, or on the TTL expiration
+                        /// @note The default is no reaction, e.g., for the timer set states which check the offered
+                        /// status on their timer expiration.
+                        virtual void Update()
+                        {
+                        }
+
                         ClientServiceState(const ClientServiceState &) = delete;
                         ClientServiceState &operator=(const ClientServiceState &) = delete;
                         virtual ~ClientServiceState() noexcept = default;
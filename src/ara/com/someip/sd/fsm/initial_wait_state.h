@@ -2,7 +2,6 @@
 #define INITIAL_WAIT_STATE_H
 
 #include <random>
-#include <thread>
 #include <chrono>
 #include "./timer_set_state.h"
 
@@ -37,16 +36,16 @@ namespace ara
                                 InitialDelayMin, InitialDelayMax);
                             int _randomDely = _distribution(_generator);
 
-                            // Sleep for the initali random delay and
-                            // then transit to the next state
+                            // Arm the timer for the initial random delay
                             auto _delay = std::chrono::milliseconds(_randomDely);
-                            bool _interrupted = this->WaitFor(_delay);
+                            this->ScheduleTimer(_delay);
+                        }
 
-                            if (!_interrupted)
-                            {
-                                // Invoke the on timer expiration callback
-                                this->OnTimerExpired();
-                            }
+                        virtual void HandleTimer() override
+                        {
+                            // Invoke the on timer expiration callback and then transit to the next state
+                            this->OnTimerExpired();
+                            this->Finish();
                         }
 
                     public:
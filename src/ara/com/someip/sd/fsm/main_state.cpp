@@ -1,4 +1,3 @@
-#include <thread>
 #include <chrono>
 #include "./main_state.h"
 
@@ -29,20 +28,14 @@ namespace ara
 
                     void MainState::SetTimer()
                     {
-                        while (true)
-                        {
-                            bool _interrupted = this->WaitFor(mCyclicOfferDelay);
+                        this->ScheduleTimer(mCyclicOfferDelay);
+                    }
 
-                            if (_interrupted)
-                            {
-                                break;
-                            }
-                            else
-                            {
-                                // Invoke the on timer expiration callback
-                                this->OnTimerExpired();
-                            }
-                        }
+                    void MainState::HandleTimer()
+                    {
+                        // Invoke the on timer expiration callback and offer again after the cycle
+                        this->OnTimerExpired();
+                        this->ScheduleTimer(mCyclicOfferDelay);
                     }
                 }
             }
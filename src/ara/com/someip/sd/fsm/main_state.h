@@ -22,6 +22,7 @@ namespace ara
 
                     protected:
                         void SetTimer() override;
+                        void HandleTimer() override;
 
                     public:
                         /// @brief Constructor
@@ -1,7 +1,6 @@
 #ifndef REPETITION_STATE_H
 #define REPETITION_STATE_H
 
-#include <thread>
 #include <cmath>
 #include <chrono>
 #include "./timer_set_state.h"
@@ -22,6 +21,9 @@ namespace ara
                     template <typename T>
                     class RepetitionState : public TimerSetState<T>
                     {
+                    private:
+                        int mRepetition;
+
                     protected:
                         /// @brief Maximum iteration in repetition phase
                         const int RepetitionsMax;
@@ -29,23 +31,40 @@ namespace ara
                         /// @brief Repetition iteration delay in milliseconds
                         const int RepetitionsBaseDelay;
 
+                        /// @brief Arm the timer of the next repetition with the doubled delay
+                        /// @returns True if the timer is armed; otherwise false if all the repetitions are done
+                        bool ScheduleRepetition()
+                        {
+                            if (mRepetition >= RepetitionsMax)
+                            {
+                                return false;
+                            }
+
+                            int _doubledDelay = std::pow(2, mRepetition) * RepetitionsBaseDelay;
+                            ++mRepetition;
+
+                            auto _delay = std::chrono::milliseconds(_doubledDelay);
+                            this->ScheduleTimer(_delay);
+
+                            return true;
+                        }
+
                         virtual void SetTimer() override
                         {
-                            for (uint32_t i = 0; i < RepetitionsMax; ++i)
+                            mRepetition = 0;
+                            if (!ScheduleRepetition())
                             {
-                                int _doubledDelay = std::pow(2, i) * RepetitionsBaseDelay;
-                                auto _delay = std::chrono::milliseconds(_doubledDelay);
-                                bool _interrupted = this->WaitFor(_delay);
+                                this->Finish();
+                            }
+                        }
 
-                                if (_interrupted)
-                                {
-                                    break;
-                                }
-                                else
-                                {
-                                    // Invoke the on timer expiration callback
-                                    this->OnTimerExpired();
-                                }
+                        virtual void HandleTimer() override
+                        {
+                            // Invoke the on timer expiration callback
+                            this->OnTimerExpired();
+                            if (!ScheduleRepetition())
+                            {
+                                this->Finish();
                             }
                         }
 
@@ -65,6 +84,7 @@ namespace ara
                             uint32_t repetitionsMax,
                             int repetitionsBaseDelay) : helper::MachineState<T>(currentState),
                                                         TimerSetState<T>(nextState, stoppedState, onTimerExpired),
+                                                        mRepetition{0},
                                                         RepetitionsMax{static_cast<int>(repetitionsMax)},
                                                         RepetitionsBaseDelay{repetitionsBaseDelay}
                         {
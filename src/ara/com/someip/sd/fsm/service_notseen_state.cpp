@@ -21,41 +21,41 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceNotseenState::waitForNextState()
-                    {
-                        if (!Timer->GetRequested() && !Timer->GetOffered())
-                        {
-                            Timer->WaitForSignal();
-                        }
-
-                        if (Timer->GetRequested())
-                        {
-                            return helper::SdClientState::InitialWaitPhase;
-                        }
-                        else
-                        {
-                            return helper::SdClientState::ServiceSeen;
-                        }
-                    }
-
                     void ServiceNotseenState::Activate(helper::SdClientState previousState)
                     {
                         mConditionVariable->notify_one();
+                        Update();
+                    }
 
+                    void ServiceNotseenState::Update()
+                    {
                         // If the sevice client has ever been requested and it is no disposing,
-                        // keep the state flow in the loop by waiting for the timer
+                        // keep the state flow in the loop by reacting on the timer signals
                         if (mEverRequested && !mDisposing)
                         {
-                            helper::SdClientState _nextState = waitForNextState();
-                            Transit(_nextState);
+                            if (Timer->GetRequested())
+                            {
+                                Transit(helper::SdClientState::InitialWaitPhase);
+                            }
+                            else if (Timer->GetOffered())
+                            {
+                                Transit(helper::SdClientState::ServiceSeen);
+                            }
                         }
                     }
 
                     void ServiceNotseenState::RequestService()
                     {
                         mEverRequested = true;
-                        // Due to calling from a separate thread, it is safe to directly transit.
-                        Transit(helper::SdClientState::InitialWaitPhase);
+                        // A service already known to be offered (e.g., from a cache) skips the find phases.
+                        if (Timer->GetOffered())
+                        {
+                            Transit(helper::SdClientState::ServiceReady);
+                        }
+                        else
+                        {
+                            Transit(helper::SdClientState::InitialWaitPhase);
+                        }
                     }
 
                     void ServiceNotseenState::Dispose() noexcept
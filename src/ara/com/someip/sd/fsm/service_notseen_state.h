@@ -1,6 +1,8 @@
 #ifndef SERVICE_NOTSEEN_STATE_H
 #define SERVICE_NOTSEEN_STATE_H
 
+#include <atomic>
+#include <condition_variable>
 #include "./client_service_state.h"
 
 namespace ara
@@ -20,10 +22,8 @@ namespace ara
                     {
                     private:
                         std::condition_variable *const mConditionVariable;
-                        bool mDisposing;
-                        bool mEverRequested;
-
-                        helper::SdClientState waitForNextState();
+                        std::atomic_bool mDisposing;
+                        std::atomic_bool mEverRequested;
 
                     protected:
                         void Deactivate(helper::SdClientState nextState) override;
@@ -42,13 +42,14 @@ namespace ara
 
                         void Activate(helper::SdClientState previousState) override;
 
+                        void Update() override;
+
                         /// @brief Request service client for the first time
-                        /// @note Due to blocking, this function should be called from a separate thread.
                         void RequestService();
 
-                        /// @brief Dispose the state to end the blocking caused by ServiceRequested
+                        /// @brief Dispose the state to stop reacting on the timer signals
                         /// @remarks The side effect of this function call is irreversible.
-                        /// @see ServiceRequested
+                        /// @see RequestService
                         void Dispose() noexcept;
                     };
                 }
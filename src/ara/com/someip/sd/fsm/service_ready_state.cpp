@@ -18,40 +18,33 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceReadyState::waitForNextState()
+                    void ServiceReadyState::Activate(helper::SdClientState previousState)
                     {
-                        bool _expired = false;
-
-                        while (Timer->GetRequested() && Timer->GetOffered())
-                        {
-                            _expired = Timer->WaitForExpiration();
-
-                            if (_expired)
-                            {
-                                break;
-                            }
-                        }
+                        // Notify the condition variable that the service has been offered
+                        mConditionVariable->notify_one();
 
                         if (!Timer->GetRequested())
                         {
-                            return helper::SdClientState::ServiceSeen;
-                        }
-                        else if (_expired)
-                        {
-                            return helper::SdClientState::InitialWaitPhase;
+                            Transit(helper::SdClientState::ServiceSeen);
                         }
-                        else
+                        else if (!Timer->GetOffered())
                         {
-                            return helper::SdClientState::Stopped;
+                            // The offer has been already stopped before getting ready.
+                            Transit(helper::SdClientState::Stopped);
                         }
                     }
 
-                    void ServiceReadyState::Activate(helper::SdClientState previousState)
+                    void ServiceReadyState::Update()
                     {
-                        // Notify the condition variable that the service has been offered
-                        mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
+                        if (!Timer->GetRequested())
+                        {
+                            Transit(helper::SdClientState::ServiceSeen);
+                        }
+                        else if (!Timer->GetOffered())
+                        {
+                            // The offer is stopped or its TTL is expired, so find the service again.
+                            Transit(helper::SdClientState::InitialWaitPhase);
+                        }
                     }
 
                     void ServiceReadyState::Deactivate(helper::SdClientState nextState)
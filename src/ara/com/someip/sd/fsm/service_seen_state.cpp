@@ -18,36 +18,25 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceSeenState::waitForNextState()
+                    void ServiceSeenState::Activate(helper::SdClientState previousState)
                     {
-                        while (!Timer->GetRequested() && Timer->GetOffered())
-                        {
-                            bool _expired = Timer->WaitForExpiration();
-
-                            if (_expired)
-                            {
-                                break;
-                            }
-                        }
+                        mConditionVariable->notify_one();
+                        Update();
+                    }
 
+                    void ServiceSeenState::Update()
+                    {
                         if (Timer->GetRequested())
                         {
-                            return helper::SdClientState::ServiceReady;
+                            Transit(helper::SdClientState::ServiceReady);
                         }
-                        else
+                        else if (!Timer->GetOffered())
                         {
                             // The service is not offering anymore or the TTL is expired:
-                            return helper::SdClientState::ServiceNotSeen;
+                            Transit(helper::SdClientState::ServiceNotSeen);
                         }
                     }
 
-                    void ServiceSeenState::Activate(helper::SdClientState previousState)
-                    {
-                        mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
-                    }
-
                     void ServiceSeenState::Deactivate(helper::SdClientState nextState)
                     {
                     }
@@ -18,31 +18,25 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState StoppedState::waitForNextState()
+                    void StoppedState::Activate(helper::SdClientState previousState)
                     {
-                        if (Timer->GetRequested() && !Timer->GetOffered())
-                        {
-                            Timer->WaitForSignal();
-                        }
+                        // Notify the condition variable that the service is not offered yet
+                        mConditionVariable->notify_one();
+                        Update();
+                    }
 
+                    void StoppedState::Update()
+                    {
                         if (!Timer->GetRequested())
                         {
-                            return helper::SdClientState::ServiceNotSeen;
+                            Transit(helper::SdClientState::ServiceNotSeen);
                         }
-                        else
+                        else if (Timer->GetOffered())
                         {
-                            return helper::SdClientState::ServiceReady;
+                            Transit(helper::SdClientState::ServiceReady);
                         }
                     }
 
-                    void StoppedState::Activate(helper::SdClientState previousState)
-                    {
-                        // Notify the condition variable that the service is not offered yet
-                        mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
-                    }
-
                     void StoppedState::Deactivate(helper::SdClientState nextState)
                     {
                     }
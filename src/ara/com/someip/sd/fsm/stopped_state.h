@@ -1,6 +1,7 @@
 #ifndef STOPPED_STATE_H
 #define STOPPED_STATE_H
 
+#include <condition_variable>
 #include "./client_service_state.h"
 
 namespace ara
@@ -20,8 +21,6 @@ namespace ara
                     private:
                         std::condition_variable *const mConditionVariable;
 
-                        helper::SdClientState waitForNextState();
-
                     protected:
                         void Deactivate(helper::SdClientState nextState) override;
 
@@ -38,6 +37,8 @@ namespace ara
                         StoppedState &operator=(const StoppedState &) = delete;
 
                         void Activate(helper::SdClientState previousState) override;
+
+                        void Update() override;
                     };
                 }
             }
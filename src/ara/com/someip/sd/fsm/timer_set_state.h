@@ -1,8 +1,12 @@
 #ifndef TIMER_SET_STATE_H
 #define TIMER_SET_STATE_H
 
+#include <chrono>
+#include <functional>
+#include <mutex>
 #include <stdexcept>
 #include "../../../helper/machine_state.h"
+#include "../../../helper/timer_wheel.h"
 
 namespace ara
 {
@@ -18,7 +22,10 @@ namespace ara
                 {
                     /// @brief Server's or client's service timer set state
                     /// @tparam T Server's or client state enumeration type
-                    /// @note The state is not copyable
+                    /// @details The phase timers are one-shot timers of the shared timer wheel, so no thread is blocked
+                    /// during a phase. The activation arms the first timer, and each expiration either arms the next
+                    /// timer or finishes the phase from the wheel thread.
+                    /// @note The state is not copyable, and an active state should be stopped before its destruction.
                     template <typename T>
                     class TimerSetState : virtual public helper::MachineState<T>
                     {
@@ -26,58 +33,108 @@ namespace ara
                         const T mStoppedState;
                         T mNextState;
                         bool mStopped;
-                        bool mInterrupted;
+                        helper::TimerWheel::TimerId mTimer;
+                        std::mutex mMutex;
 
-                        void setTimerBase()
+                        void transit(T nextState, helper::TimerWheel::TimerId timer)
                         {
-                            SetTimer();
-                            // Transition to the next state or to the stopped state
-                            if (mStopped)
+                            helper::MachineState<T>::Transit(nextState);
+
+                            // The firing timer is released after the transition, so a concurrent stop waits for it.
+                            std::lock_guard<std::mutex> _lock(mMutex);
+                            if (mTimer == timer)
+                            {
+                                mTimer = helper::TimerWheel::cInvalidTimer;
+                            }
+                        }
+
+                        void onTimerExpired()
+                        {
+                            helper::TimerWheel::TimerId _timer;
+                            bool _stopped;
                             {
-                                helper::MachineState<T>::Transit(mStoppedState);
+                                std::lock_guard<std::mutex> _lock(mMutex);
+                                _timer = mTimer;
+                                _stopped = mStopped;
+                            }
+
+                            if (_stopped)
+                            {
+                                // The stop could not cancel the firing timer, so the transition is left to the callback.
+                                transit(mStoppedState, _timer);
                             }
                             else
                             {
-                                helper::MachineState<T>::Transit(mNextState);
+                                HandleTimer();
                             }
                         }
 
                     protected:
-                        /// @brief Wait for certian period of time
-                        /// @param duration Waiting duration
-                        /// @returns True if waiting is interrupted; otherwise false if timeout occurs
-                        bool WaitFor(std::chrono::milliseconds duration)
+                        /// @brief Arm the phase timer
+                        /// @param duration Delay after which the timer expires
+                        /// @note If the state is already stopped, it transits to the stopped state instead.
+                        void ScheduleTimer(std::chrono::milliseconds duration)
                         {
-                            std::this_thread::sleep_for(duration);
-                            bool _result = mStopped || mInterrupted;
-
-                            return _result;
+                            std::unique_lock<std::mutex> _lock(mMutex);
+                            if (mStopped)
+                            {
+                                const helper::TimerWheel::TimerId cTimer = mTimer;
+                                _lock.unlock();
+                                transit(mStoppedState, cTimer);
+                            }
+                            else
+                            {
+                                mTimer =
+                                    helper::TimerWheel::Shared().Schedule(
+                                        duration,
+                                        std::bind(&TimerSetState::onTimerExpired, this));
+                            }
                         }
 
-                        /// @brief Wait for certian period of time
-                        /// @param duration Waiting duration in milliseconds
-                        /// @returns True if waiting is interrupted; otherwise false if timeout occurs
-                        bool WaitFor(int duration)
+                        /// @brief Finish the phase by transiting to the next state, or to the stopped state if stopped
+                        void Finish()
                         {
-                            auto _milliseconds = std::chrono::milliseconds(duration);
-                            bool _result = WaitFor(_milliseconds);
+                            helper::TimerWheel::TimerId _timer;
+                            bool _stopped;
+                            {
+                                std::lock_guard<std::mutex> _lock(mMutex);
+                                _timer = mTimer;
+                                _stopped = mStopped;
+                            }
 
-                            return _result;
+                            transit(_stopped ? mStoppedState : mNextState, _timer);
                         }
 
                         /// @brief Interrupt the timer
                         /// @remark If the timer is interrupted, it should transit to the next state.
-                        void Interrupt() noexcept
+                        void Interrupt()
                         {
-                            mInterrupted = true;
+                            helper::TimerWheel::TimerId _timer;
+                            {
+                                std::lock_guard<std::mutex> _lock(mMutex);
+                                _timer = mStopped ? helper::TimerWheel::cInvalidTimer : mTimer;
+                            }
+
+                            if (_timer != helper::TimerWheel::cInvalidTimer &&
+                                helper::TimerWheel::Shared().Cancel(_timer))
+                            {
+                                transit(mNextState, _timer);
+                            }
                         }
 
                         /// @brief Delegate which is invoked by timer's thread when the timer is expired
                         const std::function<void()> OnTimerExpired;
 
-                        /// @brief Set the phase time on state activation
+                        /// @brief Arm the phase timer on state activation
+                        /// @see ScheduleTimer
                         virtual void SetTimer() = 0;
 
+                        /// @brief Handle the phase timer expiration from the wheel thread
+                        /// @note The handler should either arm the next timer or finish the phase.
+                        /// @see ScheduleTimer
+                        /// @see Finish
+                        virtual void HandleTimer() = 0;
+
                         /// @brief Constructor
                         /// @param nextState Next state after initial wait phase expiration
                         /// @param stoppedState Default stopped state after put a stop to the service
@@ -89,14 +146,13 @@ namespace ara
                                                                     mStoppedState{stoppedState},
                                                                     OnTimerExpired{onTimerExpired},
                                                                     mStopped{false},
-                                                                    mInterrupted{false}
+                                                                    mTimer{helper::TimerWheel::cInvalidTimer}
                         {
                         }
 
                         void Deactivate(T nextState) override
                         {
-                            // Reset 'service interrupted' flag
-                            mInterrupted = false;
+                            std::lock_guard<std::mutex> _lock(mMutex);
                             // Reset 'service stopped' flag
                             mStopped = false;
                         }
@@ -107,16 +163,27 @@ namespace ara
 
                         virtual void Activate(T previousState) override
                         {
-                            if (!mStopped)
-                            {
-                                setTimerBase();
-                            }
+                            SetTimer();
                         }
 
                         /// @brief Inform the state that the server's service is stopped
-                        void ServiceStopped() noexcept
+                        /// @note If the state is active, the pending timer is cancelled at once and the state transits
+                        /// to the stopped state before returning.
+                        void ServiceStopped()
                         {
-                            mStopped = true;
+                            helper::TimerWheel::TimerId _timer;
+                            {
+                                std::lock_guard<std::mutex> _lock(mMutex);
+                                mStopped = true;
+                                _timer = mTimer;
+                            }
+
+                            // A firing timer cannot be cancelled, so its callback has transited by the time the cancellation returns.
+                            if (_timer != helper::TimerWheel::cInvalidTimer &&
+                                helper::TimerWheel::Shared().Cancel(_timer))
+                            {
+                                transit(mStoppedState, _timer);
+                            }
                         }
 
                         /// @brief Set next state
@@ -128,8 +195,15 @@ namespace ara
 
                         virtual ~TimerSetState() override
                         {
-                            // Set a fake stop signal, otherwise the timer loop may never end (e.g., in the main phase).
-                            ServiceStopped();
+                            helper::TimerWheel::TimerId _timer;
+                            {
+                                std::lock_guard<std::mutex> _lock(mMutex);
+                                mStopped = true;
+                                _timer = mTimer;
+                            }
+
+                            // Cancel the pending timer, otherwise it may fire after the destruction.
+                            helper::TimerWheel::Shared().Cancel(_timer);
                         }
                     };
                 }
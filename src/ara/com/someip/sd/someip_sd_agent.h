@@ -5,6 +5,7 @@
 #include "../../helper/finite_state_machine.h"
 #include "../../helper/network_layer.h"
 #include "./someip_sd_message.h"
+#include "./someip_sd_dispatcher.h"
 
 namespace ara
 {
@@ -29,6 +30,9 @@ namespace ara
                     /// @brief Network communication abstraction layer
                     helper::NetworkLayer<SomeIpSdMessage> *CommunicationLayer;
 
+                    /// @brief Entry dispatcher, or null if the agent receives the whole messages
+                    SomeIpSdDispatcher *Dispatcher;
+
                     /// @brief Start the service discovery agent
                     /// @param state Current FSM state before start
                     virtual void StartAgent(T state) = 0;
@@ -40,8 +44,11 @@ namespace ara
                 public:
                     /// @brief Constructor
                     /// @param networkLayer Network communication abstraction layer
+                    /// @param dispatcher Entry dispatcher over the network layer, or null to receive the whole messages
                     SomeIpSdAgent(
-                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer) : CommunicationLayer{networkLayer}
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                        SomeIpSdDispatcher *dispatcher = nullptr) : CommunicationLayer{networkLayer},
+                                                                    Dispatcher{dispatcher}
                     {
                     }
 
@@ -82,7 +89,14 @@ namespace ara
                     /// @note It is safe to recall the function if the agent has been already stopped.
                     void Stop()
                     {
-                        CommunicationLayer->ResetReceiver(this);
+                        if (Dispatcher)
+                        {
+                            Dispatcher->Unregister(this);
+                        }
+                        else
+                        {
+                            CommunicationLayer->ResetReceiver(this);
+                        }
                         StopAgent();
                     }
 
@@ -15,7 +15,39 @@ namespace ara
                     int initialDelayMin,
                     int initialDelayMax,
                     int repetitionBaseDelay,
-                    uint32_t repetitionMax) : SomeIpSdAgent<helper::SdClientState>(networkLayer),
+                    uint32_t repetitionMax,
+                    const SomeIpSdServiceRegistry *registry) : SomeIpSdClient(
+                                                                   networkLayer, nullptr, serviceId,
+                                                                   initialDelayMin, initialDelayMax,
+                                                                   repetitionBaseDelay, repetitionMax,
+                                                                   registry)
+                {
+                }
+
+                SomeIpSdClient::SomeIpSdClient(
+                    SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    uint32_t repetitionMax,
+                    const SomeIpSdServiceRegistry *registry) : SomeIpSdClient(
+                                                                   dispatcher->GetNetworkLayer(), dispatcher, serviceId,
+                                                                   initialDelayMin, initialDelayMax,
+                                                                   repetitionBaseDelay, repetitionMax,
+                                                                   registry)
+                {
+                }
+
+                SomeIpSdClient::SomeIpSdClient(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                    SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    uint32_t repetitionMax,
+                    const SomeIpSdServiceRegistry *registry) : SomeIpSdAgent<helper::SdClientState>(networkLayer, dispatcher),
                                               mValidState{true},
                                               mServiceNotseenState(&mTtlTimer, &mStopOfferingConditionVariable),
                                               mServiceSeenState(&mTtlTimer, &mOfferingConditionVariable),
@@ -33,8 +65,11 @@ namespace ara
                                               mServiceReadyState(&mTtlTimer, &mOfferingConditionVariable),
                                               mOfferingLock(mOfferingMutex, std::defer_lock),
                                               mStopOfferingLock(mStopOfferingMutex, std::defer_lock),
-                                              mServiceId{serviceId}
+                                              mServiceId{serviceId},
+                                              mRegistry{registry}
                 {
+                    mTtlTimer.SetHandler(std::bind(&SomeIpSdClient::onTimerSignal, this));
+
                     this->StateMachine.Initialize(
                         {&mServiceNotseenState,
                          &mServiceSeenState,
@@ -47,12 +82,30 @@ namespace ara
                     auto _findServiceEntry{entry::ServiceEntry::CreateFindServiceEntry(serviceId)};
                     mFindServieMessage.AddEntry(std::move(_findServiceEntry));
 
-                    auto _receiver =
-                        std::bind(
-                            &SomeIpSdClient::receiveSdMessage,
+                    if (dispatcher)
+                    {
+                        auto _handler =
+                            std::bind(
+                                &SomeIpSdClient::onOffer,
+                                this,
+                                std::placeholders::_1,
+                                std::placeholders::_2);
+                        this->Dispatcher->Register(
                             this,
-                            std::placeholders::_1);
-                    this->CommunicationLayer->SetReceiver(this, _receiver);
+                            entry::EntryType::Offering,
+                            serviceId,
+                            entry::Entry::cAnyInstanceId,
+                            _handler);
+                    }
+                    else
+                    {
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpSdClient::receiveSdMessage,
+                                this,
+                                std::placeholders::_1);
+                        this->CommunicationLayer->SetReceiver(this, _receiver);
+                    }
                 }
 
                 void SomeIpSdClient::sendFind()
@@ -64,23 +117,20 @@ namespace ara
                 bool SomeIpSdClient::matchRequestedService(
                     const SomeIpSdMessage &message, uint32_t &ttl) const
                 {
-                    // Iterate over all the message entry to search for the first Service Offering entry
-                    for (auto &_entry : message.Entries())
+                    // Iterate over all the message entry records to search for the first Service Offering entry
+                    for (const auto &_entry : message.EntryRecords())
                     {
-                        if (_entry->Type() == entry::EntryType::Offering)
+                        if (_entry.Type == entry::EntryType::Offering)
                         {
-                            if (auto _serviceEnty = dynamic_cast<entry::ServiceEntry *>(_entry.get()))
-                            {
-                                // Compare service ID
-                                bool _result = _serviceEnty->ServiceId() == mServiceId;
-
-                                if (_result)
-                                {
-                                    ttl = _serviceEnty->TTL();
-                                }
+                            // Compare service ID
+                            bool _result = _entry.ServiceId == mServiceId;
 
-                                return _result;
+                            if (_result)
+                            {
+                                ttl = _entry.TTL;
                             }
+
+                            return _result;
                         }
                     }
 
@@ -92,13 +142,24 @@ namespace ara
                     mTtlTimer.SetOffered(ttl);
                 }
 
-                void SomeIpSdClient::receiveSdMessage(SomeIpSdMessage &&message)
+                void SomeIpSdClient::onOffer(
+                    const std::shared_ptr<const SomeIpSdMessage> & /*message*/,
+                    const entry::EntryRecord &entry)
+                {
+                    // While destruction, ignore dispatched entries
+                    if (mValidState && entry.ServiceId == mServiceId)
+                    {
+                        onOfferChanged(entry.TTL);
+                    }
+                }
+
+                void SomeIpSdClient::receiveSdMessage(std::shared_ptr<const SomeIpSdMessage> message)
                 {
                     // While destruction, ignore communication layer received messages
                     if (mValidState)
                     {
                         uint32_t _ttl;
-                        bool _matches = matchRequestedService(message, _ttl);
+                        bool _matches = matchRequestedService(*message, _ttl);
                         if (_matches)
                         {
                             onOfferChanged(_ttl);
@@ -106,8 +167,70 @@ namespace ara
                     }
                 }
 
+                fsm::ClientServiceState *SomeIpSdClient::getServiceState(helper::SdClientState state) noexcept
+                {
+                    switch (state)
+                    {
+                    case helper::SdClientState::ServiceNotSeen:
+                        return &mServiceNotseenState;
+                    case helper::SdClientState::ServiceSeen:
+                        return &mServiceSeenState;
+                    case helper::SdClientState::ServiceReady:
+                        return &mServiceReadyState;
+                    case helper::SdClientState::Stopped:
+                        return &mStoppedState;
+                    case helper::SdClientState::InitialWaitPhase:
+                        return &mInitialWaitState;
+                    case helper::SdClientState::RepetitionPhase:
+                        return &mRepetitionState;
+                    default:
+                        return nullptr;
+                    }
+                }
+
+                void SomeIpSdClient::onTimerSignal()
+                {
+                    // The current state reacts from the signaling thread. If the state has been changed meanwhile,
+                    // the reaction is ignored by the FSM and the newly activated state checks the timer by itself.
+                    fsm::ClientServiceState *_state{getServiceState(GetState())};
+                    if (_state)
+                    {
+                        _state->Update();
+                    }
+                }
+
+                bool SomeIpSdClient::isOffered() const noexcept
+                {
+                    // The ready state is expected while the service is requested; otherwise the seen state.
+                    helper::SdClientState _state = GetState();
+                    bool _result =
+                        mTtlTimer.GetRequested() ? _state == helper::SdClientState::ServiceReady
+                                                 : _state == helper::SdClientState::ServiceSeen;
+
+                    return _result;
+                }
+
+                bool SomeIpSdClient::isStopped() const noexcept
+                {
+                    // The stopped state is expected while the service is requested; otherwise the not-seen state.
+                    helper::SdClientState _state = GetState();
+                    bool _result =
+                        mTtlTimer.GetRequested() ? _state == helper::SdClientState::Stopped
+                                                 : _state == helper::SdClientState::ServiceNotSeen;
+
+                    return _result;
+                }
+
                 void SomeIpSdClient::StartAgent(helper::SdClientState state)
                 {
+                    ServiceInstance _instance;
+                    if (mRegistry && !mTtlTimer.GetOffered() &&
+                        mRegistry->TryFind(mServiceId, _instance))
+                    {
+                        // Answer the request from the cached offer, so the find phases are skipped.
+                        mTtlTimer.SetOffered(_instance.TTL);
+                    }
+
                     mTtlTimer.SetRequested(true);
 
                     // Set the future if has not been set already
@@ -127,12 +250,19 @@ namespace ara
                     {
                         // Dispose the entry point state to stop the service offer monitoring
                         mServiceNotseenState.Dispose();
-                        // Dispose the TTL timer to singal all the states for stopping immediately
+                        // Dispose the TTL timer to cancel its pending expiration
                         mTtlTimer.Dispose();
                     }
 
                     // Send a synchronized cancel signal to all the state
                     mTtlTimer.SetRequested(false);
+
+                    if (!mValidState)
+                    {
+                        // Cancel the pending phase timers, so no timer fires after the destruction.
+                        mInitialWaitState.ServiceStopped();
+                        mRepetitionState.ServiceStopped();
+                    }
                 }
 
                 bool SomeIpSdClient::TryWaitUntiServiceOffered(int duration)
@@ -146,8 +276,14 @@ namespace ara
                         mOfferingLock.lock();
                         if (duration > 0)
                         {
-                            _cvStatus = mOfferingConditionVariable.wait_for(
-                                mOfferingLock, std::chrono::milliseconds(duration));
+                            // An offer answered from the cache may be notified before the waiting starts.
+                            bool _offered =
+                                mOfferingConditionVariable.wait_for(
+                                    mOfferingLock,
+                                    std::chrono::milliseconds(duration),
+                                    [this]()
+                                    { return isOffered() || !mValidState; });
+                            _cvStatus = _offered ? std::cv_status::no_timeout : std::cv_status::timeout;
                         }
                         else
                         {
@@ -184,9 +320,14 @@ namespace ara
                         mStopOfferingLock.lock();
                         if (duration > 0)
                         {
-                            _cvStatus =
+                            // The stop may be notified before the waiting starts.
+                            bool _stopped =
                                 mStopOfferingConditionVariable.wait_for(
-                                    mStopOfferingLock, std::chrono::milliseconds(duration));
+                                    mStopOfferingLock,
+                                    std::chrono::milliseconds(duration),
+                                    [this]()
+                                    { return isStopped() || !mValidState; });
+                            _cvStatus = _stopped ? std::cv_status::no_timeout : std::cv_status::timeout;
                         }
                         else
                         {
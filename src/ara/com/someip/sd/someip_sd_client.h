@@ -11,6 +11,7 @@
 #include "./fsm/service_ready_state.h"
 #include "./fsm/stopped_state.h"
 #include "./someip_sd_agent.h"
+#include "./someip_sd_service_registry.h"
 
 namespace ara
 {
@@ -21,6 +22,8 @@ namespace ara
             namespace sd
             {
                 /// @brief SOME/IP service discovery client
+                /// @details If the client is given a service registry which already knows a live instance of the service,
+                /// the client becomes ready right at start with the cached offer TTL instead of sending finds.
                 class SomeIpSdClient : public SomeIpSdAgent<helper::SdClientState>
                 {
                 private:
@@ -40,12 +43,31 @@ namespace ara
                     fsm::ServiceReadyState mServiceReadyState;
                     SomeIpSdMessage mFindServieMessage;
                     const uint16_t mServiceId;
+                    const SomeIpSdServiceRegistry *const mRegistry;
+
+                    SomeIpSdClient(
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                        SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        uint32_t repetitionMax,
+                        const SomeIpSdServiceRegistry *registry);
+
+                    bool isOffered() const noexcept;
+                    bool isStopped() const noexcept;
+                    fsm::ClientServiceState *getServiceState(helper::SdClientState state) noexcept;
+                    void onTimerSignal();
 
                     void sendFind();
                     bool matchRequestedService(
                         const SomeIpSdMessage &message, uint32_t &ttl) const;
                     void onOfferChanged(uint32_t ttl);
-                    void receiveSdMessage(SomeIpSdMessage &&message);
+                    void onOffer(
+                        const std::shared_ptr<const SomeIpSdMessage> &message,
+                        const entry::EntryRecord &entry);
+                    void receiveSdMessage(std::shared_ptr<const SomeIpSdMessage> message);
 
                 protected:
                     void StartAgent(helper::SdClientState state) override;
@@ -61,13 +83,32 @@ namespace ara
                     /// @param initialDelayMax Maximum initial delay
                     /// @param repetitionBaseDelay Repetition phase delay
                     /// @param repetitionMax Maximum message count in the repetition phase
+                    /// @param registry Service registry to be looked up at start, or null to always find the service
                     SomeIpSdClient(
                         helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
                         uint16_t serviceId,
                         int initialDelayMin,
                         int initialDelayMax,
                         int repetitionBaseDelay,
-                        uint32_t repetitionMax);
+                        uint32_t repetitionMax,
+                        const SomeIpSdServiceRegistry *registry = nullptr);
+
+                    /// @brief Constructor
+                    /// @param dispatcher Entry dispatcher which routes only the service offering entries to the client
+                    /// @param serviceId Server's service ID
+                    /// @param initialDelayMin Minimum initial delay
+                    /// @param initialDelayMax Maximum initial delay
+                    /// @param repetitionBaseDelay Repetition phase delay
+                    /// @param repetitionMax Maximum message count in the repetition phase
+                    /// @param registry Service registry to be looked up at start, or null to always find the service
+                    SomeIpSdClient(
+                        SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        uint32_t repetitionMax,
+                        const SomeIpSdServiceRegistry *registry = nullptr);
 
                     /// @brief Try to wait unitl the server offers the service
                     /// @param duration Waiting timeout in milliseconds
@@ -0,0 +1,223 @@
+#include <stdexcept>
+#include "./someip_sd_dispatcher.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                const uint8_t SomeIpSdDispatcher::cTypeKeyOffset;
+
+                SomeIpSdDispatcher::SomeIpSdDispatcher(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer) : mNetworkLayer{networkLayer}
+                {
+                    auto _receiver =
+                        std::bind(
+                            &SomeIpSdDispatcher::onPayloadReceived,
+                            this,
+                            std::placeholders::_1,
+                            std::placeholders::_2);
+                    mNetworkLayer->SetPayloadReceiver(this, _receiver);
+                }
+
+                uint64_t SomeIpSdDispatcher::getKey(
+                    entry::EntryType type,
+                    uint16_t serviceId,
+                    uint16_t eventgroupId) noexcept
+                {
+                    uint64_t _result =
+                        (static_cast<uint64_t>(type) << cTypeKeyOffset) |
+                        (static_cast<uint64_t>(serviceId) << 16) |
+                        static_cast<uint64_t>(eventgroupId);
+
+                    return _result;
+                }
+
+                uint64_t SomeIpSdDispatcher::getKey(const entry::EntryRecord &entry) noexcept
+                {
+                    // Service entries are not bound to any event-group.
+                    const uint16_t cServiceEntryEventgroupId = 0;
+
+                    if (entry.IsEventgroupEntry())
+                    {
+                        return getKey(entry.Type, entry.ServiceId, entry.Eventgroup.EventgroupId);
+                    }
+                    else
+                    {
+                        return getKey(entry.Type, entry.ServiceId, cServiceEntryEventgroupId);
+                    }
+                }
+
+                std::shared_ptr<const SomeIpSdDispatcher::Table> SomeIpSdDispatcher::makeTable(
+                    Buckets &&registrations)
+                {
+                    // Only the raw entries of the registered types are decoded at the dispatch.
+                    SomeIpSdMessageView::EntryFilter _filter{std::initializer_list<entry::EntryType>{}};
+                    for (const auto &_bucket : registrations)
+                    {
+                        _filter.Include(static_cast<entry::EntryType>(_bucket.first >> cTypeKeyOffset));
+                    }
+
+                    auto _result{std::make_shared<Table>(Table{std::move(registrations), _filter})};
+
+                    return _result;
+                }
+
+                void SomeIpSdDispatcher::onPayloadReceived(const uint8_t *data, std::size_t size)
+                {
+                    helper::DispatchEpoch::Scope _dispatchScope(mDispatchEpoch);
+                    std::shared_ptr<const Table> _table{std::atomic_load(&mTable)};
+                    if (!_table || _table->Registrations.empty())
+                    {
+                        return;
+                    }
+
+                    SomeIpSdMessageView _view(data, size);
+                    if (!_view.IsValid())
+                    {
+                        return;
+                    }
+
+                    // The message is materialized on the first matched handler and shared with the rest.
+                    std::shared_ptr<const SomeIpSdMessage> _message;
+
+                    for (const auto &_entry : _view.Entries(_table->Filter))
+                    {
+                        auto _itr = _table->Registrations.find(getKey(_entry));
+                        if (_itr == _table->Registrations.end())
+                        {
+                            continue;
+                        }
+
+                        for (const auto &_registration : _itr->second)
+                        {
+                            if (_registration.InstanceId == entry::Entry::cAnyInstanceId ||
+                                _entry.InstanceId == entry::Entry::cAnyInstanceId ||
+                                _entry.InstanceId == _registration.InstanceId)
+                            {
+                                if (!_message)
+                                {
+                                    auto _decoded{
+                                        helper::MessageTraits<SomeIpSdMessage>::Decode(data, size)};
+
+                                    if (!_decoded.HasValue())
+                                    {
+                                        // The view only validates the layout, so the content can still be malformed.
+                                        return;
+                                    }
+
+                                    _message = std::move(_decoded).Value();
+                                }
+
+                                _registration.Handler(_message, _entry);
+                            }
+                        }
+                    }
+                }
+
+                helper::NetworkLayer<SomeIpSdMessage> *SomeIpSdDispatcher::GetNetworkLayer() const noexcept
+                {
+                    return mNetworkLayer;
+                }
+
+                void SomeIpSdDispatcher::registerHandler(
+                    void *object,
+                    uint64_t key,
+                    uint16_t instanceId,
+                    EntryHandler handler)
+                {
+                    std::lock_guard<std::mutex> _lock(mTableMutex);
+
+                    std::shared_ptr<const Table> _current{std::atomic_load(&mTable)};
+                    Buckets _registrations;
+                    if (_current)
+                    {
+                        _registrations = _current->Registrations;
+                    }
+
+                    Registration _registration{object, instanceId, std::move(handler)};
+                    _registrations[key].push_back(std::move(_registration));
+
+                    std::atomic_store(&mTable, makeTable(std::move(_registrations)));
+                }
+
+                void SomeIpSdDispatcher::Register(
+                    void *object,
+                    entry::EntryType type,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    EntryHandler handler)
+                {
+                    const uint16_t cServiceEntryEventgroupId = 0;
+
+                    if (type != entry::EntryType::Finding && type != entry::EntryType::Offering)
+                    {
+                        throw std::invalid_argument("The entry type is not a service entry type.");
+                    }
+
+                    uint64_t _key = getKey(type, serviceId, cServiceEntryEventgroupId);
+                    registerHandler(object, _key, instanceId, std::move(handler));
+                }
+
+                void SomeIpSdDispatcher::Register(
+                    void *object,
+                    entry::EntryType type,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint16_t eventgroupId,
+                    EntryHandler handler)
+                {
+                    if (type != entry::EntryType::Subscribing && type != entry::EntryType::Acknowledging)
+                    {
+                        throw std::invalid_argument("The entry type is not an event-group entry type.");
+                    }
+
+                    uint64_t _key = getKey(type, serviceId, eventgroupId);
+                    registerHandler(object, _key, instanceId, std::move(handler));
+                }
+
+                void SomeIpSdDispatcher::Unregister(void *object)
+                {
+                    std::lock_guard<std::mutex> _lock(mTableMutex);
+
+                    std::shared_ptr<const Table> _current{std::atomic_load(&mTable)};
+                    if (!_current)
+                    {
+                        return;
+                    }
+
+                    Buckets _registrations;
+                    for (const auto &_bucket : _current->Registrations)
+                    {
+                        std::vector<Registration> _bucketRegistrations;
+                        for (const auto &_registration : _bucket.second)
+                        {
+                            if (_registration.Object != object)
+                            {
+                                _bucketRegistrations.push_back(_registration);
+                            }
+                        }
+
+                        if (!_bucketRegistrations.empty())
+                        {
+                            _registrations[_bucket.first] = std::move(_bucketRegistrations);
+                        }
+                    }
+
+                    std::atomic_store(&mTable, makeTable(std::move(_registrations)));
+
+                    // Wait for the grace period in which the dispatches may still hold any older snapshot
+                    mDispatchEpoch.Synchronize();
+                }
+
+                SomeIpSdDispatcher::~SomeIpSdDispatcher()
+                {
+                    mNetworkLayer->ResetReceiver(this);
+                }
+            }
+        }
+    }
+}
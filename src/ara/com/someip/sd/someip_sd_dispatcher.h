@@ -0,0 +1,128 @@
+#ifndef SOMEIP_SD_DISPATCHER_H
+#define SOMEIP_SD_DISPATCHER_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "../../helper/dispatch_epoch.h"
+#include "../../helper/network_layer.h"
+#include "./someip_sd_message.h"
+#include "./someip_sd_message_view.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief SOME/IP service discovery entry-level demultiplexer
+                /// @details The dispatcher is the only receiver of a network layer. It indexes the registered
+                /// agents in a hash table by the entry type, service ID and event-group ID, and delivers
+                /// each received entry only to the agents with a matching service instance in a single pass.
+                /// The entries are routed on a view of the raw payload, and the message is only deserialized
+                /// once an entry has matched a handler, so the traffic of no interest is never materialized.
+                /// The table is kept in a copy-on-write snapshot like the network layer receivers.
+                class SomeIpSdDispatcher
+                {
+                public:
+                    /// @brief Entry handler type which receives the whole shared message and the routed entry
+                    using EntryHandler =
+                        std::function<void(const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &)>;
+
+                private:
+                    struct Registration
+                    {
+                        void *Object;
+                        uint16_t InstanceId;
+                        EntryHandler Handler;
+                    };
+
+                    static const uint8_t cTypeKeyOffset = 32;
+
+                    using Buckets = std::unordered_map<uint64_t, std::vector<Registration>>;
+
+                    struct Table
+                    {
+                        Buckets Registrations;
+                        SomeIpSdMessageView::EntryFilter Filter;
+                    };
+
+                    helper::NetworkLayer<SomeIpSdMessage> *mNetworkLayer;
+                    std::shared_ptr<const Table> mTable;
+                    std::mutex mTableMutex;
+                    helper::DispatchEpoch mDispatchEpoch;
+
+                    static uint64_t getKey(
+                        entry::EntryType type,
+                        uint16_t serviceId,
+                        uint16_t eventgroupId) noexcept;
+                    static uint64_t getKey(const entry::EntryRecord &entry) noexcept;
+                    static std::shared_ptr<const Table> makeTable(Buckets &&registrations);
+                    void onPayloadReceived(const uint8_t *data, std::size_t size);
+                    void registerHandler(
+                        void *object,
+                        uint64_t key,
+                        uint16_t instanceId,
+                        EntryHandler handler);
+
+                public:
+                    SomeIpSdDispatcher() = delete;
+                    SomeIpSdDispatcher(const SomeIpSdDispatcher &) = delete;
+                    SomeIpSdDispatcher &operator=(const SomeIpSdDispatcher &) = delete;
+
+                    /// @brief Constructor
+                    /// @param networkLayer Network communication abstraction layer to receive from
+                    explicit SomeIpSdDispatcher(helper::NetworkLayer<SomeIpSdMessage> *networkLayer);
+
+                    ~SomeIpSdDispatcher();
+
+                    /// @brief Get the underlying network layer
+                    /// @returns Network communication abstraction layer for sending messages
+                    helper::NetworkLayer<SomeIpSdMessage> *GetNetworkLayer() const noexcept;
+
+                    /// @brief Register a service entry handler
+                    /// @param object Object that owns the handler
+                    /// @param type Service entry type of interest (i.e., finding or offering)
+                    /// @param serviceId Service ID of interest
+                    /// @param instanceId Service instance ID of interest, or any instance ID for all the instances
+                    /// @param handler Handler to be invoked per matching entry
+                    /// @throws std::invalid_argument Throws if the entry type is not a service entry type
+                    void Register(
+                        void *object,
+                        entry::EntryType type,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        EntryHandler handler);
+
+                    /// @brief Register an event-group entry handler
+                    /// @param object Object that owns the handler
+                    /// @param type Event-group entry type of interest (i.e., subscribing or acknowledging)
+                    /// @param serviceId Service ID of interest
+                    /// @param instanceId Service instance ID of interest, or any instance ID for all the instances
+                    /// @param eventgroupId Event-group ID of interest
+                    /// @param handler Handler to be invoked per matching entry
+                    /// @throws std::invalid_argument Throws if the entry type is not an event-group entry type
+                    void Register(
+                        void *object,
+                        entry::EntryType type,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint16_t eventgroupId,
+                        EntryHandler handler);
+
+                    /// @brief Unregister all the handlers of an object
+                    /// @param object Handlers owner object
+                    /// @note The function returns after all the on-going dispatches to the handlers have been finished.
+                    /// @warning The function must not be called from within an entry handler.
+                    void Unregister(void *object);
+                };
+            }
+        }
+    }
+}
+
+#endif
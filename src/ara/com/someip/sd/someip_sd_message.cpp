@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <limits>
 #include "./someip_sd_message.h"
+#include "../someip_message_view.h"
 #include "../../entry/entry_deserializer.h"
 #include "../../option/option_deserializer.h"
 
@@ -16,13 +21,22 @@ namespace ara
                                                          cProtocolVersion,
                                                          cInterfaceVersion,
                                                          cMessageType),
-                                                     mRebooted{true}
+                                                     mRebooted{true},
+                                                     mOptionsIndexed{true}
                 {
                 }
 
                 SomeIpSdMessage::SomeIpSdMessage(SomeIpSdMessage &&other) : SomeIpMessage{std::move(other)},
                                                                             mRebooted{other.mRebooted},
-                                                                            mEntries{std::move(other.mEntries)}
+                                                                            mEntryRecords{std::move(other.mEntryRecords)},
+                                                                            mOptionRecords{std::move(other.mOptionRecords)},
+                                                                            mOptionsPayload{std::move(other.mOptionsPayload)},
+                                                                            mOptionIds{std::move(other.mOptionIds)},
+                                                                            mOptionPositions{std::move(other.mOptionPositions)},
+                                                                            mOptionSequence{std::move(other.mOptionSequence)},
+                                                                            mOptionsIndexed{other.mOptionsIndexed},
+                                                                            mEntries{std::move(other.mEntries)},
+                                                                            mOptions{std::move(other.mOptions)}
                 {
                 }
 
@@ -30,66 +44,253 @@ namespace ara
                 {
                     SomeIpMessage::operator=(std::move(other));
                     mRebooted = other.mRebooted;
+                    mEntryRecords = std::move(other.mEntryRecords);
+                    mOptionRecords = std::move(other.mOptionRecords);
+                    mOptionsPayload = std::move(other.mOptionsPayload);
+                    mOptionIds = std::move(other.mOptionIds);
+                    mOptionPositions = std::move(other.mOptionPositions);
+                    mOptionSequence = std::move(other.mOptionSequence);
+                    mOptionsIndexed = other.mOptionsIndexed;
                     mEntries = std::move(other.mEntries);
+                    mOptions = std::move(other.mOptions);
 
                     return *this;
                 }
 
                 uint32_t SomeIpSdMessage::getEntriesLength() const noexcept
                 {
-                    const uint32_t cEntrySize = 16;
-                    uint32_t _numberOfEntries = mEntries.size();
-                    uint32_t _result = _numberOfEntries * cEntrySize;
+                    uint32_t _numberOfEntries = mEntryRecords.size();
+                    uint32_t _result = _numberOfEntries * entry::Entry::cEntrySize;
 
                     return _result;
                 }
 
                 uint32_t SomeIpSdMessage::getOptionsLength() const noexcept
                 {
-                    const uint32_t cOptionLengthFieldSize = 3;
-                    uint32_t _result = 0;
+                    uint32_t _result = mOptionsPayload.size();
+                    return _result;
+                }
+
+                void SomeIpSdMessage::serializeOptions(
+                    const std::vector<std::shared_ptr<const option::Option>> &options,
+                    std::vector<std::string> &run)
+                {
+                    // The options are short enough to be kept in the small string buffers.
+                    run.resize(options.size());
+                    for (std::size_t i = 0; i < options.size(); ++i)
+                    {
+                        std::string &_bytes = run[i];
+                        _bytes.resize(options[i]->Size());
+                        options[i]->SerializeTo(
+                            reinterpret_cast<uint8_t *>(&_bytes[0]), _bytes.size());
+                    }
+                }
 
-                    for (auto &entry : mEntries)
+                bool SomeIpSdMessage::tryFindOptions(
+                    const std::vector<std::string> &run, uint8_t &index) const
+                {
+                    // Options are matched by their distinct serialized bytes, and a run only needs to be
+                    // compared at the positions of its first option rather than at every option offset.
+                    std::vector<uint32_t> _ids;
+                    _ids.reserve(run.size());
+                    for (const auto &_bytes : run)
                     {
-                        for (auto &firstOption : entry->FirstOptions())
+                        auto _itr = mOptionIds.find(_bytes);
+                        if (_itr == mOptionIds.end())
                         {
-                            _result += cOptionLengthFieldSize + firstOption->Length();
+                            return false;
                         }
 
-                        for (auto &secondOption : entry->SecondOptions())
+                        _ids.push_back(_itr->second);
+                    }
+
+                    for (std::size_t _position : mOptionPositions[_ids.front()])
+                    {
+                        if (_position + _ids.size() <= mOptionSequence.size() &&
+                            std::equal(_ids.begin(), _ids.end(), mOptionSequence.begin() + _position))
                         {
-                            _result += cOptionLengthFieldSize + secondOption->Length();
+                            index = static_cast<uint8_t>(_position);
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                void SomeIpSdMessage::indexOption(const std::string &bytes)
+                {
+                    auto _inserted =
+                        mOptionIds.emplace(bytes, static_cast<uint32_t>(mOptionPositions.size()));
+                    if (_inserted.second)
+                    {
+                        mOptionPositions.emplace_back();
+                    }
+
+                    const uint32_t cId = _inserted.first->second;
+                    mOptionPositions[cId].push_back(mOptionSequence.size());
+                    mOptionSequence.push_back(cId);
+                }
+
+                void SomeIpSdMessage::indexOptions()
+                {
+                    // An incomplete trailing option of a deserialized message cannot be referenced by its entries,
+                    // so it is dropped before appending new options after the complete ones.
+                    std::size_t _offset = 0;
+                    for (std::size_t i = 0; i < mOptionRecords.size(); ++i)
+                    {
+                        helper::ByteReader _reader(
+                            mOptionsPayload.data() + _offset, mOptionsPayload.size() - _offset);
+
+                        uint16_t _length;
+                        if (!_reader.TryRead(_length) ||
+                            !_reader.Require(sizeof(uint8_t) + _length))
+                        {
+                            mOptionRecords.resize(i);
+                            break;
+                        }
+
+                        const std::size_t cSize = option::Option::cHeaderSize + _length;
+                        indexOption(
+                            std::string(
+                                reinterpret_cast<const char *>(mOptionsPayload.data() + _offset), cSize));
+                        _offset += cSize;
+                    }
+
+                    mOptionsPayload.resize(_offset);
+                    mOptionsIndexed = true;
+                }
+
+                uint8_t SomeIpSdMessage::addOptions(
+                    const std::vector<std::shared_ptr<const option::Option>> &options)
+                {
+                    // The index of an empty run is not interpreted by the receivers.
+                    uint8_t _result = 0;
+                    if (options.empty())
+                    {
+                        return _result;
+                    }
+
+                    std::vector<std::string> _run;
+                    serializeOptions(options, _run);
+
+                    if (!tryFindOptions(_run, _result))
+                    {
+                        if (mOptionRecords.size() > std::numeric_limits<uint8_t>::max())
+                        {
+                            throw std::out_of_range("The option run index does not fit in an entry.");
+                        }
+
+                        _result = static_cast<uint8_t>(mOptionRecords.size());
+                        for (std::size_t i = 0; i < options.size(); ++i)
+                        {
+                            indexOption(_run[i]);
+                            mOptionsPayload.insert(mOptionsPayload.end(), _run[i].begin(), _run[i].end());
+                            mOptionRecords.push_back(options[i]->Record());
                         }
                     }
 
                     return _result;
                 }
 
-                const std::vector<std::unique_ptr<entry::Entry>> &SomeIpSdMessage::Entries() const noexcept
+                const std::shared_ptr<const option::Option> &SomeIpSdMessage::getOption(std::size_t index) const
                 {
+                    std::shared_ptr<const option::Option> &_result = mOptions[index];
+                    if (!_result)
+                    {
+                        _result = option::OptionDeserializer::FromRecord(mOptionRecords[index]);
+                    }
+
+                    return _result;
+                }
+
+                const std::vector<std::unique_ptr<entry::Entry>> &SomeIpSdMessage::Entries() const
+                {
+                    std::lock_guard<std::mutex> _lock(mEntriesMutex);
+
+                    // Only the entries added since the previous call are instantiated.
+                    mOptions.resize(mOptionRecords.size());
+                    while (mEntries.size() < mEntryRecords.size())
+                    {
+                        const entry::EntryRecord &cRecord = mEntryRecords[mEntries.size()];
+                        std::unique_ptr<entry::Entry> _entry{entry::EntryDeserializer::FromRecord(cRecord)};
+
+                        for (std::size_t i = 0; i < cRecord.FirstOptionCount; ++i)
+                        {
+                            _entry->TryAddFirstOption(getOption(cRecord.FirstOptionIndex + i));
+                        }
+
+                        for (std::size_t i = 0; i < cRecord.SecondOptionCount; ++i)
+                        {
+                            _entry->TryAddSecondOption(getOption(cRecord.SecondOptionIndex + i));
+                        }
+
+                        mEntries.push_back(std::move(_entry));
+                    }
+
                     return mEntries;
                 }
 
+                const std::vector<entry::EntryRecord> &SomeIpSdMessage::EntryRecords() const noexcept
+                {
+                    return mEntryRecords;
+                }
+
+                const std::vector<option::OptionRecord> &SomeIpSdMessage::OptionRecords() const noexcept
+                {
+                    return mOptionRecords;
+                }
+
                 void SomeIpSdMessage::AddEntry(std::unique_ptr<entry::Entry> entry)
                 {
-                    mEntries.push_back(std::move(entry));
+                    // The deserialized options are indexed only once an entry is added to the message.
+                    if (!mOptionsIndexed)
+                    {
+                        indexOptions();
+                    }
+
+                    uint8_t _optionIndex = 0;
+                    entry::EntryRecord _record = entry->Record(_optionIndex);
+                    _record.FirstOptionIndex = addOptions(entry->FirstOptions());
+                    _record.SecondOptionIndex = addOptions(entry->SecondOptions());
+
+                    mEntryRecords.push_back(_record);
                 }
 
-                uint32_t SomeIpSdMessage::Length() const noexcept
+                uint32_t SomeIpSdMessage::AddedLength(
+                    const entry::Entry &entry, std::size_t &numberOfAddedOptions) const
                 {
-                    const uint32_t cLengthFieldSize = 4;
-                    // Request ID + Versions + Message Type + Return Code
-                    const uint32_t cGeneralHeaderSize = 8;
-                    // Flags + Reserved
-                    const uint32_t cSdHeaderSize = 4;
+                    uint32_t _result = entry::Entry::cEntrySize;
+                    numberOfAddedOptions = 0;
+
+                    std::vector<std::string> _run;
+                    for (auto options : {&entry.FirstOptions(), &entry.SecondOptions()})
+                    {
+                        serializeOptions(*options, _run);
+
+                        uint8_t _index;
+                        if (!_run.empty() && !tryFindOptions(_run, _index))
+                        {
+                            for (const auto &_bytes : _run)
+                            {
+                                _result += static_cast<uint32_t>(_bytes.size());
+                            }
+
+                            numberOfAddedOptions += options->size();
+                        }
+                    }
+
+                    return _result;
+                }
 
-                    uint32_t _entriesLength = cLengthFieldSize + getEntriesLength();
-                    uint32_t _optionsLength = cLengthFieldSize + getOptionsLength();
+                bool SomeIpSdMessage::Rebooted() const noexcept
+                {
+                    return mRebooted;
+                }
+
+                uint32_t SomeIpSdMessage::Length() const noexcept
+                {
                     uint32_t _result =
-                        cGeneralHeaderSize +
-                        cSdHeaderSize +
-                        _entriesLength +
-                        _optionsLength;
+                        getLength(getEntriesLength(), getOptionsLength());
 
                     return _result;
                 }
@@ -114,129 +315,389 @@ namespace ara
                     return _wrapped;
                 }
 
-                std::vector<uint8_t> SomeIpSdMessage::Payload() const
+                uint32_t SomeIpSdMessage::getLength(
+                    uint32_t entriesLength, uint32_t optionsLength) const noexcept
+                {
+                    const uint32_t cLengthFieldSize = 4;
+                    // Request ID + Versions + Message Type + Return Code
+                    const uint32_t cGeneralHeaderSize = 8;
+                    // Flags + Reserved
+                    const uint32_t cSdHeaderSize = 4;
+
+                    uint32_t _result =
+                        cGeneralHeaderSize +
+                        cSdHeaderSize +
+                        cLengthFieldSize + entriesLength +
+                        cLengthFieldSize + optionsLength;
+
+                    return _result;
+                }
+
+                std::size_t SomeIpSdMessage::serializeHeaderTo(
+                    uint8_t *dst,
+                    uint32_t entriesLength,
+                    uint32_t optionsLength) const noexcept
                 {
-                    // General SOME/IP header payload insertion
-                    std::vector<uint8_t> _result = SomeIpMessage::Payload();
+                    // General SOME/IP header insertion
+                    const uint32_t cLength = getLength(entriesLength, optionsLength);
+                    std::size_t _offset = SerializeHeaderTo(dst, cLength);
 
                     if (mRebooted)
                     {
                         // Unicast Support flag is on.
-                        helper::Inject(_result, cRebootedFlag);
+                        helper::Inject(dst, _offset, cRebootedFlag);
                     }
                     else
                     {
                         // Unicast Support flag is on.
-                        helper::Inject(_result, cNotRebootedFlag);
+                        helper::Inject(dst, _offset, cNotRebootedFlag);
                     }
 
-                    uint8_t _lastOptionIndex = 0;
-                    std::vector<uint8_t> _entriesPayload;
-                    std::vector<uint8_t> _optionsPayload;
-                    for (auto &entry : mEntries)
+                    helper::Inject(dst, _offset, entriesLength);
+
+                    return _offset;
+                }
+
+                std::size_t SomeIpSdMessage::serializeEntriesTo(uint8_t *dst) const
+                {
+                    // The records already point to their possibly shared option runs.
+                    std::size_t _offset = 0;
+                    for (const auto &_record : mEntryRecords)
                     {
-                        auto _entryPayload = entry->Payload(_lastOptionIndex);
-                        helper::Concat(
-                            _entriesPayload, std::move(_entryPayload));
+                        _offset +=
+                            entry::Entry::SerializeRecordTo(
+                                _record, dst + _offset, entry::Entry::cEntrySize);
+                    }
 
-                        for (auto &firstOption : entry->FirstOptions())
-                        {
-                            auto _firstOptionPayload = firstOption->Payload();
-                            helper::Concat(
-                                _optionsPayload, std::move(_firstOptionPayload));
-                            ++_lastOptionIndex;
-                        }
+                    return _offset;
+                }
 
-                        for (auto &secondOption : entry->SecondOptions())
-                        {
-                            auto _secondOptionPayload = secondOption->Payload();
-                            helper::Concat(
-                                _optionsPayload, std::move(_secondOptionPayload));
-                            ++_lastOptionIndex;
-                        }
+                std::size_t SomeIpSdMessage::serializeOptionsTo(
+                    uint8_t *dst, uint32_t optionsLength) const
+                {
+                    std::size_t _offset = 0;
+                    helper::Inject(dst, _offset, optionsLength);
+
+                    // The distinct options are already serialized in the same order of the indices.
+                    if (optionsLength > 0)
+                    {
+                        std::memcpy(dst + _offset, mOptionsPayload.data(), optionsLength);
+                        _offset += optionsLength;
                     }
 
-                    // Entries length and payloads insertion
-                    uint32_t _entriesLength = getEntriesLength();
-                    helper::Inject(_result, _entriesLength);
-                    helper::Concat(_result, std::move(_entriesPayload));
+                    return _offset;
+                }
+
+                std::size_t SomeIpSdMessage::SerializeTo(uint8_t *dst, std::size_t cap) const
+                {
+                    // Compute the entries and options lengths once for the whole serialization
+                    const uint32_t cEntriesLength = getEntriesLength();
+                    const uint32_t cOptionsLength = getOptionsLength();
+                    const uint32_t cLength = getLength(cEntriesLength, cOptionsLength);
+                    if (cap < cLengthCoverageOffset + cLength)
+                    {
+                        throw std::out_of_range(
+                            "The buffer capacity is not enough for the message.");
+                    }
 
-                    // Options length and payloads insertion
-                    uint32_t _optionsLength = getOptionsLength();
-                    helper::Inject(_result, _optionsLength);
-                    helper::Concat(_result, std::move(_optionsPayload));
+                    std::size_t _offset =
+                        serializeHeaderTo(dst, cEntriesLength, cOptionsLength);
+                    _offset += serializeEntriesTo(dst + _offset);
+                    _offset += serializeOptionsTo(dst + _offset, cOptionsLength);
+
+                    return _offset;
+                }
+
+                std::size_t SomeIpSdMessage::SerializeTo(
+                    std::array<iovec, cSegmentCount> &segments) const
+                {
+                    const std::size_t cHeaderSegmentIndex = 0;
+                    const std::size_t cEntriesSegmentIndex = 1;
+                    const std::size_t cOptionsSegmentIndex = 2;
+                    // SOME/IP header + Flags + Reserved + Entries length
+                    const std::size_t cHeaderSegmentSize = cHeaderSize + 8;
+                    const std::size_t cLengthFieldSize = 4;
+
+                    const uint32_t cEntriesLength = getEntriesLength();
+                    const uint32_t cOptionsLength = getOptionsLength();
+
+                    iovec &_headerSegment = segments[cHeaderSegmentIndex];
+                    iovec &_entriesSegment = segments[cEntriesSegmentIndex];
+                    iovec &_optionsSegment = segments[cOptionsSegmentIndex];
+
+                    if (_headerSegment.iov_len < cHeaderSegmentSize ||
+                        _entriesSegment.iov_len < cEntriesLength ||
+                        _optionsSegment.iov_len < cLengthFieldSize + cOptionsLength)
+                    {
+                        throw std::out_of_range(
+                            "The segment capacity is not enough for the message.");
+                    }
+
+                    _headerSegment.iov_len =
+                        serializeHeaderTo(
+                            static_cast<uint8_t *>(_headerSegment.iov_base),
+                            cEntriesLength,
+                            cOptionsLength);
+
+                    _entriesSegment.iov_len =
+                        serializeEntriesTo(
+                            static_cast<uint8_t *>(_entriesSegment.iov_base));
+
+                    _optionsSegment.iov_len =
+                        serializeOptionsTo(
+                            static_cast<uint8_t *>(_optionsSegment.iov_base),
+                            cOptionsLength);
+
+                    std::size_t _result =
+                        _headerSegment.iov_len +
+                        _entriesSegment.iov_len +
+                        _optionsSegment.iov_len;
 
                     return _result;
                 }
 
-                SomeIpSdMessage SomeIpSdMessage::Deserialize(
-                    const std::vector<uint8_t> &payload)
+                void SomeIpSdMessage::Serialize(std::vector<uint8_t> &payload) const
                 {
-                    SomeIpSdMessage _result;
-                    SomeIpMessage::Deserialize(&_result, payload);
+                    // Compute the message size once and grow the buffer by it without an exact reservation,
+                    // so appending repeatedly to the same buffer keeps the vector geometric growth.
+                    const uint32_t cEntriesLength = getEntriesLength();
+                    const uint32_t cOptionsLength = getOptionsLength();
+                    const uint32_t cLength = getLength(cEntriesLength, cOptionsLength);
+
+                    std::size_t _offset = payload.size();
+                    payload.resize(_offset + cLengthCoverageOffset + cLength);
+                    uint8_t *_dst = payload.data() + _offset;
+
+                    _dst += serializeHeaderTo(_dst, cEntriesLength, cOptionsLength);
+                    _dst += serializeEntriesTo(_dst);
+                    serializeOptionsTo(_dst, cOptionsLength);
+                }
+
+                core::Result<void> SomeIpSdMessage::malformed(SomeIpErrc reason)
+                {
+                    core::ErrorCode _errorCode{SomeIpErrorDomain::MakeErrorCode(reason)};
+                    return core::Result<void>::FromError(std::move(_errorCode));
+                }
+
+                core::Result<void> SomeIpSdMessage::TryDeserialize(
+                    const uint8_t *data,
+                    std::size_t size,
+                    SomeIpSdMessage &message)
+                {
+                    if ((data == nullptr) || (size < cHeaderSize))
+                    {
+                        return malformed(SomeIpErrc::kTruncatedHeader);
+                    }
 
-                    const std::size_t cSomeIpSdPduOffset = 16;
-                    std::size_t _entryOffset = cSomeIpSdPduOffset;
-                    uint32_t _rebootFlag =
-                        helper::ExtractInteger(payload, _entryOffset);
+                    // Reject a foreign or inconsistent header before touching the SD part
+                    SomeIpMessageView _view(data, size);
+                    if (!_view.IsValid())
+                    {
+                        return malformed(SomeIpErrc::kLengthMismatch);
+                    }
+
+                    if (_view.MessageId() != cMessageId)
+                    {
+                        return malformed(SomeIpErrc::kUnknownMessageId);
+                    }
+
+                    // The message is filled from scratch, so the wire indices of the entries stay valid.
+                    message = SomeIpSdMessage();
+
+                    helper::ByteReader _reader(data, _view.Size());
+                    SomeIpMessage::TryDeserialize(&message, _reader);
+
+                    // Flags + Reserved + Entries length
+                    const std::size_t cSdHeaderSize = 8;
+                    if (!_reader.Require(cSdHeaderSize))
+                    {
+                        return malformed(SomeIpErrc::kLengthMismatch);
+                    }
+
+                    uint32_t _rebootFlag = _reader.ReadInteger();
                     if (_rebootFlag == cRebootedFlag)
                     {
-                        _result.mRebooted = true;
+                        message.mRebooted = true;
                     }
                     else if (_rebootFlag == cNotRebootedFlag)
                     {
-                        _result.mRebooted = false;
+                        message.mRebooted = false;
                     }
                     else
                     {
-                        throw std::out_of_range(
-                            "The serialized reboot flag is out of range.");
+                        return malformed(SomeIpErrc::kInvalidFlags);
                     }
 
-                    uint32_t _entriesLength =
-                        helper::ExtractInteger(payload, _entryOffset);
-                    uint32_t _entryOffsetMax = _entryOffset + _entriesLength;
+                    uint32_t _entriesLength = _reader.ReadInteger();
+                    if (!_reader.Require(_entriesLength) ||
+                        (_entriesLength % entry::Entry::cEntrySize != 0))
+                    {
+                        return malformed(SomeIpErrc::kTruncatedEntries);
+                    }
 
-                    const std::size_t cOptionsLengthFieldSize = 4;
-                    std::size_t _optionOffset =
-                        _entryOffset + _entriesLength + cOptionsLengthFieldSize;
+                    helper::ByteReader _entriesReader(_reader.Current(), _entriesLength);
+                    _reader.Skip(_entriesLength);
+
+                    uint32_t _optionsLength;
+                    if (!_reader.TryRead(_optionsLength) ||
+                        !_reader.Require(_optionsLength))
+                    {
+                        return malformed(SomeIpErrc::kTruncatedOptions);
+                    }
+
+                    const uint8_t *const cOptions = _reader.Current();
+
+                    // Count the options by hopping over their length fields to reserve their records at once.
+                    // A truncated option is still counted to be rejected once it is referenced.
+                    std::size_t _numberOfOptions = 0;
+                    helper::ByteReader _optionsReader(cOptions, _optionsLength);
+                    while (_optionsReader.Require(option::Option::cHeaderSize))
+                    {
+                        ++_numberOfOptions;
+
+                        uint16_t _length = _optionsReader.ReadShort();
+                        if (!_optionsReader.Skip(sizeof(uint8_t) + _length))
+                        {
+                            break;
+                        }
+                    }
 
-                    while (_entryOffset < _entryOffsetMax)
+                    // The options array on the wire is already deduplicated, so the options are decoded in place
+                    // and the entries keep referring to them by their wire indices.
+                    std::bitset<cMaxReachableOptions> _decodedOptions;
+                    message.mOptionRecords.resize(_numberOfOptions);
+                    std::size_t _optionOffset = 0;
+                    for (std::size_t i = 0; i < _numberOfOptions; ++i)
                     {
-                        uint8_t _numberOfFirstOptions;
-                        uint8_t _numberOfSecondOptions;
+                        helper::ByteReader _optionReader(cOptions + _optionOffset, _optionsLength - _optionOffset);
+                        if (i < cMaxReachableOptions &&
+                            option::OptionDeserializer::TryDeserialize(_optionReader, message.mOptionRecords[i]))
+                        {
+                            _decodedOptions.set(i);
+                        }
 
-                        auto _entry{
-                            entry::EntryDeserializer::Deserialize(
-                                payload,
-                                _entryOffset,
-                                _numberOfFirstOptions,
-                                _numberOfSecondOptions)};
+                        uint16_t _length;
+                        helper::ByteReader _lengthReader(cOptions + _optionOffset, _optionsLength - _optionOffset);
+                        _lengthReader.TryRead(_length);
+                        _optionOffset += option::Option::cHeaderSize + _length;
+                    }
 
-                        for (int i = 0; i < _numberOfFirstOptions; i++)
+                    // Validate the option runs of an entry against its type like adding the options to an entry
+                    auto _validateOptions =
+                        [&](const entry::EntryRecord &record) -> bool
+                    {
+                        uint64_t _containedTypes = 0;
+                        const std::pair<uint8_t, uint8_t> cRuns[] = {
+                            {record.FirstOptionIndex, record.FirstOptionCount},
+                            {record.SecondOptionIndex, record.SecondOptionCount}};
+
+                        for (const auto &_run : cRuns)
                         {
-                            auto _option{
-                                option::OptionDeserializer::Deserialize(
-                                    payload, _optionOffset)};
+                            const std::size_t cRunEnd = _run.first + _run.second;
+                            for (std::size_t i = _run.first; i < cRunEnd; ++i)
+                            {
+                                if (!_decodedOptions.test(i))
+                                {
+                                    return false;
+                                }
+
+                                const option::OptionType cType = message.mOptionRecords[i].Type;
+                                const uint64_t cTypeMask = 1ULL << static_cast<uint8_t>(cType);
+                                const bool cContained = (_containedTypes & cTypeMask) != 0;
+                                if (!entry::EntryDeserializer::IsOptionAllowed(record, cType, cContained))
+                                {
+                                    return false;
+                                }
+
+                                _containedTypes |= cTypeMask;
+                            }
+                        }
 
-                            _entry->AddFirstOption(std::move(_option));
+                        return true;
+                    };
+
+                    std::size_t _numberOfEntries = _entriesLength / entry::Entry::cEntrySize;
+                    message.mEntryRecords.reserve(_numberOfEntries);
+
+                    while (_entriesReader.Remaining() > 0)
+                    {
+                        entry::EntryRecord _record;
+                        if (!entry::EntryDeserializer::TryDeserialize(_entriesReader, _record))
+                        {
+                            return malformed(SomeIpErrc::kUnsupportedEntry);
                         }
 
-                        for (int i = 0; i < _numberOfSecondOptions; i++)
+                        // The run indices are bytes, so a run within the options never exceeds the index limit.
+                        const std::size_t cFirstRunEnd = _record.FirstOptionIndex + _record.FirstOptionCount;
+                        const std::size_t cSecondRunEnd = _record.SecondOptionIndex + _record.SecondOptionCount;
+                        if ((_record.FirstOptionCount > 0 && cFirstRunEnd > _numberOfOptions) ||
+                            (_record.SecondOptionCount > 0 && cSecondRunEnd > _numberOfOptions))
                         {
-                            auto _option{
-                                option::OptionDeserializer::Deserialize(
-                                    payload, _optionOffset)};
+                            return malformed(SomeIpErrc::kTruncatedOptions);
+                        }
 
-                            _entry->AddSecondOption(std::move(_option));
+                        if (!_validateOptions(_record))
+                        {
+                            return malformed(SomeIpErrc::kInvalidOption);
                         }
 
-                        _result.AddEntry(std::move(_entry));
+                        message.mEntryRecords.push_back(_record);
+                    }
+
+                    message.mOptionsPayload.assign(cOptions, cOptions + _optionsLength);
+                    message.mOptionsIndexed = false;
+
+                    return core::Result<void>::FromValue();
+                }
+
+                core::Result<void> SomeIpSdMessage::TryDeserialize(
+                    const std::vector<uint8_t> &payload,
+                    SomeIpSdMessage &message)
+                {
+                    return TryDeserialize(payload.data(), payload.size(), message);
+                }
+
+                SomeIpSdMessage SomeIpSdMessage::Deserialize(
+                    const std::vector<uint8_t> &payload)
+                {
+                    SomeIpSdMessage _result;
+                    core::Result<void> _deserialized{TryDeserialize(payload, _result)};
+
+                    if (!_deserialized.HasValue())
+                    {
+                        throw std::out_of_range(_deserialized.Error().Message());
                     }
 
                     return _result;
                 }
             }
         }
+
+        namespace helper
+        {
+            const std::size_t MessageTraits<someip::sd::SomeIpSdMessage>::cErrorCodeCount;
+
+            core::Result<std::shared_ptr<const someip::sd::SomeIpSdMessage>>
+            MessageTraits<someip::sd::SomeIpSdMessage>::Decode(
+                const uint8_t *data,
+                std::size_t size)
+            {
+                using Message = someip::sd::SomeIpSdMessage;
+                using DecodingResult = core::Result<std::shared_ptr<const Message>>;
+
+                auto _message{std::make_shared<Message>()};
+                core::Result<void> _deserialized{Message::TryDeserialize(data, size, *_message)};
+
+                if (_deserialized.HasValue())
+                {
+                    return DecodingResult::FromValue(
+                        std::shared_ptr<const Message>{std::move(_message)});
+                }
+                else
+                {
+                    return DecodingResult::FromError(_deserialized.Error());
+                }
+            }
+        }
     }
 }
\ No newline at end of file
@@ -2,7 +2,16 @@
 #define SOMEIP_SD_MESSAGE_H
 
 #include <utility>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <sys/uio.h>
+#include "../../../core/result.h"
+#include "../../helper/message_traits.h"
 #include "../someip_message.h"
+#include "../someip_error_domain.h"
 #include "../../entry/entry.h"
 
 namespace ara
@@ -14,6 +23,10 @@ namespace ara
             namespace sd
             {
                 /// @brief SOME/IP service discovery message
+                /// @details The entries and options are stored as plain value records, and the distinct options
+                /// are kept serialized in the same order of the records. Identical option runs of different entries
+                /// are serialized only once and shared via the entries option indices, so the entries offering
+                /// the same endpoint do not repeat it.
                 class SomeIpSdMessage : public SomeIpMessage
                 {
                 private:
@@ -25,13 +38,42 @@ namespace ara
                     static const uint32_t cRebootedFlag = 0xc0000000;
                     static const uint32_t cNotRebootedFlag = 0x40000000;
 
+                    // Maximum option run index + Maximum option run length
+                    static const std::size_t cMaxReachableOptions = 0xff + 0x0f;
+
                     bool mRebooted;
-                    std::vector<std::unique_ptr<entry::Entry>> mEntries;
+                    std::vector<entry::EntryRecord> mEntryRecords;
+                    std::vector<option::OptionRecord> mOptionRecords;
+                    std::vector<uint8_t> mOptionsPayload;
+                    std::unordered_map<std::string, uint32_t> mOptionIds;
+                    std::vector<std::vector<std::size_t>> mOptionPositions;
+                    std::vector<uint32_t> mOptionSequence;
+                    bool mOptionsIndexed;
+                    mutable std::mutex mEntriesMutex;
+                    mutable std::vector<std::unique_ptr<entry::Entry>> mEntries;
+                    mutable std::vector<std::shared_ptr<const option::Option>> mOptions;
 
+                    static void serializeOptions(
+                        const std::vector<std::shared_ptr<const option::Option>> &options,
+                        std::vector<std::string> &run);
+                    bool tryFindOptions(const std::vector<std::string> &run, uint8_t &index) const;
+                    void indexOption(const std::string &bytes);
+                    void indexOptions();
+                    uint8_t addOptions(const std::vector<std::shared_ptr<const option::Option>> &options);
+                    const std::shared_ptr<const option::Option> &getOption(std::size_t index) const;
                     uint32_t getEntriesLength() const noexcept;
                     uint32_t getOptionsLength() const noexcept;
+                    uint32_t getLength(uint32_t entriesLength, uint32_t optionsLength) const noexcept;
+                    std::size_t serializeHeaderTo(uint8_t *dst, uint32_t entriesLength, uint32_t optionsLength) const noexcept;
+                    std::size_t serializeEntriesTo(uint8_t *dst) const;
+                    std::size_t serializeOptionsTo(uint8_t *dst, uint32_t optionsLength) const;
+                    static core::Result<void> malformed(SomeIpErrc reason);
 
                 public:
+                    /// @brief Number of the scatter-gather segments of a serialized message
+                    /// @details Header (SOME/IP header, SD flags and entries length), entries, and options (options length and options)
+                    static const std::size_t cSegmentCount = 3;
+
                     SomeIpSdMessage();
                     SomeIpSdMessage(SomeIpSdMessage&& other);
 
@@ -39,28 +81,105 @@ namespace ara
 
                     /// @brief Get entries
                     /// @returns Exisiting message entries
-                    const std::vector<std::unique_ptr<entry::Entry>> &Entries() const noexcept;
+                    /// @note The entries are instantiated from the entry records on demand, and the entries
+                    /// referring to the same option share its instance. Changing a returned entry does not change
+                    /// the message. Prefer EntryRecords which does not allocate.
+                    const std::vector<std::unique_ptr<entry::Entry>> &Entries() const;
+
+                    /// @brief Get entry records
+                    /// @returns Contiguous plain value records of the message entries
+                    const std::vector<entry::EntryRecord> &EntryRecords() const noexcept;
+
+                    /// @brief Get option records
+                    /// @returns Contiguous plain value records of the distinct message options indexed by the entry records
+                    const std::vector<option::OptionRecord> &OptionRecords() const noexcept;
 
                     /// @brief Add an entry
                     /// @param entry Entry to be added
+                    /// @note The entry and its options are stored as records, so the entry is frozen once it is added
+                    /// and the options should be added to the entry beforehand.
+                    /// An option run identical to an already added one is referenced instead of being added again.
+                    /// @throws std::out_of_range Throws when the index of a new option run does not fit in an entry
                     void AddEntry(std::unique_ptr<entry::Entry> entry);
 
+                    /// @brief Get the message length growth of adding an entry
+                    /// @param entry Entry to be added
+                    /// @param[out] numberOfAddedOptions Number of the options which are not shared with the added entries
+                    /// @returns Added length in bytes considering the shared option runs
+                    /// @note The result is an upper bound if both option runs of the entry are new and identical.
+                    uint32_t AddedLength(const entry::Entry &entry, std::size_t &numberOfAddedOptions) const;
+
+                    /// @brief Indicate whether the reboot flag is set or not
+                    /// @returns True if the session ID has not been wrapped since the reboot; otherwise false
+                    bool Rebooted() const noexcept;
+
                     virtual uint32_t Length() const noexcept override;
 
                     virtual void SetSessionId(uint16_t sessionId) override;
 
                     virtual bool IncrementSessionId() noexcept override;
 
-                    virtual std::vector<uint8_t> Payload() const override;
+                    virtual std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const override;
+
+                    /// @brief Serialize the message into caller-provided scatter-gather segments
+                    /// @param[in,out] segments Header, entries and options segment buffers;
+                    /// on input each length is the buffer capacity, on output the number of written bytes
+                    /// @returns Total number of written bytes
+                    /// @throws std::out_of_range Throws when a segment capacity does not fit its content
+                    /// @note The segments can be directly passed to a vectored write (e.g., sendmsg)
+                    /// without linearizing the message.
+                    std::size_t SerializeTo(std::array<iovec, cSegmentCount> &segments) const;
+
+                    virtual void Serialize(std::vector<uint8_t> &payload) const override;
 
                     /// @brief Deserialize a SOME/IP SD message payload
                     /// @param payload Serialized SOME/IP message payload byte array
                     /// @returns SOME/IP SD message filled by deserializing the payload
                     /// @throws std::out_of_range Throws when the payload is corrupted
                     static SomeIpSdMessage Deserialize(const std::vector<uint8_t> &payload);
+
+                    /// @brief Try to deserialize a SOME/IP SD message without throwing on malformed input
+                    /// @param data Pointer to the first byte of the serialized message
+                    /// @param size Number of available bytes starting from the data pointer
+                    /// @param[out] message Message to be filled by deserializing the bytes
+                    /// @returns Void result on success, otherwise a SomeIpErrc error code of the malformation reason
+                    /// @note The bytes after the message length are ignored.
+                    /// The message content is unspecified if the deserialization fails.
+                    static core::Result<void> TryDeserialize(
+                        const uint8_t *data,
+                        std::size_t size,
+                        SomeIpSdMessage &message);
+
+                    /// @brief Try to deserialize a SOME/IP SD message payload without throwing on malformed input
+                    /// @param payload Serialized SOME/IP message payload byte array
+                    /// @param[out] message Message to be filled by deserializing the payload
+                    /// @returns Void result on success, otherwise a SomeIpErrc error code of the malformation reason
+                    static core::Result<void> TryDeserialize(
+                        const std::vector<uint8_t> &payload,
+                        SomeIpSdMessage &message);
                 };
             }
         }
+
+        namespace helper
+        {
+            /// @brief SOME/IP SD message wire format traits
+            template <>
+            struct MessageTraits<someip::sd::SomeIpSdMessage>
+            {
+                /// @brief Exclusive upper bound of the SomeIpErrc values
+                static const std::size_t cErrorCodeCount =
+                    static_cast<std::size_t>(someip::SomeIpErrc::kInvalidOption) + 1;
+
+                /// @brief Decode a SOME/IP SD message
+                /// @param data Pointer to the first byte of the serialized message
+                /// @param size Number of available bytes starting from the data pointer
+                /// @returns Decoded immutable message, otherwise a SomeIpErrc error code of the malformation reason
+                static core::Result<std::shared_ptr<const someip::sd::SomeIpSdMessage>> Decode(
+                    const uint8_t *data,
+                    std::size_t size);
+            };
+        }
     }
 }
 #endif
\ No newline at end of file
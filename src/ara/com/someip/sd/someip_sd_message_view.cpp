@@ -0,0 +1,258 @@
+#include "./someip_sd_message_view.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                const uint8_t SomeIpSdMessageView::EntryFilter::cAllTypes;
+                const uint16_t SomeIpSdMessageView::EntryFilter::cAnyServiceId;
+
+                SomeIpSdMessageView::EntryFilter::EntryFilter(
+                    uint16_t serviceId) noexcept : mTypes{cAllTypes},
+                                                   mServiceId{serviceId}
+                {
+                }
+
+                SomeIpSdMessageView::EntryFilter::EntryFilter(
+                    std::initializer_list<entry::EntryType> types,
+                    uint16_t serviceId) noexcept : mTypes{0},
+                                                   mServiceId{serviceId}
+                {
+                    // All the supported entry types fit in a byte mask.
+                    for (auto type : types)
+                    {
+                        mTypes |= static_cast<uint8_t>(1 << static_cast<uint8_t>(type));
+                    }
+                }
+
+                void SomeIpSdMessageView::EntryFilter::Include(entry::EntryType type) noexcept
+                {
+                    mTypes |= static_cast<uint8_t>(1 << static_cast<uint8_t>(type));
+                }
+
+                bool SomeIpSdMessageView::EntryFilter::Matches(const uint8_t *entry) const noexcept
+                {
+                    const uint8_t cTypeBitLength = 8;
+                    const std::size_t cServiceIdOffset = 4;
+
+                    uint8_t _type = entry[0];
+                    if ((_type >= cTypeBitLength) || ((mTypes & (1 << _type)) == 0))
+                    {
+                        return false;
+                    }
+
+                    if (mServiceId == cAnyServiceId)
+                    {
+                        return true;
+                    }
+
+                    uint16_t _serviceId =
+                        static_cast<uint16_t>(entry[cServiceIdOffset] << 8) |
+                        static_cast<uint16_t>(entry[cServiceIdOffset + 1]);
+
+                    return _serviceId == mServiceId;
+                }
+
+                SomeIpSdMessageView::EntryIterator::EntryIterator(
+                    const uint8_t *position,
+                    const uint8_t *end,
+                    EntryFilter filter) noexcept : mPosition{position},
+                                                   mEnd{end},
+                                                   mFilter{filter},
+                                                   mRecord{}
+                {
+                    seek();
+                }
+
+                void SomeIpSdMessageView::EntryIterator::seek() noexcept
+                {
+                    // Only the matching entries are decoded.
+                    while (mPosition != mEnd)
+                    {
+                        if (mFilter.Matches(mPosition))
+                        {
+                            helper::ByteReader _reader(mPosition, cEntrySize);
+                            if (entry::EntryDeserializer::TryDeserialize(_reader, mRecord))
+                            {
+                                return;
+                            }
+                        }
+
+                        mPosition += cEntrySize;
+                    }
+                }
+
+                SomeIpSdMessageView::EntryIterator::reference
+                SomeIpSdMessageView::EntryIterator::operator*() const noexcept
+                {
+                    return mRecord;
+                }
+
+                SomeIpSdMessageView::EntryIterator::pointer
+                SomeIpSdMessageView::EntryIterator::operator->() const noexcept
+                {
+                    return &mRecord;
+                }
+
+                SomeIpSdMessageView::EntryIterator &
+                SomeIpSdMessageView::EntryIterator::operator++() noexcept
+                {
+                    mPosition += cEntrySize;
+                    seek();
+
+                    return *this;
+                }
+
+                SomeIpSdMessageView::EntryIterator
+                SomeIpSdMessageView::EntryIterator::operator++(int) noexcept
+                {
+                    EntryIterator _result{*this};
+                    ++(*this);
+
+                    return _result;
+                }
+
+                bool SomeIpSdMessageView::EntryIterator::operator==(
+                    const EntryIterator &other) const noexcept
+                {
+                    return mPosition == other.mPosition;
+                }
+
+                bool SomeIpSdMessageView::EntryIterator::operator!=(
+                    const EntryIterator &other) const noexcept
+                {
+                    return mPosition != other.mPosition;
+                }
+
+                SomeIpSdMessageView::EntryRange::EntryRange(
+                    EntryIterator begin, EntryIterator end) noexcept : mBegin{begin},
+                                                                       mEnd{end}
+                {
+                }
+
+                SomeIpSdMessageView::EntryIterator
+                SomeIpSdMessageView::EntryRange::begin() const noexcept
+                {
+                    return mBegin;
+                }
+
+                SomeIpSdMessageView::EntryIterator
+                SomeIpSdMessageView::EntryRange::end() const noexcept
+                {
+                    return mEnd;
+                }
+
+                SomeIpSdMessageView::SomeIpSdMessageView(
+                    const uint8_t *data, std::size_t size) noexcept : SomeIpMessageView(data, size),
+                                                                       mValid{false}
+                {
+                    const std::size_t cMinimumSize =
+                        cEntriesOffset + cLengthFieldSize;
+
+                    if (SomeIpMessageView::IsValid() &&
+                        (Size() >= cMinimumSize) &&
+                        (MessageId() == cMessageId))
+                    {
+                        uint32_t _entriesLength = EntriesLength();
+                        std::size_t _optionsLengthOffset =
+                            cEntriesOffset + static_cast<std::size_t>(_entriesLength);
+
+                        // Entries have a fixed size, and the options length field should still fit in the message.
+                        if ((_entriesLength % cEntrySize == 0) &&
+                            (_optionsLengthOffset + cLengthFieldSize <= Size()))
+                        {
+                            uint32_t _optionsLength = ReadInteger(_optionsLengthOffset);
+                            std::size_t _expectedSize =
+                                _optionsLengthOffset + cLengthFieldSize + _optionsLength;
+
+                            mValid = (_expectedSize == Size());
+                        }
+                    }
+                }
+
+                SomeIpSdMessageView::SomeIpSdMessageView(
+                    const std::vector<uint8_t> &payload) noexcept : SomeIpSdMessageView(
+                                                                        payload.data(),
+                                                                        payload.size())
+                {
+                }
+
+                bool SomeIpSdMessageView::IsValid() const noexcept
+                {
+                    return mValid;
+                }
+
+                uint8_t SomeIpSdMessageView::Flags() const noexcept
+                {
+                    return Data()[cFlagsOffset];
+                }
+
+                bool SomeIpSdMessageView::Rebooted() const noexcept
+                {
+                    return (Flags() & cRebootedFlag) == cRebootedFlag;
+                }
+
+                bool SomeIpSdMessageView::UnicastSupported() const noexcept
+                {
+                    return (Flags() & cUnicastFlag) == cUnicastFlag;
+                }
+
+                uint32_t SomeIpSdMessageView::EntriesLength() const noexcept
+                {
+                    return ReadInteger(cEntriesLengthOffset);
+                }
+
+                std::size_t SomeIpSdMessageView::EntryCount() const noexcept
+                {
+                    return EntriesLength() / cEntrySize;
+                }
+
+                uint32_t SomeIpSdMessageView::OptionsLength() const noexcept
+                {
+                    std::size_t _optionsLengthOffset =
+                        cEntriesOffset + static_cast<std::size_t>(EntriesLength());
+
+                    return ReadInteger(_optionsLengthOffset);
+                }
+
+                SomeIpSdMessageView::EntryRange SomeIpSdMessageView::Entries(
+                    EntryFilter filter) const noexcept
+                {
+                    const uint8_t *_begin = Data() + cEntriesOffset;
+                    const uint8_t *_end = _begin + EntriesLength();
+
+                    EntryRange _result(
+                        EntryIterator(_begin, _end, filter),
+                        EntryIterator(_end, _end, filter));
+
+                    return _result;
+                }
+
+                bool SomeIpSdMessageView::TryGetOption(
+                    std::size_t index, option::OptionRecord &record) const noexcept
+                {
+                    std::size_t _optionsOffset =
+                        cEntriesOffset + static_cast<std::size_t>(EntriesLength()) + cLengthFieldSize;
+                    helper::ByteReader _reader(Data() + _optionsOffset, OptionsLength());
+
+                    // Hop over the preceding options by their length fields
+                    for (std::size_t i = 0; i < index; ++i)
+                    {
+                        uint16_t _length;
+                        if (!_reader.TryRead(_length) ||
+                            !_reader.Skip(sizeof(uint8_t) + _length))
+                        {
+                            return false;
+                        }
+                    }
+
+                    return option::OptionDeserializer::TryDeserialize(_reader, record);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#ifndef SOMEIP_SD_MESSAGE_VIEW_H
+#define SOMEIP_SD_MESSAGE_VIEW_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include "../someip_message_view.h"
+#include "../../entry/entry_deserializer.h"
+#include "../../option/option_deserializer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief Non-owning read-only view over a serialized SOME/IP service discovery message
+                /// @details On top of the general header validation, the SD header, the entries array length
+                /// and the options array length are validated once at construction.
+                /// @note The viewed byte range must outlive the view.
+                class SomeIpSdMessageView : public SomeIpMessageView
+                {
+                public:
+                    /// @brief Entry filter which is applied on the raw entry bytes before decoding them
+                    class EntryFilter
+                    {
+                    private:
+                        static const uint8_t cAllTypes = 0xff;
+
+                        uint8_t mTypes;
+                        uint16_t mServiceId;
+
+                    public:
+                        /// @brief Service ID that matches all the services
+                        static const uint16_t cAnyServiceId = 0xffff;
+
+                        /// @brief Constructor
+                        /// @param serviceId Service ID of interest
+                        explicit EntryFilter(uint16_t serviceId = cAnyServiceId) noexcept;
+
+                        /// @brief Constructor
+                        /// @param types Entry types of interest
+                        /// @param serviceId Service ID of interest
+                        EntryFilter(
+                            std::initializer_list<entry::EntryType> types,
+                            uint16_t serviceId = cAnyServiceId) noexcept;
+
+                        /// @brief Add an entry type of interest
+                        /// @param type Entry type to be matched in addition to the current types
+                        void Include(entry::EntryType type) noexcept;
+
+                        /// @brief Match a serialized entry against the filter
+                        /// @param entry Pointer to the first byte of a complete serialized entry
+                        /// @returns True if the entry type and service ID are of interest; otherwise false
+                        bool Matches(const uint8_t *entry) const noexcept;
+                    };
+
+                    /// @brief Forward iterator that lazily decodes the filtered entries as records
+                    /// @note The option indices of the records refer to the viewed options array.
+                    class EntryIterator
+                    {
+                    private:
+                        const uint8_t *mPosition;
+                        const uint8_t *mEnd;
+                        EntryFilter mFilter;
+                        entry::EntryRecord mRecord;
+
+                        void seek() noexcept;
+
+                    public:
+                        /// @brief Iterator category alias
+                        using iterator_category = std::forward_iterator_tag;
+                        /// @brief Iterated value type alias
+                        using value_type = entry::EntryRecord;
+                        /// @brief Iterator difference type alias
+                        using difference_type = std::ptrdiff_t;
+                        /// @brief Iterated value pointer type alias
+                        using pointer = const entry::EntryRecord *;
+                        /// @brief Iterated value reference type alias
+                        using reference = const entry::EntryRecord &;
+
+                        /// @brief Constructor
+                        /// @param position Pointer to the first serialized entry to be visited
+                        /// @param end Pointer right after the last serialized entry
+                        /// @param filter Entry filter
+                        EntryIterator(
+                            const uint8_t *position,
+                            const uint8_t *end,
+                            EntryFilter filter) noexcept;
+
+                        reference operator*() const noexcept;
+                        pointer operator->() const noexcept;
+                        EntryIterator &operator++() noexcept;
+                        EntryIterator operator++(int) noexcept;
+                        bool operator==(const EntryIterator &other) const noexcept;
+                        bool operator!=(const EntryIterator &other) const noexcept;
+                    };
+
+                    /// @brief Range of the filtered entries to be used in range-based loops
+                    class EntryRange
+                    {
+                    private:
+                        EntryIterator mBegin;
+                        EntryIterator mEnd;
+
+                    public:
+                        /// @brief Constructor
+                        /// @param begin Iterator to the first matched entry
+                        /// @param end Past-the-end iterator
+                        EntryRange(EntryIterator begin, EntryIterator end) noexcept;
+
+                        EntryIterator begin() const noexcept;
+                        EntryIterator end() const noexcept;
+                    };
+
+                private:
+                    static const uint32_t cMessageId = 0xffff8100;
+                    static const uint8_t cRebootedFlag = 0x80;
+                    static const uint8_t cUnicastFlag = 0x40;
+                    static const std::size_t cFlagsOffset = 16;
+                    static const std::size_t cEntriesLengthOffset = 20;
+                    static const std::size_t cEntriesOffset = 24;
+                    static const std::size_t cLengthFieldSize = 4;
+                    static const std::size_t cEntrySize = 16;
+
+                    bool mValid;
+
+                public:
+                    SomeIpSdMessageView() = delete;
+
+                    /// @brief Constructor
+                    /// @param data Pointer to the first byte of the serialized message
+                    /// @param size Number of available bytes starting from the data pointer
+                    SomeIpSdMessageView(const uint8_t *data, std::size_t size) noexcept;
+
+                    /// @brief Constructor
+                    /// @param payload Serialized message payload
+                    explicit SomeIpSdMessageView(const std::vector<uint8_t> &payload) noexcept;
+
+                    /// @brief Indicate whether the viewed SD message is well-formed or not
+                    /// @returns True if the general header, the SD header and both arrays lengths are consistent; otherwise false
+                    /// @warning The other accessors must not be called on an invalid view.
+                    bool IsValid() const noexcept override;
+
+                    /// @brief Get the SD header flags
+                    /// @returns SD flags byte
+                    uint8_t Flags() const noexcept;
+
+                    /// @brief Indicate whether the sender has been rebooted or not
+                    /// @returns True if the reboot flag is set; otherwise false
+                    bool Rebooted() const noexcept;
+
+                    /// @brief Indicate whether the sender supports unicast messages or not
+                    /// @returns True if the unicast flag is set; otherwise false
+                    bool UnicastSupported() const noexcept;
+
+                    /// @brief Get the entries array length
+                    /// @returns Entries array length in bytes
+                    uint32_t EntriesLength() const noexcept;
+
+                    /// @brief Get the number of entries
+                    /// @returns Number of entries in the entries array
+                    std::size_t EntryCount() const noexcept;
+
+                    /// @brief Get the options array length
+                    /// @returns Options array length in bytes
+                    uint32_t OptionsLength() const noexcept;
+
+                    /// @brief Get the entries matching a filter without decoding the rest of the message
+                    /// @param filter Filter which is applied on the raw entry bytes
+                    /// @returns Range of lazily decoded matching entries
+                    /// @note Entries with unsupported types are skipped.
+                    EntryRange Entries(EntryFilter filter = EntryFilter()) const noexcept;
+
+                    /// @brief Decode a single option on demand
+                    /// @param index Option index in the options array (e.g., an entry record option index)
+                    /// @param[out] record Decoded option record
+                    /// @returns True if the option exists and is decoded; otherwise false
+                    /// @note Only the length fields of the preceding options are read.
+                    bool TryGetOption(std::size_t index, option::OptionRecord &record) const noexcept;
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,478 @@
+#include <limits>
+#include <stdexcept>
+#include "./someip_sd_multi_server.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                const int SomeIpSdMultiServer::cDefaultTickResolution;
+
+                SomeIpSdMultiServer::SomeIpSdMultiServer(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    int cycleOfferDelay,
+                    uint32_t repetitionMax,
+                    int tickResolution,
+                    std::size_t maxMessageSize) : SomeIpSdMultiServer(
+                                              networkLayer, nullptr,
+                                              initialDelayMin, initialDelayMax,
+                                              repetitionBaseDelay, cycleOfferDelay, repetitionMax,
+                                              tickResolution, maxMessageSize)
+                {
+                }
+
+                SomeIpSdMultiServer::SomeIpSdMultiServer(
+                    SomeIpSdDispatcher *dispatcher,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    int cycleOfferDelay,
+                    uint32_t repetitionMax,
+                    int tickResolution,
+                    std::size_t maxMessageSize) : SomeIpSdMultiServer(
+                                              dispatcher->GetNetworkLayer(), dispatcher,
+                                              initialDelayMin, initialDelayMax,
+                                              repetitionBaseDelay, cycleOfferDelay, repetitionMax,
+                                              tickResolution, maxMessageSize)
+                {
+                }
+
+                SomeIpSdMultiServer::SomeIpSdMultiServer(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                    SomeIpSdDispatcher *dispatcher,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    int cycleOfferDelay,
+                    uint32_t repetitionMax,
+                    int tickResolution,
+                    std::size_t maxMessageSize) : mCommunicationLayer{networkLayer},
+                                          mDispatcher{dispatcher},
+                                          mInitialDelayMin{initialDelayMin},
+                                          mInitialDelayMax{initialDelayMax},
+                                          mRepetitionBaseDelay{repetitionBaseDelay},
+                                          mCycleOfferDelay{cycleOfferDelay},
+                                          mRepetitionMax{static_cast<int>(repetitionMax)},
+                                          mTickResolution{tickResolution},
+                                          mMaxMessageSize{maxMessageSize},
+                                          mRunning{false},
+                                          mWoken{false},
+                                          mSentMessages{0},
+                                          mSentEntries{0}
+                {
+                    if ((initialDelayMin < 0) ||
+                        (initialDelayMax < 0) ||
+                        (initialDelayMin > initialDelayMax))
+                    {
+                        throw std::invalid_argument("Invalid initial delay minimum and/or maximum.");
+                    }
+
+                    if (repetitionBaseDelay < 0)
+                    {
+                        throw std::invalid_argument("Invalid repetition base delay.");
+                    }
+
+                    // The repetition delay is doubled per repetition, so the last one should still fit.
+                    const uint32_t cMaxShift = 31;
+                    if ((repetitionMax > 0) &&
+                        ((repetitionMax - 1 > cMaxShift) ||
+                         ((static_cast<int64_t>(repetitionBaseDelay) << (repetitionMax - 1)) >
+                          std::numeric_limits<int>::max())))
+                    {
+                        throw std::invalid_argument("Repetition maximum overflows the repetition delay.");
+                    }
+
+                    if (cycleOfferDelay <= 0)
+                    {
+                        throw std::invalid_argument("Invalid cyclic offer delay.");
+                    }
+
+                    if (tickResolution < 0)
+                    {
+                        throw std::invalid_argument("Invalid tick resolution.");
+                    }
+
+                    // Validate the message size once rather than on each tick
+                    SomeIpSdPacketizer _packetizer(maxMessageSize);
+
+                    // The findings are routed per service ID via the dispatcher as the services are added.
+                    if (mDispatcher == nullptr)
+                    {
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpSdMultiServer::receiveFind,
+                                this,
+                                std::placeholders::_1);
+                        mCommunicationLayer->SetReceiver(this, _receiver);
+                    }
+                }
+
+                uint32_t SomeIpSdMultiServer::getKey(uint16_t serviceId, uint16_t instanceId) noexcept
+                {
+                    uint32_t _result = (static_cast<uint32_t>(serviceId) << 16) | instanceId;
+                    return _result;
+                }
+
+                void SomeIpSdMultiServer::addEntry(
+                    SomeIpSdPacketizer &packetizer,
+                    const Service &service,
+                    bool offering)
+                {
+                    auto _entry{
+                        offering ? entry::ServiceEntry::CreateOfferServiceEntry(
+                                       service.ServiceId,
+                                       service.InstanceId,
+                                       service.MajorVersion,
+                                       service.MinorVersion)
+                                 : entry::ServiceEntry::CreateStopOfferEntry(
+                                       service.ServiceId,
+                                       service.InstanceId,
+                                       service.MajorVersion,
+                                       service.MinorVersion)};
+
+                    auto _endpointOption{
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            service.IpAddress,
+                            option::Layer4ProtocolType::Tcp,
+                            service.Port)};
+
+                    _entry->AddFirstOption(std::move(_endpointOption));
+                    packetizer.Add(std::move(_entry));
+                }
+
+                bool SomeIpSdMultiServer::matchService(
+                    const Service &service,
+                    const entry::EntryRecord &entry) noexcept
+                {
+                    // Compare service ID, instance ID, major version, and minor version
+                    bool _result =
+                        (entry.ServiceId == service.ServiceId) &&
+                        (entry.InstanceId == entry::Entry::cAnyInstanceId ||
+                         entry.InstanceId == service.InstanceId) &&
+                        (entry.MajorVersion == entry::Entry::cAnyMajorVersion ||
+                         entry.MajorVersion == service.MajorVersion) &&
+                        (entry.MinorVersion == entry::ServiceEntry::cAnyMinorVersion ||
+                         entry.MinorVersion == service.MinorVersion);
+
+                    return _result;
+                }
+
+                void SomeIpSdMultiServer::activate(Service &service, Clock::time_point now)
+                {
+                    std::uniform_int_distribution<int> _distribution(mInitialDelayMin, mInitialDelayMax);
+
+                    service.State = helper::SdServerState::InitialWaitPhase;
+                    service.Repetitions = 0;
+                    service.Deadline = now + std::chrono::milliseconds(_distribution(mGenerator));
+                    service.FindPending = false;
+                }
+
+                void SomeIpSdMultiServer::expire(Service &service, Clock::time_point now)
+                {
+                    // The next deadline is relative to the tick rather than the expired deadline to stay aligned.
+                    if (service.State != helper::SdServerState::MainPhase &&
+                        service.Repetitions < mRepetitionMax)
+                    {
+                        service.State = helper::SdServerState::RepetitionPhase;
+                        service.Deadline =
+                            now + std::chrono::milliseconds(mRepetitionBaseDelay << service.Repetitions);
+                        ++service.Repetitions;
+                    }
+                    else
+                    {
+                        service.State = helper::SdServerState::MainPhase;
+                        service.Deadline = now + std::chrono::milliseconds(mCycleOfferDelay);
+                    }
+                }
+
+                void SomeIpSdMultiServer::send(SomeIpSdMessage &message)
+                {
+                    // Only the shared session ID and the reboot flag are patched into the coalesced message.
+                    mImage.Reset(message);
+                    mImage.Refresh(mSessionMessage);
+                    mCommunicationLayer->SendPayload(mImage.Payload());
+                    mSessionMessage.IncrementSessionId();
+
+                    ++mSentMessages;
+                    mSentEntries += message.EntryRecords().size();
+                }
+
+                void SomeIpSdMultiServer::send(SomeIpSdPacketizer &packetizer)
+                {
+                    packetizer.Flush(
+                        [this](SomeIpSdMessage &message)
+                        { send(message); });
+                }
+
+                void SomeIpSdMultiServer::schedule()
+                {
+                    std::unique_lock<std::mutex> _lock(mMutex);
+
+                    while (mRunning)
+                    {
+                        const Clock::time_point cNow = Clock::now();
+                        const Clock::time_point cHorizon = cNow + mTickResolution;
+                        Clock::time_point _nextDeadline = Clock::time_point::max();
+                        SomeIpSdPacketizer _packetizer(mMaxMessageSize);
+
+                        for (const auto &_service : mStoppedServices)
+                        {
+                            addEntry(_packetizer, _service, false);
+                        }
+                        mStoppedServices.clear();
+
+                        for (auto &_keyServicePair : mServices)
+                        {
+                            Service &_service = _keyServicePair.second;
+
+                            if (_service.Deadline <= cHorizon)
+                            {
+                                addEntry(_packetizer, _service, true);
+                                expire(_service, cNow);
+                            }
+                            else if (_service.FindPending)
+                            {
+                                addEntry(_packetizer, _service, true);
+                            }
+
+                            _service.FindPending = false;
+                            if (_service.Deadline < _nextDeadline)
+                            {
+                                _nextDeadline = _service.Deadline;
+                            }
+                        }
+
+                        mWoken = false;
+
+                        if (_packetizer.Pending() > 0)
+                        {
+                            _lock.unlock();
+                            send(_packetizer);
+                            _lock.lock();
+                        }
+                        else if (_nextDeadline == Clock::time_point::max())
+                        {
+                            mConditionVariable.wait(
+                                _lock, [this]()
+                                { return !mRunning || mWoken; });
+                        }
+                        else
+                        {
+                            mConditionVariable.wait_until(
+                                _lock, _nextDeadline, [this]()
+                                { return !mRunning || mWoken; });
+                        }
+                    }
+                }
+
+                void SomeIpSdMultiServer::onFind(
+                    const std::shared_ptr<const SomeIpSdMessage> & /*message*/,
+                    const entry::EntryRecord &entry)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    // Scan all the instances of the service, because the finding may ask for any instance.
+                    auto _itr = mServices.lower_bound(getKey(entry.ServiceId, 0));
+                    const auto cEnd = mServices.upper_bound(getKey(entry.ServiceId, 0xffff));
+
+                    for (; _itr != cEnd; ++_itr)
+                    {
+                        Service &_service = _itr->second;
+
+                        // A service in its initial wait phase does not answer the findings.
+                        if ((_service.State == helper::SdServerState::RepetitionPhase ||
+                             _service.State == helper::SdServerState::MainPhase) &&
+                            matchService(_service, entry))
+                        {
+                            _service.FindPending = true;
+                            mWoken = true;
+                        }
+                    }
+
+                    if (mWoken)
+                    {
+                        mConditionVariable.notify_one();
+                    }
+                }
+
+                void SomeIpSdMultiServer::receiveFind(std::shared_ptr<const SomeIpSdMessage> message)
+                {
+                    for (const auto &_entry : message->EntryRecords())
+                    {
+                        if (_entry.Type == entry::EntryType::Finding)
+                        {
+                            onFind(message, _entry);
+                        }
+                    }
+                }
+
+                void SomeIpSdMultiServer::AddService(
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint32_t minorVersion,
+                    helper::Ipv4Address ipAddress,
+                    uint16_t port)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    const uint32_t cKey = getKey(serviceId, instanceId);
+                    if (mServices.find(cKey) != mServices.end())
+                    {
+                        throw std::invalid_argument("The service instance is already added.");
+                    }
+
+                    Service _service{
+                        serviceId, instanceId, majorVersion, minorVersion, ipAddress, port,
+                        helper::SdServerState::NotReady, 0, Clock::time_point::max(), false};
+
+                    if (mRunning)
+                    {
+                        activate(_service, Clock::now());
+                        mWoken = true;
+                        mConditionVariable.notify_one();
+                    }
+
+                    mServices.emplace(cKey, _service);
+
+                    if (mDispatcher && mRegisteredServiceIds.insert(serviceId).second)
+                    {
+                        auto _handler =
+                            std::bind(
+                                &SomeIpSdMultiServer::onFind,
+                                this,
+                                std::placeholders::_1,
+                                std::placeholders::_2);
+                        mDispatcher->Register(
+                            this, entry::EntryType::Finding, serviceId, entry::Entry::cAnyInstanceId, _handler);
+                    }
+                }
+
+                void SomeIpSdMultiServer::RemoveService(uint16_t serviceId, uint16_t instanceId)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mServices.find(getKey(serviceId, instanceId));
+                    if (_itr == mServices.end())
+                    {
+                        return;
+                    }
+
+                    // Only the services offered in the initial wait phase never sent an offer to stop.
+                    if (mRunning && _itr->second.State != helper::SdServerState::InitialWaitPhase)
+                    {
+                        mStoppedServices.push_back(_itr->second);
+                        mWoken = true;
+                        mConditionVariable.notify_one();
+                    }
+
+                    mServices.erase(_itr);
+                }
+
+                void SomeIpSdMultiServer::Start()
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    if (mRunning)
+                    {
+                        return;
+                    }
+
+                    const Clock::time_point cNow = Clock::now();
+                    for (auto &_keyServicePair : mServices)
+                    {
+                        activate(_keyServicePair.second, cNow);
+                    }
+
+                    mRunning = true;
+                    mScheduler = std::thread(&SomeIpSdMultiServer::schedule, this);
+                }
+
+                void SomeIpSdMultiServer::Stop()
+                {
+                    SomeIpSdPacketizer _packetizer(mMaxMessageSize);
+
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+
+                        if (!mRunning)
+                        {
+                            return;
+                        }
+
+                        mRunning = false;
+                        mConditionVariable.notify_one();
+
+                        for (const auto &_service : mStoppedServices)
+                        {
+                            addEntry(_packetizer, _service, false);
+                        }
+                        mStoppedServices.clear();
+
+                        for (auto &_keyServicePair : mServices)
+                        {
+                            Service &_service = _keyServicePair.second;
+                            if (_service.State != helper::SdServerState::InitialWaitPhase)
+                            {
+                                addEntry(_packetizer, _service, false);
+                            }
+
+                            _service.State = helper::SdServerState::NotReady;
+                            _service.Deadline = Clock::time_point::max();
+                        }
+                    }
+
+                    mScheduler.join();
+                    send(_packetizer);
+                }
+
+                helper::SdServerState SomeIpSdMultiServer::GetState(uint16_t serviceId, uint16_t instanceId)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    auto _itr = mServices.find(getKey(serviceId, instanceId));
+                    if (_itr == mServices.end())
+                    {
+                        return helper::SdServerState::NotReady;
+                    }
+                    else
+                    {
+                        return _itr->second.State;
+                    }
+                }
+
+                std::size_t SomeIpSdMultiServer::SentMessages() const noexcept
+                {
+                    return mSentMessages;
+                }
+
+                std::size_t SomeIpSdMultiServer::SentEntries() const noexcept
+                {
+                    return mSentEntries;
+                }
+
+                SomeIpSdMultiServer::~SomeIpSdMultiServer()
+                {
+                    Stop();
+
+                    if (mDispatcher)
+                    {
+                        mDispatcher->Unregister(this);
+                    }
+                    else
+                    {
+                        mCommunicationLayer->ResetReceiver(this);
+                    }
+                }
+            }
+        }
+    }
+}
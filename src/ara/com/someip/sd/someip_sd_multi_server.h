@@ -0,0 +1,203 @@
+#ifndef SOMEIP_SD_MULTI_SERVER
+#define SOMEIP_SD_MULTI_SERVER
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+#include "../../helper/ipv4_address.h"
+#include "../../helper/machine_state.h"
+#include "../../helper/network_layer.h"
+#include "../../entry/service_entry.h"
+#include "../../option/ipv4_endpoint_option.h"
+#include "./someip_sd_dispatcher.h"
+#include "./someip_sd_packetizer.h"
+#include "./someip_sd_wire_image.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief SOME/IP service discovery server which offers multiple service instances
+                /// @details A single scheduler thread drives the initial wait, repetition, and main phases of
+                /// all the service instances. The offers which are due within the same scheduler tick, together with
+                /// the offers answering the received findings, are coalesced and packed into as few SD messages
+                /// as the maximum message size allows.
+                /// A service whose offer fires early within a tick is re-aligned to the tick, so the cyclic offers
+                /// of the services converge to the same messages.
+                class SomeIpSdMultiServer
+                {
+                private:
+                    using Clock = std::chrono::steady_clock;
+
+                    struct Service
+                    {
+                        uint16_t ServiceId;
+                        uint16_t InstanceId;
+                        uint8_t MajorVersion;
+                        uint32_t MinorVersion;
+                        helper::Ipv4Address IpAddress;
+                        uint16_t Port;
+                        helper::SdServerState State;
+                        int Repetitions;
+                        Clock::time_point Deadline;
+                        bool FindPending;
+                    };
+
+                    helper::NetworkLayer<SomeIpSdMessage> *const mCommunicationLayer;
+                    SomeIpSdDispatcher *const mDispatcher;
+                    const int mInitialDelayMin;
+                    const int mInitialDelayMax;
+                    const int mRepetitionBaseDelay;
+                    const int mCycleOfferDelay;
+                    const int mRepetitionMax;
+                    const std::chrono::milliseconds mTickResolution;
+                    const std::size_t mMaxMessageSize;
+                    std::default_random_engine mGenerator;
+                    std::map<uint32_t, Service> mServices;
+                    std::set<uint16_t> mRegisteredServiceIds;
+                    std::vector<Service> mStoppedServices;
+                    std::mutex mMutex;
+                    std::condition_variable mConditionVariable;
+                    bool mRunning;
+                    bool mWoken;
+                    std::thread mScheduler;
+                    SomeIpSdMessage mSessionMessage;
+                    SomeIpSdWireImage mImage;
+                    std::atomic_size_t mSentMessages;
+                    std::atomic_size_t mSentEntries;
+
+                    SomeIpSdMultiServer(
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                        SomeIpSdDispatcher *dispatcher,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        int cycleOfferDelay,
+                        uint32_t repetitionMax,
+                        int tickResolution,
+                        std::size_t maxMessageSize);
+
+                    static uint32_t getKey(uint16_t serviceId, uint16_t instanceId) noexcept;
+                    static void addEntry(SomeIpSdPacketizer &packetizer, const Service &service, bool offering);
+                    static bool matchService(const Service &service, const entry::EntryRecord &entry) noexcept;
+                    void activate(Service &service, Clock::time_point now);
+                    void expire(Service &service, Clock::time_point now);
+                    void schedule();
+                    void send(SomeIpSdMessage &message);
+                    void send(SomeIpSdPacketizer &packetizer);
+                    void onFind(
+                        const std::shared_ptr<const SomeIpSdMessage> &message,
+                        const entry::EntryRecord &entry);
+                    void receiveFind(std::shared_ptr<const SomeIpSdMessage> message);
+
+                public:
+                    /// @brief Default scheduler tick resolution in milliseconds
+                    static const int cDefaultTickResolution = 10;
+
+                    SomeIpSdMultiServer() = delete;
+                    SomeIpSdMultiServer(const SomeIpSdMultiServer &) = delete;
+                    SomeIpSdMultiServer &operator=(const SomeIpSdMultiServer &) = delete;
+
+                    /// @brief Constructor
+                    /// @param networkLayer Network communication abstraction layer
+                    /// @param initialDelayMin Minimum initial delay
+                    /// @param initialDelayMax Maximum initial delay
+                    /// @param repetitionBaseDelay Repetition phase delay
+                    /// @param cycleOfferDelay Cycle offer delay in the main phase
+                    /// @param repetitionMax Maximum message count in the repetition phase
+                    /// @param tickResolution Window in milliseconds within which the due offers are coalesced
+                    /// @param maxMessageSize Maximum serialized SD message size in bytes
+                    /// @throws std::invalid_argument Throws if a delay or the maximum message size is invalid,
+                    /// or if the last repetition delay overflows
+                    SomeIpSdMultiServer(
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        int cycleOfferDelay,
+                        uint32_t repetitionMax,
+                        int tickResolution = cDefaultTickResolution,
+                        std::size_t maxMessageSize = SomeIpSdPacketizer::cDefaultMaxMessageSize);
+
+                    /// @brief Constructor
+                    /// @param dispatcher Entry dispatcher which routes only the offered services finding entries to the server
+                    /// @param initialDelayMin Minimum initial delay
+                    /// @param initialDelayMax Maximum initial delay
+                    /// @param repetitionBaseDelay Repetition phase delay
+                    /// @param cycleOfferDelay Cycle offer delay in the main phase
+                    /// @param repetitionMax Maximum message count in the repetition phase
+                    /// @param tickResolution Window in milliseconds within which the due offers are coalesced
+                    /// @param maxMessageSize Maximum serialized SD message size in bytes
+                    /// @throws std::invalid_argument Throws if a delay or the maximum message size is invalid,
+                    /// or if the last repetition delay overflows
+                    SomeIpSdMultiServer(
+                        SomeIpSdDispatcher *dispatcher,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        int cycleOfferDelay,
+                        uint32_t repetitionMax,
+                        int tickResolution = cDefaultTickResolution,
+                        std::size_t maxMessageSize = SomeIpSdPacketizer::cDefaultMaxMessageSize);
+
+                    ~SomeIpSdMultiServer();
+
+                    /// @brief Add a service instance to offer
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @param majorVersion Service major version
+                    /// @param minorVersion Service minor version
+                    /// @param ipAddress Service unicast endpoint IP Address
+                    /// @param port Service unicast endpoint TCP port number
+                    /// @throws std::invalid_argument Throws if the service instance is already added
+                    /// @note A service added to a running server enters its initial wait phase right away.
+                    void AddService(
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint32_t minorVersion,
+                        helper::Ipv4Address ipAddress,
+                        uint16_t port);
+
+                    /// @brief Remove an offered service instance
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @note The stop offer of an offered service is coalesced with the offers of the next tick.
+                    void RemoveService(uint16_t serviceId, uint16_t instanceId);
+
+                    /// @brief Start offering all the added services
+                    void Start();
+
+                    /// @brief Stop offering all the services via coalesced stop offer messages
+                    void Stop();
+
+                    /// @brief Get a service instance state
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @returns Service instance machine state which is not-ready for an unknown service instance
+                    helper::SdServerState GetState(uint16_t serviceId, uint16_t instanceId);
+
+                    /// @brief Get the number of the sent SD messages
+                    /// @returns Number of the sent messages
+                    std::size_t SentMessages() const noexcept;
+
+                    /// @brief Get the number of the sent SD entries
+                    /// @returns Number of the offer and stop offer entries within the sent messages
+                    std::size_t SentEntries() const noexcept;
+                };
+            }
+        }
+    }
+}
+
+#endif
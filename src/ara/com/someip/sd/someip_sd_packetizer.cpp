@@ -0,0 +1,62 @@
+#include <stdexcept>
+#include "./someip_sd_packetizer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                const std::size_t SomeIpSdPacketizer::cMaxOptionsPerMessage;
+                const std::size_t SomeIpSdPacketizer::cEmptyMessageSize;
+                const std::size_t SomeIpSdPacketizer::cDefaultMaxMessageSize;
+
+                SomeIpSdPacketizer::SomeIpSdPacketizer(
+                    std::size_t maxMessageSize) : mMaxMessageSize{maxMessageSize}
+                {
+                    if (maxMessageSize < cEmptyMessageSize + entry::Entry::cEntrySize)
+                    {
+                        throw std::invalid_argument("The maximum message size does not fit an entry.");
+                    }
+                }
+
+                std::size_t SomeIpSdPacketizer::getOptionsSize(const entry::Entry &entry) noexcept
+                {
+                    std::size_t _result = 0;
+
+                    for (auto &firstOption : entry.FirstOptions())
+                    {
+                        _result += firstOption->Size();
+                    }
+
+                    for (auto &secondOption : entry.SecondOptions())
+                    {
+                        _result += secondOption->Size();
+                    }
+
+                    return _result;
+                }
+
+                void SomeIpSdPacketizer::Add(std::unique_ptr<entry::Entry> entry)
+                {
+                    const std::size_t cSize =
+                        cEmptyMessageSize + entry::Entry::cEntrySize + getOptionsSize(*entry);
+
+                    if (cSize > mMaxMessageSize)
+                    {
+                        throw std::invalid_argument("The entry exceeds the maximum message size.");
+                    }
+
+                    mEntries.push_back(std::move(entry));
+                }
+
+                std::size_t SomeIpSdPacketizer::Pending() const noexcept
+                {
+                    return mEntries.size();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef SOMEIP_SD_PACKETIZER_H
+#define SOMEIP_SD_PACKETIZER_H
+
+#include <deque>
+#include "./someip_sd_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief Packetizer that packs pending SD entries into size-limited SD messages
+                /// @details The entries are packed in their queuing order, and a message is only closed when the
+                /// next entry and its options do not fit anymore. For an order-preserving split, this greedy filling
+                /// results in the minimum number of messages. Each message indexes only its own options, and the option runs
+                /// shared with the already packed entries of the same message do not count towards its size.
+                class SomeIpSdPacketizer
+                {
+                private:
+                    static const std::size_t cMaxOptionsPerMessage = 256;
+
+                    const std::size_t mMaxMessageSize;
+                    std::deque<std::unique_ptr<entry::Entry>> mEntries;
+
+                    static std::size_t getOptionsSize(const entry::Entry &entry) noexcept;
+
+                public:
+                    /// @brief SD message size without any entry and option in bytes
+                    static const std::size_t cEmptyMessageSize = 28;
+
+                    /// @brief Default maximum message size in bytes which fits an Ethernet MTU with headroom
+                    static const std::size_t cDefaultMaxMessageSize = 1400;
+
+                    SomeIpSdPacketizer(const SomeIpSdPacketizer &) = delete;
+                    SomeIpSdPacketizer &operator=(const SomeIpSdPacketizer &) = delete;
+
+                    /// @brief Constructor
+                    /// @param maxMessageSize Maximum serialized SD message size in bytes
+                    /// @throws std::invalid_argument Throws if the size does not fit a single entry
+                    explicit SomeIpSdPacketizer(std::size_t maxMessageSize = cDefaultMaxMessageSize);
+
+                    /// @brief Queue an entry together with its options
+                    /// @param entry Entry to be packed
+                    /// @throws std::invalid_argument Throws if the entry and its options alone exceed the maximum size
+                    void Add(std::unique_ptr<entry::Entry> entry);
+
+                    /// @brief Get the number of the queued entries
+                    /// @returns Number of the entries waiting to be packed
+                    std::size_t Pending() const noexcept;
+
+                    /// @brief Pack all the queued entries into messages
+                    /// @tparam F Callback type invocable with a message lvalue
+                    /// @param callback Callback to be invoked per packed message in order (e.g., to set the session ID and send it)
+                    /// @returns Number of the packed messages
+                    template <typename F>
+                    std::size_t Flush(F &&callback)
+                    {
+                        std::size_t _result = 0;
+
+                        while (!mEntries.empty())
+                        {
+                            SomeIpSdMessage _message;
+
+                            while (!mEntries.empty())
+                            {
+                                std::size_t _addedOptions;
+                                const std::size_t cAddedLength =
+                                    _message.AddedLength(*mEntries.front(), _addedOptions);
+
+                                // An entry is always added to an empty message, because it fits alone.
+                                if (!_message.EntryRecords().empty() &&
+                                    (_message.Size() + cAddedLength > mMaxMessageSize ||
+                                     _message.OptionRecords().size() + _addedOptions > cMaxOptionsPerMessage))
+                                {
+                                    break;
+                                }
+
+                                _message.AddEntry(std::move(mEntries.front()));
+                                mEntries.pop_front();
+                            }
+
+                            callback(_message);
+                            ++_result;
+                        }
+
+                        return _result;
+                    }
+                };
+            }
+        }
+    }
+}
+
+#endif
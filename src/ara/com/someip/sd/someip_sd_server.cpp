@@ -1,5 +1,4 @@
 #include <stdexcept>
-#include <thread>
 #include "./someip_sd_server.h"
 
 namespace ara
@@ -22,7 +21,50 @@ namespace ara
                     int initialDelayMax,
                     int repetitionBaseDelay,
                     int cycleOfferDelay,
-                    uint32_t repetitionMax) : SomeIpSdAgent<helper::SdServerState>(networkLayer),
+                    uint32_t repetitionMax) : SomeIpSdServer(
+                                                  networkLayer, nullptr,
+                                                  serviceId, instanceId, majorVersion, minorVersion,
+                                                  ipAddress, port,
+                                                  initialDelayMin, initialDelayMax,
+                                                  repetitionBaseDelay, cycleOfferDelay, repetitionMax)
+                {
+                }
+
+                SomeIpSdServer::SomeIpSdServer(
+                    SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint32_t minorVersion,
+                    helper::Ipv4Address ipAddress,
+                    uint16_t port,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    int cycleOfferDelay,
+                    uint32_t repetitionMax) : SomeIpSdServer(
+                                                  dispatcher->GetNetworkLayer(), dispatcher,
+                                                  serviceId, instanceId, majorVersion, minorVersion,
+                                                  ipAddress, port,
+                                                  initialDelayMin, initialDelayMax,
+                                                  repetitionBaseDelay, cycleOfferDelay, repetitionMax)
+                {
+                }
+
+                SomeIpSdServer::SomeIpSdServer(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                    SomeIpSdDispatcher *dispatcher,
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint32_t minorVersion,
+                    helper::Ipv4Address ipAddress,
+                    uint16_t port,
+                    int initialDelayMin,
+                    int initialDelayMax,
+                    int repetitionBaseDelay,
+                    int cycleOfferDelay,
+                    uint32_t repetitionMax) : SomeIpSdAgent<helper::SdServerState>(networkLayer, dispatcher),
                                               mNotReadyState(
                                                   std::bind(&SomeIpSdServer::onServiceStopped, this)),
                                               mInitialWaitState(
@@ -42,6 +84,7 @@ namespace ara
                                               mMainState(
                                                   std::bind(&SomeIpSdServer::sendOffer, this),
                                                   cycleOfferDelay),
+                                              mFindPending{false},
                                               mServiceId{serviceId},
                                               mInstanceId{instanceId},
                                               mMajorVersion{majorVersion},
@@ -81,79 +124,119 @@ namespace ara
                     _stopOfferEntry->AddFirstOption(std::move(_stopOfferEndpointOption));
                     mStopOfferMessage.AddEntry(std::move(_stopOfferEntry));
 
+                    // The entries never change, so the messages are encoded only once.
+                    mOfferServiceImage.Reset(mOfferServiceMessage);
+                    mStopOfferImage.Reset(mStopOfferMessage);
+
                     this->StateMachine.Initialize({&mNotReadyState,
                                                    &mInitialWaitState,
                                                    &mRepetitionState,
                                                    &mMainState},
                                                   helper::SdServerState::NotReady);
 
-                    auto _receiver =
-                        std::bind(
-                            &SomeIpSdServer::receiveFind,
-                            this,
-                            std::placeholders::_1);
-                    this->CommunicationLayer->SetReceiver(this, _receiver);
+                    if (dispatcher)
+                    {
+                        auto _handler =
+                            std::bind(
+                                &SomeIpSdServer::onFind,
+                                this,
+                                std::placeholders::_1,
+                                std::placeholders::_2);
+                        this->Dispatcher->Register(
+                            this, entry::EntryType::Finding, serviceId, instanceId, _handler);
+                    }
+                    else
+                    {
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpSdServer::receiveFind,
+                                this,
+                                std::placeholders::_1);
+                        this->CommunicationLayer->SetReceiver(this, _receiver);
+                    }
                 }
 
-                bool SomeIpSdServer::matchOfferingService(const SomeIpSdMessage &message) const
+                bool SomeIpSdServer::matchOfferingService(const entry::EntryRecord &entry) const
                 {
-                    // Iterate over all the message entry to search for the first Service Finding entry
-                    for (auto &_entry : message.Entries())
-                    {
-                        if (_entry->Type() == entry::EntryType::Finding)
-                        {
-                            if (auto _serviceEnty = dynamic_cast<entry::ServiceEntry *>(_entry.get()))
-                            {
-                                // Compare service ID, instance ID, major version, and minor version
-                                bool _result =
-                                    (_serviceEnty->ServiceId() == mServiceId) &&
-                                    (_serviceEnty->InstanceId() == entry::Entry::cAnyInstanceId ||
-                                     _serviceEnty->InstanceId() == mInstanceId) &&
-                                    (_serviceEnty->MajorVersion() == entry::Entry::cAnyMajorVersion ||
-                                     _serviceEnty->MajorVersion() == mMajorVersion) &&
-                                    (_serviceEnty->MinorVersion() == entry::ServiceEntry::cAnyMinorVersion ||
-                                     _serviceEnty->MinorVersion() == mMinorVersion);
-
-                                return _result;
-                            }
-                        }
-                    }
+                    // Compare service ID, instance ID, major version, and minor version
+                    bool _result =
+                        (entry.ServiceId == mServiceId) &&
+                        (entry.InstanceId == entry::Entry::cAnyInstanceId ||
+                         entry.InstanceId == mInstanceId) &&
+                        (entry.MajorVersion == entry::Entry::cAnyMajorVersion ||
+                         entry.MajorVersion == mMajorVersion) &&
+                        (entry.MinorVersion == entry::ServiceEntry::cAnyMinorVersion ||
+                         entry.MinorVersion == mMinorVersion);
 
-                    return false;
+                    return _result;
+                }
+
+                void SomeIpSdServer::sendOfferImage()
+                {
+                    // The network layer does not report the sender of a received message,
+                    // so a finding is answered via the same multicast offer instead of a unicast one.
+                    mOfferServiceImage.Refresh(mOfferServiceMessage);
+                    this->CommunicationLayer->SendPayload(mOfferServiceImage.Payload());
+                    mOfferServiceMessage.IncrementSessionId();
                 }
 
                 void SomeIpSdServer::sendOffer()
                 {
-                    // Avoid starvation
-                    while (!mMessageBuffer.Empty())
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+
+                    // Answer the findings received during the initial wait phase at once
+                    if (mFindPending)
+                    {
+                        sendOfferImage();
+                        mFindPending = false;
+                    }
+                }
+
+                void SomeIpSdServer::onFind(
+                    const std::shared_ptr<const SomeIpSdMessage> & /*message*/,
+                    const entry::EntryRecord &entry)
+                {
+                    bool _matches = matchOfferingService(entry);
+                    if (_matches)
                     {
-                        SomeIpSdMessage _message;
-                        if (mMessageBuffer.TryDequeue(_message))
+                        // The state is checked under the lock, so no offer can follow the stop offer.
+                        std::lock_guard<std::mutex> _lock(mSendMutex);
+                        helper::SdServerState _state = GetState();
+
+                        if (_state == helper::SdServerState::RepetitionPhase ||
+                            _state == helper::SdServerState::MainPhase)
                         {
-                            this->CommunicationLayer->Send(mOfferServiceMessage);
-                            mOfferServiceMessage.IncrementSessionId();
+                            // Answer the finding directly from the receiving thread (via multicast)
+                            sendOfferImage();
+                        }
+                        else if (_state == helper::SdServerState::InitialWaitPhase)
+                        {
+                            // Defer the answer to the end of the initial wait phase
+                            mFindPending = true;
                         }
-
-                        std::this_thread::yield();
                     }
                 }
 
-                void SomeIpSdServer::receiveFind(SomeIpSdMessage &&message)
+                void SomeIpSdServer::receiveFind(std::shared_ptr<const SomeIpSdMessage> message)
                 {
-                    bool _matches = matchOfferingService(message);
-                    // Enqueue the offer if the finding message matches the service
-                    if (_matches)
+                    // Iterate over all the message entry records to search for the first Service Finding entry
+                    for (const auto &_entry : message->EntryRecords())
                     {
-                        while (!mMessageBuffer.TryEnqueue(std::move(message)))
+                        if (_entry.Type == entry::EntryType::Finding)
                         {
-                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                            onFind(message, _entry);
+                            return;
                         }
                     }
                 }
 
                 void SomeIpSdServer::onServiceStopped()
                 {
-                    this->CommunicationLayer->Send(mStopOfferMessage);
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+                    mFindPending = false;
+
+                    mStopOfferImage.Refresh(mStopOfferMessage);
+                    this->CommunicationLayer->SendPayload(mStopOfferImage.Payload());
                     mStopOfferMessage.IncrementSessionId();
                 }
 
@@ -161,7 +244,7 @@ namespace ara
                 {
                     if (state == helper::SdServerState::NotReady)
                     {
-                        // Set the timer from a new thread with a random initial delay.
+                        // Activate the service from a new thread which only arms the initial wait timer.
                         this->Future =
                             std::async(
                                 std::launch::async,
@@ -1,7 +1,7 @@
 #ifndef SOMEIP_SD_SERVER
 #define SOMEIP_SD_SERVER
 
-#include "../../helper/concurrent_queue.h"
+#include <mutex>
 #include "../../helper/ipv4_address.h"
 #include "../../entry/service_entry.h"
 #include "../../option/ipv4_endpoint_option.h"
@@ -10,6 +10,7 @@
 #include "./fsm/repetition_state.h"
 #include "./fsm/main_state.h"
 #include "./someip_sd_agent.h"
+#include "./someip_sd_wire_image.h"
 
 namespace ara
 {
@@ -23,21 +24,43 @@ namespace ara
                 class SomeIpSdServer : public SomeIpSdAgent<helper::SdServerState>
                 {
                 private:
-                    helper::ConcurrentQueue<SomeIpSdMessage> mMessageBuffer;
                     SomeIpSdMessage mOfferServiceMessage;
                     SomeIpSdMessage mStopOfferMessage;
+                    SomeIpSdWireImage mOfferServiceImage;
+                    SomeIpSdWireImage mStopOfferImage;
                     fsm::NotReadyState mNotReadyState;
                     fsm::InitialWaitState<helper::SdServerState> mInitialWaitState;
                     fsm::RepetitionState<helper::SdServerState> mRepetitionState;
                     fsm::MainState mMainState;
+                    std::mutex mSendMutex;
+                    bool mFindPending;
                     const uint16_t mServiceId;
                     const uint16_t mInstanceId;
                     const uint8_t mMajorVersion;
                     const uint32_t mMinorVersion;
 
+                    SomeIpSdServer(
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer,
+                        SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint32_t minorVersion,
+                        helper::Ipv4Address ipAddress,
+                        uint16_t port,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        int cycleOfferDelay,
+                        uint32_t repetitionMax);
+
+                    void sendOfferImage();
                     void sendOffer();
-                    bool matchOfferingService(const SomeIpSdMessage &message) const;
-                    void receiveFind(SomeIpSdMessage &&message);
+                    bool matchOfferingService(const entry::EntryRecord &entry) const;
+                    void onFind(
+                        const std::shared_ptr<const SomeIpSdMessage> &message,
+                        const entry::EntryRecord &entry);
+                    void receiveFind(std::shared_ptr<const SomeIpSdMessage> message);
                     void onServiceStopped();
 
                 protected:
@@ -74,6 +97,33 @@ namespace ara
                         int cycleOfferDelay,
                         uint32_t repetitionMax);
 
+                    /// @brief Constructor
+                    /// @param dispatcher Entry dispatcher which routes only the service finding entries to the server
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID
+                    /// @param majorVersion Service major version
+                    /// @param minorVersion Service minor version
+                    /// @param ipAddress Service unicast endpoint IP Address
+                    /// @param port Service unicast endpoint TCP port number
+                    /// @param initialDelayMin Minimum initial delay
+                    /// @param initialDelayMax Maximum initial delay
+                    /// @param repetitionBaseDelay Repetition phase delay
+                    /// @param cycleOfferDelay Cycle offer delay in the main phase
+                    /// @param repetitionMax Maximum message count in the repetition phase
+                    SomeIpSdServer(
+                        SomeIpSdDispatcher *dispatcher,
+                        uint16_t serviceId,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint32_t minorVersion,
+                        helper::Ipv4Address ipAddress,
+                        uint16_t port,
+                        int initialDelayMin,
+                        int initialDelayMax,
+                        int repetitionBaseDelay,
+                        int cycleOfferDelay,
+                        uint32_t repetitionMax);
+
                     ~SomeIpSdServer() override;
                 };
             }
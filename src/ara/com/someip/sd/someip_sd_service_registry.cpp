@@ -0,0 +1,313 @@
+#include <algorithm>
+#include "./someip_sd_service_registry.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                const uint32_t SomeIpSdServiceRegistry::cInfiniteTtl;
+
+                SomeIpSdServiceRegistry::SomeIpSdServiceRegistry() noexcept : mNetworkLayer{nullptr},
+                                                                              mNextExpiry{Clock::time_point::max()}
+                {
+                }
+
+                SomeIpSdServiceRegistry::SomeIpSdServiceRegistry(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer) : mNetworkLayer{networkLayer},
+                                                                           mNextExpiry{Clock::time_point::max()}
+                {
+                    auto _receiver =
+                        std::bind(
+                            &SomeIpSdServiceRegistry::onPayloadReceived,
+                            this,
+                            std::placeholders::_1,
+                            std::placeholders::_2);
+                    mNetworkLayer->SetPayloadReceiver(this, _receiver);
+                }
+
+                std::shared_ptr<SomeIpSdServiceRegistry> SomeIpSdServiceRegistry::Shared(
+                    helper::NetworkLayer<SomeIpSdMessage> *networkLayer)
+                {
+                    // The registries are weakly held, so the last user of a network layer registry releases it.
+                    static std::map<
+                        helper::NetworkLayer<SomeIpSdMessage> *,
+                        std::weak_ptr<SomeIpSdServiceRegistry>>
+                        _registries;
+                    static std::mutex _mutex;
+                    std::lock_guard<std::mutex> _lock(_mutex);
+
+                    std::shared_ptr<SomeIpSdServiceRegistry> _result{_registries[networkLayer].lock()};
+                    if (!_result)
+                    {
+                        _result = std::make_shared<SomeIpSdServiceRegistry>(networkLayer);
+                        _registries[networkLayer] = _result;
+                    }
+
+                    return _result;
+                }
+
+                bool SomeIpSdServiceRegistry::matchInstance(
+                    const ServiceInstance &instance,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint32_t minorVersion) noexcept
+                {
+                    bool _result =
+                        (instanceId == entry::Entry::cAnyInstanceId ||
+                         instanceId == instance.InstanceId) &&
+                        (majorVersion == entry::Entry::cAnyMajorVersion ||
+                         majorVersion == instance.MajorVersion) &&
+                        (minorVersion == entry::ServiceEntry::cAnyMinorVersion ||
+                         minorVersion == instance.MinorVersion);
+
+                    return _result;
+                }
+
+                bool SomeIpSdServiceRegistry::tryGetInstance(
+                    const Record &record,
+                    Clock::time_point now,
+                    ServiceInstance &instance) noexcept
+                {
+                    if (record.Expiry <= now)
+                    {
+                        return false;
+                    }
+
+                    instance = record.Instance;
+
+                    // An infinite TTL is kept as it is; otherwise the remaining seconds are rounded up.
+                    if (record.Expiry != Clock::time_point::max())
+                    {
+                        const auto cRemaining = record.Expiry - now;
+                        const auto cSeconds =
+                            std::chrono::duration_cast<std::chrono::seconds>(
+                                cRemaining + std::chrono::seconds(1) - Clock::duration(1));
+                        instance.TTL = static_cast<uint32_t>(cSeconds.count());
+                    }
+
+                    return true;
+                }
+
+                void SomeIpSdServiceRegistry::setEndpoint(
+                    const SomeIpSdMessage &message,
+                    const entry::EntryRecord &entry,
+                    ServiceInstance &instance)
+                {
+                    const auto &cOptions = message.OptionRecords();
+                    for (std::size_t i = 0; i < entry.FirstOptionCount; ++i)
+                    {
+                        const std::size_t cIndex = entry.FirstOptionIndex + i;
+                        if (cIndex < cOptions.size() &&
+                            cOptions[cIndex].Type == option::OptionType::IPv4Endpoint)
+                        {
+                            instance.HasEndpoint = true;
+                            instance.Endpoint = cOptions[cIndex];
+                            return;
+                        }
+                    }
+                }
+
+                void SomeIpSdServiceRegistry::setEndpoint(
+                    const SomeIpSdMessageView &view,
+                    const entry::EntryRecord &entry,
+                    ServiceInstance &instance) noexcept
+                {
+                    // Only the options referred by the offer are decoded.
+                    for (std::size_t i = 0; i < entry.FirstOptionCount; ++i)
+                    {
+                        option::OptionRecord _option;
+                        if (view.TryGetOption(entry.FirstOptionIndex + i, _option) &&
+                            _option.Type == option::OptionType::IPv4Endpoint)
+                        {
+                            instance.HasEndpoint = true;
+                            instance.Endpoint = _option;
+                            return;
+                        }
+                    }
+                }
+
+                template <typename T>
+                void SomeIpSdServiceRegistry::update(
+                    const T &message,
+                    const entry::EntryRecord &entry,
+                    Clock::time_point now)
+                {
+                    const Key cFirst{entry.ServiceId, entry.InstanceId, entry.MajorVersion, 0};
+
+                    if (entry.TTL == 0)
+                    {
+                        // Stop offer of the instance regardless of its minor version
+                        auto _itr = mRecords.lower_bound(cFirst);
+                        while (_itr != mRecords.end() &&
+                               std::get<0>(_itr->first) == entry.ServiceId &&
+                               std::get<1>(_itr->first) == entry.InstanceId &&
+                               std::get<2>(_itr->first) == entry.MajorVersion)
+                        {
+                            _itr = mRecords.erase(_itr);
+                        }
+
+                        return;
+                    }
+
+                    Record _record;
+                    ServiceInstance &_instance = _record.Instance;
+                    _instance.ServiceId = entry.ServiceId;
+                    _instance.InstanceId = entry.InstanceId;
+                    _instance.MajorVersion = entry.MajorVersion;
+                    _instance.MinorVersion = entry.MinorVersion;
+                    _instance.TTL = entry.TTL;
+                    _instance.HasEndpoint = false;
+                    setEndpoint(message, entry, _instance);
+
+                    if (entry.TTL == cInfiniteTtl)
+                    {
+                        _record.Expiry = Clock::time_point::max();
+                    }
+                    else
+                    {
+                        _record.Expiry = now + std::chrono::seconds(entry.TTL);
+                    }
+
+                    const Key cKey{entry.ServiceId, entry.InstanceId, entry.MajorVersion, entry.MinorVersion};
+                    mRecords[cKey] = _record;
+                    mNextExpiry = std::min(mNextExpiry, _record.Expiry);
+                }
+
+                void SomeIpSdServiceRegistry::purge(Clock::time_point now)
+                {
+                    // The records are only scanned when at least one of them has expired.
+                    if (mNextExpiry > now)
+                    {
+                        return;
+                    }
+
+                    mNextExpiry = Clock::time_point::max();
+                    for (auto _itr = mRecords.begin(); _itr != mRecords.end();)
+                    {
+                        if (_itr->second.Expiry <= now)
+                        {
+                            _itr = mRecords.erase(_itr);
+                        }
+                        else
+                        {
+                            mNextExpiry = std::min(mNextExpiry, _itr->second.Expiry);
+                            ++_itr;
+                        }
+                    }
+                }
+
+                void SomeIpSdServiceRegistry::Update(const SomeIpSdMessage &message)
+                {
+                    const Clock::time_point cNow{Clock::now()};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    purge(cNow);
+
+                    for (const auto &_entry : message.EntryRecords())
+                    {
+                        if (_entry.Type == entry::EntryType::Offering)
+                        {
+                            update(message, _entry, cNow);
+                        }
+                    }
+                }
+
+                void SomeIpSdServiceRegistry::onPayloadReceived(const uint8_t *data, std::size_t size)
+                {
+                    const SomeIpSdMessageView cView(data, size);
+                    if (!cView.IsValid())
+                    {
+                        return;
+                    }
+
+                    // Only the offering entries are decoded, so the rest of the message is skipped.
+                    const SomeIpSdMessageView::EntryFilter cFilter{
+                        std::initializer_list<entry::EntryType>{entry::EntryType::Offering}};
+                    const Clock::time_point cNow{Clock::now()};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    purge(cNow);
+
+                    for (const auto &_entry : cView.Entries(cFilter))
+                    {
+                        update(cView, _entry, cNow);
+                    }
+                }
+
+                bool SomeIpSdServiceRegistry::TryFind(
+                    uint16_t serviceId,
+                    ServiceInstance &instance,
+                    uint16_t instanceId,
+                    uint8_t majorVersion,
+                    uint32_t minorVersion) const
+                {
+                    const Clock::time_point cNow{Clock::now()};
+                    const Key cFirst{serviceId, 0, 0, 0};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    for (auto _itr = mRecords.lower_bound(cFirst);
+                         _itr != mRecords.end() && std::get<0>(_itr->first) == serviceId;
+                         ++_itr)
+                    {
+                        if (matchInstance(_itr->second.Instance, instanceId, majorVersion, minorVersion) &&
+                            tryGetInstance(_itr->second, cNow, instance))
+                        {
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                std::vector<ServiceInstance> SomeIpSdServiceRegistry::FindService(
+                    uint16_t serviceId, uint16_t instanceId) const
+                {
+                    std::vector<ServiceInstance> _result;
+                    const Clock::time_point cNow{Clock::now()};
+                    const Key cFirst{serviceId, 0, 0, 0};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    for (auto _itr = mRecords.lower_bound(cFirst);
+                         _itr != mRecords.end() && std::get<0>(_itr->first) == serviceId;
+                         ++_itr)
+                    {
+                        ServiceInstance _instance;
+                        if (matchInstance(
+                                _itr->second.Instance,
+                                instanceId,
+                                entry::Entry::cAnyMajorVersion,
+                                entry::ServiceEntry::cAnyMinorVersion) &&
+                            tryGetInstance(_itr->second, cNow, _instance))
+                        {
+                            _result.push_back(_instance);
+                        }
+                    }
+
+                    return _result;
+                }
+
+                std::size_t SomeIpSdServiceRegistry::Purge()
+                {
+                    const Clock::time_point cNow{Clock::now()};
+                    std::lock_guard<std::mutex> _lock(mMutex);
+
+                    purge(cNow);
+
+                    return mRecords.size();
+                }
+
+                SomeIpSdServiceRegistry::~SomeIpSdServiceRegistry()
+                {
+                    if (mNetworkLayer)
+                    {
+                        mNetworkLayer->ResetReceiver(this);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef SOMEIP_SD_SERVICE_REGISTRY_H
+#define SOMEIP_SD_SERVICE_REGISTRY_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include "../../helper/network_layer.h"
+#include "../../entry/service_entry.h"
+#include "./someip_sd_message.h"
+#include "./someip_sd_message_view.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief Offered service instance snapshot
+                struct ServiceInstance
+                {
+                    /// @brief Service ID
+                    uint16_t ServiceId;
+                    /// @brief Service instance ID
+                    uint16_t InstanceId;
+                    /// @brief Service major version
+                    uint8_t MajorVersion;
+                    /// @brief Service minor version
+                    uint32_t MinorVersion;
+                    /// @brief Remaining TTL in seconds which is never zero for a live instance
+                    uint32_t TTL;
+                    /// @brief Indicates whether the offer carried an IPv4 endpoint option or not
+                    bool HasEndpoint;
+                    /// @brief First IPv4 endpoint option of the offer, valid only if the endpoint exists
+                    option::OptionRecord Endpoint;
+                };
+
+                /// @brief Cache of the offered service instances
+                /// @details The registry listens to the raw SD payloads of a network layer and only decodes their
+                /// offering entries to keep the offered service instances indexed by their service ID, instance ID,
+                /// major version and minor version.
+                /// An instance expires when its offer TTL elapses or it receives a stop offer.
+                /// The expired instances are evicted while feeding the registry once the earliest expiry has passed.
+                /// The shared registry of a network layer serves all the clients over that layer, so a new client
+                /// of an already offered service becomes ready without going through the find phases.
+                class SomeIpSdServiceRegistry
+                {
+                private:
+                    using Clock = std::chrono::steady_clock;
+                    using Key = std::tuple<uint16_t, uint16_t, uint8_t, uint32_t>;
+
+                    struct Record
+                    {
+                        ServiceInstance Instance;
+                        Clock::time_point Expiry;
+                    };
+
+                    helper::NetworkLayer<SomeIpSdMessage> *const mNetworkLayer;
+                    std::map<Key, Record> mRecords;
+                    Clock::time_point mNextExpiry;
+                    mutable std::mutex mMutex;
+
+                    static bool matchInstance(
+                        const ServiceInstance &instance,
+                        uint16_t instanceId,
+                        uint8_t majorVersion,
+                        uint32_t minorVersion) noexcept;
+                    static bool tryGetInstance(
+                        const Record &record,
+                        Clock::time_point now,
+                        ServiceInstance &instance) noexcept;
+                    static void setEndpoint(
+                        const SomeIpSdMessage &message,
+                        const entry::EntryRecord &entry,
+                        ServiceInstance &instance);
+                    static void setEndpoint(
+                        const SomeIpSdMessageView &view,
+                        const entry::EntryRecord &entry,
+                        ServiceInstance &instance) noexcept;
+                    template <typename T>
+                    void update(
+                        const T &message,
+                        const entry::EntryRecord &entry,
+                        Clock::time_point now);
+                    void purge(Clock::time_point now);
+                    void onPayloadReceived(const uint8_t *data, std::size_t size);
+
+                public:
+                    /// @brief Offer TTL which never expires
+                    static const uint32_t cInfiniteTtl = 0xffffff;
+
+                    SomeIpSdServiceRegistry(const SomeIpSdServiceRegistry &) = delete;
+                    SomeIpSdServiceRegistry &operator=(const SomeIpSdServiceRegistry &) = delete;
+
+                    /// @brief Constructor of a registry which is only fed explicitly
+                    SomeIpSdServiceRegistry() noexcept;
+
+                    /// @brief Constructor
+                    /// @param networkLayer Network communication abstraction layer whose received offers feed the registry
+                    explicit SomeIpSdServiceRegistry(helper::NetworkLayer<SomeIpSdMessage> *networkLayer);
+
+                    ~SomeIpSdServiceRegistry();
+
+                    /// @brief Get the registry shared by all the users of a network layer
+                    /// @param networkLayer Network communication abstraction layer whose received offers feed the registry
+                    /// @returns Registry which lives as long as at least one of its users holds it
+                    /// @note A new registry is created if no user holds the network layer registry anymore.
+                    static std::shared_ptr<SomeIpSdServiceRegistry> Shared(
+                        helper::NetworkLayer<SomeIpSdMessage> *networkLayer);
+
+                    /// @brief Feed all the offering entries of a SD message
+                    /// @param message Received SD message
+                    /// @note A stop offer entry removes the matching service instance,
+                    /// and the expired service instances are evicted beforehand.
+                    void Update(const SomeIpSdMessage &message);
+
+                    /// @brief Try to find a live offered service instance
+                    /// @param serviceId Service ID
+                    /// @param[out] instance Found service instance snapshot
+                    /// @param instanceId Service instance ID, or any instance ID to match all the instances
+                    /// @param majorVersion Service major version, or any major version to match all the versions
+                    /// @param minorVersion Service minor version, or any minor version to match all the versions
+                    /// @returns True if a matching live service instance is found; otherwise false
+                    bool TryFind(
+                        uint16_t serviceId,
+                        ServiceInstance &instance,
+                        uint16_t instanceId = entry::Entry::cAnyInstanceId,
+                        uint8_t majorVersion = entry::Entry::cAnyMajorVersion,
+                        uint32_t minorVersion = entry::ServiceEntry::cAnyMinorVersion) const;
+
+                    /// @brief Find all the live offered instances of a service
+                    /// @param serviceId Service ID
+                    /// @param instanceId Service instance ID, or any instance ID to match all the instances
+                    /// @returns Snapshots of the matching service instances sorted by their instance ID and versions
+                    std::vector<ServiceInstance> FindService(
+                        uint16_t serviceId,
+                        uint16_t instanceId = entry::Entry::cAnyInstanceId) const;
+
+                    /// @brief Remove the expired service instances
+                    /// @returns Number of the remaining live service instances
+                    std::size_t Purge();
+                };
+            }
+        }
+    }
+}
+
+#endif
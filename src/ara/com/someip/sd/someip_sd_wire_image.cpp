@@ -0,0 +1,44 @@
+#include "./someip_sd_wire_image.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                SomeIpSdWireImage::SomeIpSdWireImage(const SomeIpSdMessage &message)
+                {
+                    Reset(message);
+                }
+
+                void SomeIpSdWireImage::Reset(const SomeIpSdMessage &message)
+                {
+                    mPayload.clear();
+                    message.Serialize(mPayload);
+                }
+
+                void SomeIpSdWireImage::Refresh(const SomeIpSdMessage &message) noexcept
+                {
+                    std::size_t _offset = cSessionIdOffset;
+                    helper::Inject(mPayload.data(), _offset, message.SessionId());
+
+                    if (message.Rebooted())
+                    {
+                        mPayload[cFlagsOffset] = cRebootedFlags;
+                    }
+                    else
+                    {
+                        mPayload[cFlagsOffset] = cNotRebootedFlags;
+                    }
+                }
+
+                const std::vector<uint8_t> &SomeIpSdWireImage::Payload() const noexcept
+                {
+                    return mPayload;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef SOMEIP_SD_WIRE_IMAGE_H
+#define SOMEIP_SD_WIRE_IMAGE_H
+
+#include "./someip_sd_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief Pre-serialized SOME/IP service discovery message
+                /// @details The message is encoded once, afterwards only the session ID and the SD flags
+                /// which change between the cyclic transmissions are patched in place.
+                class SomeIpSdWireImage
+                {
+                private:
+                    static const std::size_t cSessionIdOffset = 10;
+                    static const std::size_t cFlagsOffset = 16;
+                    static const uint8_t cRebootedFlags = 0xc0;
+                    static const uint8_t cNotRebootedFlags = 0x40;
+
+                    std::vector<uint8_t> mPayload;
+
+                public:
+                    SomeIpSdWireImage() noexcept = default;
+
+                    /// @brief Constructor
+                    /// @param message Message to be pre-serialized
+                    explicit SomeIpSdWireImage(const SomeIpSdMessage &message);
+
+                    /// @brief Re-encode the whole message
+                    /// @param message Message to be pre-serialized
+                    /// @note The current buffer capacity is reused if it fits the new message.
+                    void Reset(const SomeIpSdMessage &message);
+
+                    /// @brief Patch the session ID and the SD flags based on a message
+                    /// @param message Message whose session ID and reboot flag should be reflected
+                    /// @warning The image must have been encoded from a message with the same entries and options.
+                    void Refresh(const SomeIpSdMessage &message) noexcept;
+
+                    /// @brief Get the pre-serialized message payload
+                    /// @returns Byte array
+                    const std::vector<uint8_t> &Payload() const noexcept;
+                };
+            }
+        }
+    }
+}
+
+#endif
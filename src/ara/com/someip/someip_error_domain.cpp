@@ -0,0 +1,64 @@
+#include "./someip_error_domain.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            const ara::core::ErrorDomain::IdType SomeIpErrorDomain::cDomainId;
+
+            SomeIpErrorDomain::SomeIpErrorDomain() noexcept : ara::core::ErrorDomain{cDomainId}
+            {
+            }
+
+            const char *SomeIpErrorDomain::Name() const noexcept
+            {
+                return "SOME/IP error domain";
+            }
+
+            const char *SomeIpErrorDomain::Message(
+                ara::core::ErrorDomain::CodeType errorCode) const noexcept
+            {
+                auto _someIpErrc{static_cast<SomeIpErrc>(errorCode)};
+
+                switch (_someIpErrc)
+                {
+                case SomeIpErrc::kTruncatedHeader:
+                    return "Payload is shorter than the message header";
+                case SomeIpErrc::kLengthMismatch:
+                    return "Length field does not match the payload size";
+                case SomeIpErrc::kUnknownMessageId:
+                    return "Message ID does not belong to the expected message";
+                case SomeIpErrc::kInvalidFlags:
+                    return "Unsupported SD flags";
+                case SomeIpErrc::kTruncatedEntries:
+                    return "Entries array exceeds the message";
+                case SomeIpErrc::kUnsupportedEntry:
+                    return "Unsupported entry type";
+                case SomeIpErrc::kTruncatedOptions:
+                    return "Options array exceeds the message or misses a referenced option";
+                case SomeIpErrc::kInvalidOption:
+                    return "Unsupported, malformed, or misplaced option";
+
+                default:
+                    return "Unsupported error code";
+                }
+            }
+
+            const SomeIpErrorDomain &SomeIpErrorDomain::Instance() noexcept
+            {
+                static const SomeIpErrorDomain cInstance;
+                return cInstance;
+            }
+
+            ara::core::ErrorCode SomeIpErrorDomain::MakeErrorCode(SomeIpErrc code) noexcept
+            {
+                auto _codeType{static_cast<ara::core::ErrorDomain::CodeType>(code)};
+                ara::core::ErrorCode _result(_codeType, Instance());
+
+                return _result;
+            }
+        }
+    }
+}
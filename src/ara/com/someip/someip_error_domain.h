@@ -0,0 +1,57 @@
+#ifndef SOMEIP_ERROR_DOMAIN_H
+#define SOMEIP_ERROR_DOMAIN_H
+
+#include "../../core/error_domain.h"
+#include "../../core/error_code.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /// @brief SOME/IP malformed message reasons
+            /// @note All the reasons are reported as SomeIpReturnCode::eMalformedMessage on the wire.
+            enum class SomeIpErrc : ara::core::ErrorDomain::CodeType
+            {
+                kTruncatedHeader = 1,   ///< Payload is shorter than the message header
+                kLengthMismatch = 2,    ///< Length field does not match the payload size
+                kUnknownMessageId = 3,  ///< Message ID does not belong to the expected message
+                kInvalidFlags = 4,      ///< Unsupported SD flags
+                kTruncatedEntries = 5,  ///< Entries array exceeds the message
+                kUnsupportedEntry = 6,  ///< Unsupported entry type
+                kTruncatedOptions = 7,  ///< Options array exceeds the message or misses a referenced option
+                kInvalidOption = 8      ///< Unsupported, malformed, or misplaced option
+            };
+
+            /// @brief SOME/IP error domain
+            class SomeIpErrorDomain final : public ara::core::ErrorDomain
+            {
+            private:
+                static const ara::core::ErrorDomain::IdType cDomainId{0x8000000000000301};
+
+                SomeIpErrorDomain() noexcept;
+
+            public:
+                SomeIpErrorDomain(const SomeIpErrorDomain &) = delete;
+                SomeIpErrorDomain &operator=(const SomeIpErrorDomain &) = delete;
+
+                const char *Name() const noexcept override;
+
+                const char *Message(
+                    ara::core::ErrorDomain::CodeType errorCode) const noexcept override;
+
+                /// @brief Get the global SOME/IP error domain
+                /// @returns Singleton SOME/IP error domain
+                static const SomeIpErrorDomain &Instance() noexcept;
+
+                /// @brief Make an error code based on the given SOME/IP error type
+                /// @param code SOME/IP error code input
+                /// @returns Created error code in the SOME/IP error domain
+                static ara::core::ErrorCode MakeErrorCode(SomeIpErrc code) noexcept;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include <cstring>
+#include "./someip_event_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            const uint16_t SomeIpEventMessage::cClientId;
+            const uint8_t SomeIpEventMessage::cProtocolVersion;
+            const uint16_t SomeIpEventMessage::cEventIdFlag;
+
+            SomeIpEventMessage::SomeIpEventMessage(
+                uint16_t serviceId,
+                uint16_t eventId,
+                uint8_t interfaceVersion) : SomeIpMessage(
+                                                (static_cast<uint32_t>(serviceId) << 16) | eventId,
+                                                cClientId,
+                                                cProtocolVersion,
+                                                interfaceVersion,
+                                                SomeIpMessageType::Notification)
+            {
+                if ((eventId & cEventIdFlag) == 0)
+                {
+                    throw std::invalid_argument("Event ID most significant bit should be set.");
+                }
+            }
+
+            SomeIpEventMessage::SomeIpEventMessage(
+                SomeIpEventMessage &&other) noexcept : SomeIpMessage{std::move(other)},
+                                                       mData{std::move(other.mData)}
+            {
+            }
+
+            SomeIpEventMessage &SomeIpEventMessage::operator=(SomeIpEventMessage &&other)
+            {
+                SomeIpMessage::operator=(std::move(other));
+                mData = std::move(other.mData);
+
+                return *this;
+            }
+
+            uint16_t SomeIpEventMessage::ServiceId() const noexcept
+            {
+                return static_cast<uint16_t>(MessageId() >> 16);
+            }
+
+            uint16_t SomeIpEventMessage::EventId() const noexcept
+            {
+                return static_cast<uint16_t>(MessageId());
+            }
+
+            const std::vector<uint8_t> &SomeIpEventMessage::Data() const noexcept
+            {
+                return mData;
+            }
+
+            void SomeIpEventMessage::SetData(const uint8_t *data, std::size_t size)
+            {
+                // Assigning reuses the sample buffer capacity.
+                mData.assign(data, data + size);
+            }
+
+            void SomeIpEventMessage::SetData(const std::vector<uint8_t> &data)
+            {
+                SetData(data.data(), data.size());
+            }
+
+            uint32_t SomeIpEventMessage::Length() const noexcept
+            {
+                const uint32_t cHeaderLength = cHeaderSize - cLengthCoverageOffset;
+                uint32_t _result = cHeaderLength + static_cast<uint32_t>(mData.size());
+
+                return _result;
+            }
+
+            std::size_t SomeIpEventMessage::SerializeTo(uint8_t *dst, std::size_t cap) const
+            {
+                std::size_t _result = SomeIpMessage::SerializeTo(dst, cap);
+
+                if (!mData.empty())
+                {
+                    std::memcpy(dst + _result, mData.data(), mData.size());
+                    _result += mData.size();
+                }
+
+                return _result;
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef SOMEIP_EVENT_MESSAGE_H
+#define SOMEIP_EVENT_MESSAGE_H
+
+#include "./someip_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /// @brief SOME/IP event notification message
+            /// @details The message carries an already serialized event sample. The sample buffer is reused
+            /// across the updates, so publishing the same event periodically does not allocate.
+            class SomeIpEventMessage : public SomeIpMessage
+            {
+            private:
+                static const uint16_t cClientId = 0x0000;
+                static const uint8_t cProtocolVersion = 0x01;
+                static const uint16_t cEventIdFlag = 0x8000;
+
+                std::vector<uint8_t> mData;
+
+            public:
+                SomeIpEventMessage() = delete;
+
+                /// @brief Constructor
+                /// @param serviceId Service ID
+                /// @param eventId Event ID whose most significant bit is set
+                /// @param interfaceVersion Service interface major version
+                /// @throws std::invalid_argument Throws if the event ID most significant bit is not set
+                SomeIpEventMessage(
+                    uint16_t serviceId,
+                    uint16_t eventId,
+                    uint8_t interfaceVersion);
+
+                SomeIpEventMessage(SomeIpEventMessage &&other) noexcept;
+                SomeIpEventMessage &operator=(SomeIpEventMessage &&other);
+
+                /// @brief Get service ID
+                /// @returns Service ID of the message ID
+                uint16_t ServiceId() const noexcept;
+
+                /// @brief Get event ID
+                /// @returns Event ID of the message ID
+                uint16_t EventId() const noexcept;
+
+                /// @brief Get the event sample
+                /// @returns Serialized event sample byte array
+                const std::vector<uint8_t> &Data() const noexcept;
+
+                /// @brief Set the event sample
+                /// @param data Pointer to the first byte of the serialized sample
+                /// @param size Sample size in bytes
+                void SetData(const uint8_t *data, std::size_t size);
+
+                /// @brief Set the event sample
+                /// @param data Serialized sample byte array
+                void SetData(const std::vector<uint8_t> &data);
+
+                uint32_t Length() const noexcept override;
+
+                std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const override;
+            };
+        }
+    }
+}
+
+#endif
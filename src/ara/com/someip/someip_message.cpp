@@ -100,22 +100,38 @@ namespace ara
                 SomeIpMessage *message,
                 const std::vector<uint8_t> &payload)
             {
-                // Set the offset at the beginning of the payload
-                std::size_t _offset = 0;
+                helper::ByteReader _reader(payload);
+                if (!TryDeserialize(message, _reader))
+                {
+                    throw std::out_of_range(
+                        "The payload is shorter than the SOME/IP header.");
+                }
+            }
+
+            bool SomeIpMessage::TryDeserialize(
+                SomeIpMessage *message,
+                helper::ByteReader &reader) noexcept
+            {
+                if (!reader.Require(cHeaderSize))
+                {
+                    return false;
+                }
 
-                message->mMessageId = helper::ExtractInteger(payload, _offset);
+                message->mMessageId = reader.ReadInteger();
 
                 // Apply the message length field offset
-                _offset += 4;
+                reader.ReadInteger();
 
-                message->mClientId = helper::ExtractShort(payload, _offset);
-                message->mSessionId = helper::ExtractShort(payload, _offset);
-                message->mProtocolVersion = payload[_offset++];
-                message->mInterfaceVersion = payload[_offset++];
+                message->mClientId = reader.ReadShort();
+                message->mSessionId = reader.ReadShort();
+                message->mProtocolVersion = reader.ReadByte();
+                message->mInterfaceVersion = reader.ReadByte();
                 message->mMessageType =
-                    static_cast<SomeIpMessageType>(payload[_offset++]);
+                    static_cast<SomeIpMessageType>(reader.ReadByte());
                 message->mReturnCode =
-                    static_cast<SomeIpReturnCode>(payload[_offset]);
+                    static_cast<SomeIpReturnCode>(reader.ReadByte());
+
+                return true;
             }
 
             uint32_t SomeIpMessage::MessageId() const noexcept
@@ -175,22 +191,58 @@ namespace ara
                 return mReturnCode;
             }
 
-            std::vector<uint8_t> SomeIpMessage::Payload() const
+            std::size_t SomeIpMessage::SerializeHeaderTo(
+                uint8_t *dst, uint32_t length) const noexcept
             {
-                std::vector<uint8_t> _result;
-
-                helper::Inject(_result, MessageId());
-                helper::Inject(_result, Length());
-                helper::Inject(_result, ClientId());
-                helper::Inject(_result, SessionId());
-                _result.push_back(ProtocolVersion());
-                _result.push_back(InterfaceVersion());
+                std::size_t _offset = 0;
+                helper::Inject(dst, _offset, MessageId());
+                helper::Inject(dst, _offset, length);
+                helper::Inject(dst, _offset, ClientId());
+                helper::Inject(dst, _offset, SessionId());
+                dst[_offset++] = ProtocolVersion();
+                dst[_offset++] = InterfaceVersion();
 
                 uint8_t _messageType = static_cast<uint8_t>(MessageType());
-                _result.push_back(_messageType);
+                dst[_offset++] = _messageType;
 
                 uint8_t _returnCode = static_cast<uint8_t>(ReturnCode());
-                _result.push_back(_returnCode);
+                dst[_offset++] = _returnCode;
+
+                return _offset;
+            }
+
+            std::size_t SomeIpMessage::Size() const noexcept
+            {
+                std::size_t _result = cLengthCoverageOffset + Length();
+                return _result;
+            }
+
+            std::size_t SomeIpMessage::SerializeTo(uint8_t *dst, std::size_t cap) const
+            {
+                const uint32_t cLength = Length();
+                if (cap < cLengthCoverageOffset + cLength)
+                {
+                    throw std::out_of_range(
+                        "The buffer capacity is not enough for the message.");
+                }
+
+                std::size_t _result = SerializeHeaderTo(dst, cLength);
+                return _result;
+            }
+
+            void SomeIpMessage::Serialize(std::vector<uint8_t> &payload) const
+            {
+                std::size_t _offset = payload.size();
+                std::size_t _size = Size();
+                payload.resize(_offset + _size);
+                SerializeTo(payload.data() + _offset, _size);
+            }
+
+            std::vector<uint8_t> SomeIpMessage::Payload() const
+            {
+                std::vector<uint8_t> _result;
+                // The message size is known in advance, so the fresh payload is allocated once.
+                Serialize(_result);
 
                 return _result;
             }
@@ -2,10 +2,12 @@
 #define SOMEIP_MESSAGE_H
 
 #include <stdint.h>
+#include <cstddef>
 #include <stdexcept>
 #include <vector>
 #include <limits>
 #include "../helper/payload_helper.h"
+#include "../helper/byte_reader.h"
 
 namespace ara
 {
@@ -52,6 +54,10 @@ namespace ara
             /// @brief SOME/IP Abstract Message
             class SomeIpMessage
             {
+            public:
+                /// @brief Offset from which the length field covers the message
+                static const uint32_t cLengthCoverageOffset = 8;
+
             private:
                 uint32_t mMessageId;
                 uint16_t mClientId;
@@ -103,10 +109,30 @@ namespace ara
                 /// @brief Deserialize a SOME/IP message payload
                 /// @param message SOME/IP message to be filled by deserializing the payload
                 /// @param payload Serialized SOME/IP message payload byte array
+                /// @throws std::out_of_range Throws when the payload is shorter than the header
                 static void Deserialize(
                     SomeIpMessage *message,
                     const std::vector<uint8_t> &payload);
 
+                /// @brief Try to deserialize the general SOME/IP header
+                /// @param message SOME/IP message to be filled by deserializing the header
+                /// @param reader Byte reader positioned at the message beginning
+                /// @returns True if the header is deserialized; false if it is truncated
+                /// @note The remaining length is validated once for the whole header.
+                static bool TryDeserialize(
+                    SomeIpMessage *message,
+                    helper::ByteReader &reader) noexcept;
+
+                /// @brief SOME/IP general header size in bytes
+                static const std::size_t cHeaderSize = 16;
+
+                /// @brief Serialize the general SOME/IP header into a byte buffer
+                /// @param dst Destination buffer
+                /// @param length Message length field value
+                /// @returns Offset right after the serialized header
+                /// @warning The buffer capacity is not checked.
+                std::size_t SerializeHeaderTo(uint8_t *dst, uint32_t length) const noexcept;
+
             public:
                 SomeIpMessage(SomeIpMessage&& other) noexcept;
                 virtual ~SomeIpMessage() noexcept = default;
@@ -154,8 +180,27 @@ namespace ara
                 /// @returns SOME/IP message return code
                 SomeIpReturnCode ReturnCode() const noexcept;
 
+                /// @brief Get the serialized message size
+                /// @returns Message size in bytes including the whole header
+                std::size_t Size() const noexcept;
+
+                /// @brief Serialize the message into a caller-provided byte buffer
+                /// @param dst Destination buffer
+                /// @param cap Destination buffer capacity in bytes
+                /// @returns Number of written bytes
+                /// @throws std::out_of_range Throws when the capacity does not fit the message
+                virtual std::size_t SerializeTo(uint8_t *dst, std::size_t cap) const;
+
+                /// @brief Serialize the message at the end of a byte array
+                /// @param[out] payload Byte array to append the message to
+                /// @note The payload is grown by the message size without an exact reservation, so serializing
+                /// repeatedly into the same byte array keeps its geometric growth, and no allocation happens if
+                /// the payload has already enough capacity.
+                virtual void Serialize(std::vector<uint8_t> &payload) const;
+
                 /// @brief Get message payload
                 /// @returns Byte array
+                /// @note The payload is allocated once with the exact message size.
                 virtual std::vector<uint8_t> Payload() const;
             };
         }
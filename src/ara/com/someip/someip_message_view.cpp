@@ -0,0 +1,99 @@
+#include "./someip_message_view.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            SomeIpMessageView::SomeIpMessageView(
+                const uint8_t *data, std::size_t size) noexcept : mData{data},
+                                                                   mSize{0},
+                                                                   mValid{false}
+            {
+                if ((data != nullptr) && (size >= cHeaderSize))
+                {
+                    uint32_t _length = ReadInteger(cLengthFieldOffset);
+                    // The length field covers the rest of the header after itself plus the payload.
+                    std::size_t _messageSize =
+                        static_cast<std::size_t>(_length) + cLengthFieldOffset + cLengthFieldSize;
+
+                    if ((_length >= cMinimumLength) && (_messageSize <= size))
+                    {
+                        mSize = _messageSize;
+                        mValid = true;
+                    }
+                }
+            }
+
+            SomeIpMessageView::SomeIpMessageView(
+                const std::vector<uint8_t> &payload) noexcept : SomeIpMessageView(
+                                                                    payload.data(),
+                                                                    payload.size())
+            {
+            }
+
+            bool SomeIpMessageView::IsValid() const noexcept
+            {
+                return mValid;
+            }
+
+            const uint8_t *SomeIpMessageView::Data() const noexcept
+            {
+                return mData;
+            }
+
+            std::size_t SomeIpMessageView::Size() const noexcept
+            {
+                return mSize;
+            }
+
+            uint32_t SomeIpMessageView::MessageId() const noexcept
+            {
+                const std::size_t cOffset = 0;
+                return ReadInteger(cOffset);
+            }
+
+            uint32_t SomeIpMessageView::Length() const noexcept
+            {
+                return ReadInteger(cLengthFieldOffset);
+            }
+
+            uint16_t SomeIpMessageView::ClientId() const noexcept
+            {
+                const std::size_t cOffset = 8;
+                return ReadShort(cOffset);
+            }
+
+            uint16_t SomeIpMessageView::SessionId() const noexcept
+            {
+                const std::size_t cOffset = 10;
+                return ReadShort(cOffset);
+            }
+
+            uint8_t SomeIpMessageView::ProtocolVersion() const noexcept
+            {
+                const std::size_t cOffset = 12;
+                return mData[cOffset];
+            }
+
+            uint8_t SomeIpMessageView::InterfaceVersion() const noexcept
+            {
+                const std::size_t cOffset = 13;
+                return mData[cOffset];
+            }
+
+            SomeIpMessageType SomeIpMessageView::MessageType() const noexcept
+            {
+                const std::size_t cOffset = 14;
+                return static_cast<SomeIpMessageType>(mData[cOffset]);
+            }
+
+            SomeIpReturnCode SomeIpMessageView::ReturnCode() const noexcept
+            {
+                const std::size_t cOffset = 15;
+                return static_cast<SomeIpReturnCode>(mData[cOffset]);
+            }
+        }
+    }
+}
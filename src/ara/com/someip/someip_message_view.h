@@ -0,0 +1,127 @@
+#ifndef SOMEIP_MESSAGE_VIEW_H
+#define SOMEIP_MESSAGE_VIEW_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+#include "./someip_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /// @brief Non-owning read-only view over a serialized SOME/IP message
+            /// @details The header is validated once against the length field at construction,
+            /// afterwards all the header fields are read in place from the borrowed byte range.
+            /// @note The viewed byte range must outlive the view.
+            class SomeIpMessageView
+            {
+            private:
+                static const std::size_t cLengthFieldOffset = 4;
+                static const std::size_t cLengthFieldSize = 4;
+                // Request ID + Versions + Message Type + Return Code
+                static const uint32_t cMinimumLength = 8;
+
+                const uint8_t *mData;
+                std::size_t mSize;
+                bool mValid;
+
+            protected:
+                /// @brief SOME/IP general header size in bytes
+                static const std::size_t cHeaderSize = 16;
+
+                /// @brief Read a short value from the viewed bytes
+                /// @param offset Read offset from the beginning of the message
+                /// @returns Big-endian decoded short value
+                /// @warning The offset is not bound checked.
+                uint16_t ReadShort(std::size_t offset) const noexcept
+                {
+                    uint16_t _result =
+                        static_cast<uint16_t>(mData[offset] << 8) |
+                        static_cast<uint16_t>(mData[offset + 1]);
+
+                    return _result;
+                }
+
+                /// @brief Read an integer value from the viewed bytes
+                /// @param offset Read offset from the beginning of the message
+                /// @returns Big-endian decoded integer value
+                /// @warning The offset is not bound checked.
+                uint32_t ReadInteger(std::size_t offset) const noexcept
+                {
+                    uint32_t _result =
+                        (static_cast<uint32_t>(mData[offset]) << 24) |
+                        (static_cast<uint32_t>(mData[offset + 1]) << 16) |
+                        (static_cast<uint32_t>(mData[offset + 2]) << 8) |
+                        static_cast<uint32_t>(mData[offset + 3]);
+
+                    return _result;
+                }
+
+            public:
+                SomeIpMessageView() = delete;
+
+                /// @brief Constructor
+                /// @param data Pointer to the first byte of the serialized message
+                /// @param size Number of available bytes starting from the data pointer
+                /// @note If the range contains more than one message, only the first message is viewed.
+                SomeIpMessageView(const uint8_t *data, std::size_t size) noexcept;
+
+                /// @brief Constructor
+                /// @param payload Serialized message payload
+                explicit SomeIpMessageView(const std::vector<uint8_t> &payload) noexcept;
+
+                virtual ~SomeIpMessageView() noexcept = default;
+
+                /// @brief Indicate whether the viewed header is well-formed or not
+                /// @returns True if the header fits in the range and matches the length field; otherwise false
+                /// @warning The other accessors must not be called on an invalid view.
+                virtual bool IsValid() const noexcept;
+
+                /// @brief Get the viewed message data
+                /// @returns Pointer to the first byte of the message
+                const uint8_t *Data() const noexcept;
+
+                /// @brief Get the viewed message size
+                /// @returns Message size in bytes including the header, or zero if the view is invalid
+                std::size_t Size() const noexcept;
+
+                /// @brief Get message ID
+                /// @returns Message ID consisting service and method/event ID
+                uint32_t MessageId() const noexcept;
+
+                /// @brief Get message length
+                /// @returns Message length field value
+                uint32_t Length() const noexcept;
+
+                /// @brief Get client ID
+                /// @returns Client ID including ID prefix
+                uint16_t ClientId() const noexcept;
+
+                /// @brief Get session ID
+                /// @returns Active/non-active session ID
+                uint16_t SessionId() const noexcept;
+
+                /// @brief Get protocol version
+                /// @returns SOME/IP protocol header version
+                uint8_t ProtocolVersion() const noexcept;
+
+                /// @brief Get interface version
+                /// @returns Service interface version
+                uint8_t InterfaceVersion() const noexcept;
+
+                /// @brief Get message type
+                /// @returns SOME/IP message type
+                SomeIpMessageType MessageType() const noexcept;
+
+                /// @brief Get return code
+                /// @returns SOME/IP message return code
+                SomeIpReturnCode ReturnCode() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
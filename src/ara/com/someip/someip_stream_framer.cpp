@@ -0,0 +1,115 @@
+#include <cstring>
+#include "./someip_stream_framer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace
+            {
+                const uint8_t cClientMagicCookie[] =
+                    {0xff, 0xff, 0x00, 0x00,  // Message ID
+                     0x00, 0x00, 0x00, 0x08,  // Length
+                     0xde, 0xad, 0xbe, 0xef,  // Request ID
+                     0x01, 0x01, 0x01, 0x00}; // Versions, message type, and return code
+
+                const uint8_t cServerMagicCookie[] =
+                    {0xff, 0xff, 0x80, 0x00,  // Message ID
+                     0x00, 0x00, 0x00, 0x08,  // Length
+                     0xde, 0xad, 0xbe, 0xef,  // Request ID
+                     0x01, 0x01, 0x02, 0x00}; // Versions, message type, and return code
+            }
+
+            const std::size_t SomeIpStreamFramer::cHeaderSize;
+            const std::size_t SomeIpStreamFramer::cLengthFieldOffset;
+            const std::size_t SomeIpStreamFramer::cLengthFieldSize;
+            const uint32_t SomeIpStreamFramer::cMinimumLength;
+            const std::size_t SomeIpStreamFramer::cMagicCookieSize;
+            const std::size_t SomeIpStreamFramer::cDefaultMaxMessageSize;
+
+            SomeIpStreamFramer::SomeIpStreamFramer(
+                bool resynchronize,
+                std::size_t maxMessageSize) : mResynchronize{resynchronize},
+                                              mMaxMessageSize{maxMessageSize},
+                                              mSynchronized{true},
+                                              mDiscardedBytes{0}
+            {
+            }
+
+            uint32_t SomeIpStreamFramer::readLength(const uint8_t *message) noexcept
+            {
+                uint32_t _result =
+                    (static_cast<uint32_t>(message[cLengthFieldOffset]) << 24) |
+                    (static_cast<uint32_t>(message[cLengthFieldOffset + 1]) << 16) |
+                    (static_cast<uint32_t>(message[cLengthFieldOffset + 2]) << 8) |
+                    static_cast<uint32_t>(message[cLengthFieldOffset + 3]);
+
+                return _result;
+            }
+
+            bool SomeIpStreamFramer::isMagicCookie(const uint8_t *data) noexcept
+            {
+                bool _result =
+                    (std::memcmp(data, cClientMagicCookie, cMagicCookieSize) == 0) ||
+                    (std::memcmp(data, cServerMagicCookie, cMagicCookieSize) == 0);
+
+                return _result;
+            }
+
+            std::size_t SomeIpStreamFramer::skipToMagicCookie(
+                const uint8_t *data, std::size_t size) noexcept
+            {
+                if (!mResynchronize)
+                {
+                    // There is no way to find the next message boundary.
+                    mDiscardedBytes += size;
+                    return size;
+                }
+
+                std::size_t _offset = 0;
+                while (size - _offset >= cMagicCookieSize)
+                {
+                    if (isMagicCookie(data + _offset))
+                    {
+                        mSynchronized = true;
+                        mDiscardedBytes += _offset;
+                        return _offset;
+                    }
+
+                    ++_offset;
+                }
+
+                // Keep the tail which may be the beginning of a cookie.
+                mDiscardedBytes += _offset;
+                return _offset;
+            }
+
+            bool SomeIpStreamFramer::IsSynchronized() const noexcept
+            {
+                return mSynchronized;
+            }
+
+            std::size_t SomeIpStreamFramer::DiscardedBytes() const noexcept
+            {
+                return mDiscardedBytes;
+            }
+
+            std::vector<uint8_t> SomeIpStreamFramer::CreateMagicCookie(MagicCookieType type)
+            {
+                switch (type)
+                {
+                case MagicCookieType::Client:
+                    return std::vector<uint8_t>(
+                        cClientMagicCookie, cClientMagicCookie + cMagicCookieSize);
+                case MagicCookieType::Server:
+                    return std::vector<uint8_t>(
+                        cServerMagicCookie, cServerMagicCookie + cMagicCookieSize);
+                default:
+                    return std::vector<uint8_t>();
+                }
+            }
+        }
+    }
+}
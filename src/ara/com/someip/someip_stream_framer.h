@@ -0,0 +1,153 @@
+#ifndef SOMEIP_STREAM_FRAMER_H
+#define SOMEIP_STREAM_FRAMER_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /// @brief SOME/IP magic cookie type
+            enum class MagicCookieType : uint8_t
+            {
+                None,   ///< No magic cookie
+                Client, ///< Client to server magic cookie
+                Server  ///< Server to client magic cookie
+            };
+
+            /// @brief SOME/IP message framer over a byte stream (e.g., TCP)
+            /// @details The message boundaries are found via the SOME/IP length field. The complete messages
+            /// are handed out in place from the fed bytes, and only an incomplete tail is buffered.
+            /// If the resynchronization is enabled, a malformed length makes the framer skip
+            /// the stream up to the next magic cookie; otherwise, the rest of the stream is discarded.
+            /// The magic cookies themselves are never handed out.
+            class SomeIpStreamFramer
+            {
+            private:
+                static const std::size_t cHeaderSize = 16;
+                static const std::size_t cLengthFieldOffset = 4;
+                static const std::size_t cLengthFieldSize = 4;
+                // Request ID + Versions + Message Type + Return Code
+                static const uint32_t cMinimumLength = 8;
+
+                const bool mResynchronize;
+                const std::size_t mMaxMessageSize;
+                std::vector<uint8_t> mBuffer;
+                bool mSynchronized;
+                std::size_t mDiscardedBytes;
+
+                static uint32_t readLength(const uint8_t *message) noexcept;
+                static bool isMagicCookie(const uint8_t *data) noexcept;
+                std::size_t skipToMagicCookie(const uint8_t *data, std::size_t size) noexcept;
+
+                template <typename F>
+                std::size_t frame(const uint8_t *data, std::size_t size, F &callback)
+                {
+                    std::size_t _offset = 0;
+
+                    while (_offset < size)
+                    {
+                        if (!mSynchronized)
+                        {
+                            _offset += skipToMagicCookie(data + _offset, size - _offset);
+                            if (!mSynchronized)
+                            {
+                                break;
+                            }
+                        }
+
+                        if (size - _offset < cHeaderSize)
+                        {
+                            break;
+                        }
+
+                        uint32_t _length = readLength(data + _offset);
+                        std::size_t _messageSize =
+                            static_cast<std::size_t>(_length) + cLengthFieldOffset + cLengthFieldSize;
+
+                        if (_length < cMinimumLength || _messageSize > mMaxMessageSize)
+                        {
+                            // The current position is not a message boundary.
+                            mSynchronized = false;
+                            ++mDiscardedBytes;
+                            ++_offset;
+                            continue;
+                        }
+
+                        if (size - _offset < _messageSize)
+                        {
+                            break;
+                        }
+
+                        if (!isMagicCookie(data + _offset))
+                        {
+                            callback(data + _offset, _messageSize);
+                        }
+
+                        _offset += _messageSize;
+                    }
+
+                    return _offset;
+                }
+
+            public:
+                /// @brief Magic cookie message size in bytes
+                static const std::size_t cMagicCookieSize = 16;
+
+                /// @brief Default maximum acceptable message size in bytes
+                static const std::size_t cDefaultMaxMessageSize = 1048576;
+
+                SomeIpStreamFramer() = delete;
+
+                /// @brief Constructor
+                /// @param resynchronize Indicates whether to resynchronize on the magic cookies after a malformed length
+                /// @param maxMessageSize Maximum acceptable message size, beyond which the length is deemed malformed
+                explicit SomeIpStreamFramer(
+                    bool resynchronize,
+                    std::size_t maxMessageSize = cDefaultMaxMessageSize);
+
+                /// @brief Feed the next received stream bytes
+                /// @tparam F Callback type invocable with a message byte pointer and size
+                /// @param data Pointer to the first received byte
+                /// @param size Number of the received bytes
+                /// @param callback Callback to be invoked per complete message
+                /// @warning The message bytes are only valid within the callback invocation.
+                template <typename F>
+                void Feed(const uint8_t *data, std::size_t size, F &&callback)
+                {
+                    if (mBuffer.empty())
+                    {
+                        // Frame in place and only buffer the incomplete tail.
+                        std::size_t _consumed = frame(data, size, callback);
+                        mBuffer.assign(data + _consumed, data + size);
+                    }
+                    else
+                    {
+                        mBuffer.insert(mBuffer.end(), data, data + size);
+                        std::size_t _consumed = frame(mBuffer.data(), mBuffer.size(), callback);
+                        mBuffer.erase(mBuffer.begin(), mBuffer.begin() + _consumed);
+                    }
+                }
+
+                /// @brief Indicate whether the framer is on a message boundary or not
+                /// @returns False if the framer is skipping a malformed part of the stream; otherwise true
+                bool IsSynchronized() const noexcept;
+
+                /// @brief Get the number of the discarded stream bytes
+                /// @returns Number of the skipped bytes due to malformed lengths
+                std::size_t DiscardedBytes() const noexcept;
+
+                /// @brief Create a magic cookie message
+                /// @param type Magic cookie type
+                /// @returns Serialized magic cookie, or an empty vector for no magic cookie
+                static std::vector<uint8_t> CreateMagicCookie(MagicCookieType type);
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef SOMEIP_TCP_NETWORK_LAYER_H
+#define SOMEIP_TCP_NETWORK_LAYER_H
+
+#include <atomic>
+#include <cerrno>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "../helper/network_layer.h"
+#include "../helper/epoll_poller.h"
+#include "../helper/tcp_socket.h"
+#include "./someip_stream_framer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            /// @brief SOME/IP over TCP network communication layer
+            /// @tparam T Message type
+            /// @details The received stream is framed via the SOME/IP length field. The sent payloads are only queued,
+            /// and the polling thread gathers all the payloads queued within the same poll tick into one write.
+            /// @note With a magic cookie type, a cookie leads each write and the receiver resynchronizes on the
+            /// peer cookies after a malformed length.
+            template <typename T>
+            class SomeIpTcpNetworkLayer : public helper::NetworkLayer<T>
+            {
+            private:
+                static const std::size_t cReceiveBufferSize = 65536;
+
+                helper::EpollPoller *const mPoller;
+                std::unique_ptr<helper::TcpSocket> mSocket;
+                SomeIpStreamFramer mFramer;
+                const std::vector<uint8_t> mMagicCookie;
+                std::vector<uint8_t> mReceiveBuffer;
+                std::mutex mSendMutex;
+                std::vector<std::vector<uint8_t>> mQueuedPayloads;
+                bool mSenderAdded;
+                std::vector<std::vector<uint8_t>> mWritingPayloads;
+                std::vector<iovec> mWritingVectors;
+                std::size_t mWrittenVectors;
+                std::atomic_bool mConnected;
+                std::atomic_size_t mFailedSends;
+                std::atomic_size_t mWrites;
+
+                void disconnect()
+                {
+                    mConnected = false;
+                    mPoller->TryRemoveReceiver(mSocket->FileDescriptor());
+
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+                    mFailedSends += mQueuedPayloads.size() + mWritingPayloads.size();
+                    mQueuedPayloads.clear();
+                    mWritingPayloads.clear();
+                    mWritingVectors.clear();
+                    mWrittenVectors = 0;
+                    if (mSenderAdded)
+                    {
+                        mPoller->TryRemoveSender(mSocket->FileDescriptor());
+                        mSenderAdded = false;
+                    }
+                }
+
+                void onReadable()
+                {
+                    ssize_t _receivedBytes;
+
+                    do
+                    {
+                        _receivedBytes = mSocket->Receive(mReceiveBuffer.data(), mReceiveBuffer.size());
+
+                        if (_receivedBytes > 0)
+                        {
+                            mFramer.Feed(
+                                mReceiveBuffer.data(),
+                                static_cast<std::size_t>(_receivedBytes),
+                                [this](const uint8_t *data, std::size_t size)
+                                {
+                                    this->FireReceiverCallbacks(data, size);
+                                });
+                        }
+                        else if (_receivedBytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                        {
+                            // The peer has closed the connection or the connection is broken.
+                            disconnect();
+                            return;
+                        }
+                        // A full buffer may mean more bytes are still pending.
+                    } while (_receivedBytes == static_cast<ssize_t>(mReceiveBuffer.size()));
+                }
+
+                void prepareWrite()
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mSendMutex);
+                        mWritingPayloads.swap(mQueuedPayloads);
+                    }
+
+                    mWritingVectors.clear();
+                    mWrittenVectors = 0;
+
+                    if (!mMagicCookie.empty())
+                    {
+                        iovec _vector;
+                        // The gathering write does not modify the written bytes.
+                        _vector.iov_base = const_cast<uint8_t *>(mMagicCookie.data());
+                        _vector.iov_len = mMagicCookie.size();
+                        mWritingVectors.push_back(_vector);
+                    }
+
+                    for (auto &_payload : mWritingPayloads)
+                    {
+                        iovec _vector;
+                        _vector.iov_base = _payload.data();
+                        _vector.iov_len = _payload.size();
+                        mWritingVectors.push_back(_vector);
+                    }
+                }
+
+                void onWritable()
+                {
+                    if (mWrittenVectors == mWritingVectors.size())
+                    {
+                        prepareWrite();
+                    }
+
+                    while (mWrittenVectors < mWritingVectors.size())
+                    {
+                        ssize_t _writtenBytes =
+                            mSocket->Send(
+                                mWritingVectors.data() + mWrittenVectors,
+                                static_cast<int>(mWritingVectors.size() - mWrittenVectors));
+
+                        if (_writtenBytes < 0)
+                        {
+                            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                            {
+                                disconnect();
+                            }
+
+                            // Otherwise, continue on the next writability.
+                            return;
+                        }
+
+                        ++mWrites;
+
+                        // Advance over the fully written buffers and trim a partially written one.
+                        auto _remainedBytes = static_cast<std::size_t>(_writtenBytes);
+                        while (_remainedBytes > 0)
+                        {
+                            iovec &_vector = mWritingVectors[mWrittenVectors];
+                            if (_remainedBytes >= _vector.iov_len)
+                            {
+                                _remainedBytes -= _vector.iov_len;
+                                ++mWrittenVectors;
+                            }
+                            else
+                            {
+                                _vector.iov_base = static_cast<uint8_t *>(_vector.iov_base) + _remainedBytes;
+                                _vector.iov_len -= _remainedBytes;
+                                _remainedBytes = 0;
+                            }
+                        }
+                    }
+
+                    mWritingPayloads.clear();
+                    mWritingVectors.clear();
+                    mWrittenVectors = 0;
+
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+                    // Keep the sender for the payloads queued in the meantime.
+                    if (mQueuedPayloads.empty())
+                    {
+                        mPoller->TryRemoveSender(mSocket->FileDescriptor());
+                        mSenderAdded = false;
+                    }
+                }
+
+            public:
+                SomeIpTcpNetworkLayer() = delete;
+                SomeIpTcpNetworkLayer(const SomeIpTcpNetworkLayer &) = delete;
+                SomeIpTcpNetworkLayer &operator=(const SomeIpTcpNetworkLayer &) = delete;
+
+                /// @brief Constructor
+                /// @param poller Poller whose polling thread serves the layer receptions and transmissions
+                /// @param socket Connected TCP socket
+                /// @param noDelay Indicates whether to disable the Nagle's algorithm on the connection or not
+                /// @param magicCookieType Type of the magic cookies to send, or none to disable the cookies
+                /// @throws std::runtime_error Throws if the socket cannot be configured or added to the poller
+                SomeIpTcpNetworkLayer(
+                    helper::EpollPoller *poller,
+                    std::unique_ptr<helper::TcpSocket> socket,
+                    bool noDelay = true,
+                    MagicCookieType magicCookieType = MagicCookieType::None) : mPoller{poller},
+                                                                               mSocket{std::move(socket)},
+                                                                               mFramer(
+                                                                                   magicCookieType != MagicCookieType::None),
+                                                                               mMagicCookie(
+                                                                                   SomeIpStreamFramer::CreateMagicCookie(
+                                                                                       magicCookieType)),
+                                                                               mReceiveBuffer(cReceiveBufferSize),
+                                                                               mSenderAdded{false},
+                                                                               mWrittenVectors{0},
+                                                                               mConnected{true},
+                                                                               mFailedSends{0},
+                                                                               mWrites{0}
+                {
+                    mSocket->SetNoDelay(noDelay);
+
+                    bool _successful =
+                        mPoller->TryAddReceiver(
+                            mSocket->FileDescriptor(),
+                            [this]()
+                            { onReadable(); });
+
+                    if (!_successful)
+                    {
+                        throw std::runtime_error("Adding the socket to the poller failed.");
+                    }
+                }
+
+                ~SomeIpTcpNetworkLayer() noexcept override
+                {
+                    mPoller->TryRemoveSender(mSocket->FileDescriptor());
+                    mPoller->TryRemoveReceiver(mSocket->FileDescriptor());
+                }
+
+                void Send(const T &message) override
+                {
+                    SendPayload(message.Payload());
+                }
+
+                void SendPayload(const std::vector<uint8_t> &payload) override
+                {
+                    std::lock_guard<std::mutex> _lock(mSendMutex);
+
+                    if (!mConnected)
+                    {
+                        ++mFailedSends;
+                        return;
+                    }
+
+                    mQueuedPayloads.push_back(payload);
+
+                    // The first queued payload in a tick arms the sender for the whole tick.
+                    if (!mSenderAdded)
+                    {
+                        mSenderAdded =
+                            mPoller->TryAddSender(
+                                mSocket->FileDescriptor(),
+                                [this]()
+                                { onWritable(); });
+                    }
+                }
+
+                /// @brief Indicate whether the connection is still up or not
+                /// @returns False if the peer has closed the connection or the connection is broken; otherwise true
+                bool IsConnected() const noexcept
+                {
+                    return mConnected;
+                }
+
+                /// @brief Get the number of the payloads that could not be sent
+                /// @returns Number of the payloads which were queued on or sent to a lost connection
+                std::size_t FailedSends() const noexcept
+                {
+                    return mFailedSends;
+                }
+
+                /// @brief Get the number of the write system calls
+                /// @returns Number of the gathering writes done so far
+                std::size_t Writes() const noexcept
+                {
+                    return mWrites;
+                }
+
+                /// @brief Get the number of the discarded received bytes
+                /// @returns Number of the stream bytes that were skipped due to malformed lengths
+                std::size_t DiscardedBytes() const noexcept
+                {
+                    return mFramer.DiscardedBytes();
+                }
+            };
+
+            template <typename T>
+            const std::size_t SomeIpTcpNetworkLayer<T>::cReceiveBufferSize;
+        }
+    }
+}
+
+#endif
@@ -155,6 +155,45 @@ namespace ara
                 EXPECT_TRUE(_areEqual);
             }
 
+            TEST(EventgroupEntryTest, RecordMethod)
+            {
+                const uint16_t cServiceId = 0x0001;
+                const uint16_t cInstanceId = 0x0002;
+                const uint8_t cMajorVersion = 0x03;
+                const uint8_t cCounter = 0x04;
+                const uint16_t cEventgroupId = 0x0005;
+                const uint8_t cOptionIndex = 2;
+
+                auto _entry =
+                    EventgroupEntry::CreateSubscribeEventEntry(
+                        cServiceId, cInstanceId, cMajorVersion, cCounter, cEventgroupId);
+                auto _option =
+                    option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                        false,
+                        helper::Ipv4Address(127, 0, 0, 1),
+                        option::Layer4ProtocolType::Udp,
+                        8080);
+                _entry->AddFirstOption(std::move(_option));
+
+                uint8_t _optionIndex = cOptionIndex;
+                EntryRecord _record = _entry->Record(_optionIndex);
+
+                EXPECT_TRUE(_record.IsEventgroupEntry());
+                EXPECT_FALSE(_record.IsServiceEntry());
+                EXPECT_EQ(_entry->Type(), _record.Type);
+                EXPECT_EQ(cServiceId, _record.ServiceId);
+                EXPECT_EQ(cInstanceId, _record.InstanceId);
+                EXPECT_EQ(cMajorVersion, _record.MajorVersion);
+                EXPECT_EQ(_entry->TTL(), _record.TTL);
+                EXPECT_EQ(cCounter, _record.Eventgroup.Counter);
+                EXPECT_EQ(cEventgroupId, _record.Eventgroup.EventgroupId);
+                EXPECT_EQ(cOptionIndex, _record.FirstOptionIndex);
+                EXPECT_EQ(1, _record.FirstOptionCount);
+                EXPECT_EQ(cOptionIndex + 1, _record.SecondOptionIndex);
+                EXPECT_EQ(0, _record.SecondOptionCount);
+                EXPECT_EQ(cOptionIndex + 1, _optionIndex);
+            }
+
             TEST(EventgroupEntryTest, AddOption)
             {
                 const uint16_t cServiceId = 0x0001;
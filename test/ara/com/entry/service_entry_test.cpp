@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <thread>
 #include "../../../../src/ara/com/entry/entry_deserializer.h"
 #include "../../../../src/ara/com/option/loadbalancing_option.h"
 
@@ -105,6 +107,109 @@ namespace ara
                 EXPECT_TRUE(_areEqual);
             }
 
+            TEST(ServiceEntryTest, SerializeToMethod)
+            {
+                const uint16_t cServiceId = 0x1234;
+                const uint32_t cTTL = 0xabcdef;
+                const uint16_t cInstanceId = 0xfedc;
+                const uint8_t cMajorVersion = 0xba;
+                const uint32_t cMinorVersion = 0x87654321;
+
+                auto _entry =
+                    ServiceEntry::CreateFindServiceEntry(
+                        cServiceId, cTTL, cInstanceId, cMajorVersion, cMinorVersion);
+
+                uint8_t _optionIndex = 0;
+                auto _expectedPayload = _entry->Payload(_optionIndex);
+
+                std::array<uint8_t, Entry::cEntrySize> _actualPayload;
+                _optionIndex = 0;
+                std::size_t _size =
+                    _entry->SerializeTo(
+                        _actualPayload.data(), _actualPayload.size(), _optionIndex);
+
+                EXPECT_EQ(_expectedPayload.size(), _size);
+
+                bool _areEqual =
+                    std::equal(
+                        _expectedPayload.begin(),
+                        _expectedPayload.end(),
+                        _actualPayload.begin());
+
+                EXPECT_TRUE(_areEqual);
+
+                EXPECT_THROW(
+                    _entry->SerializeTo(
+                        _actualPayload.data(), Entry::cEntrySize - 1, _optionIndex),
+                    std::out_of_range);
+            }
+
+            TEST(ServiceEntryTest, PooledAllocation)
+            {
+                const int cThreadCount = 4;
+                const uint16_t cEntryCount = 256;
+                std::vector<std::thread> _threads;
+                std::atomic_size_t _corruptedEntries{0};
+
+                // Recycled pooled entries should be fully constructed, even if they are shared among threads.
+                for (int i = 0; i < cThreadCount; ++i)
+                {
+                    _threads.emplace_back(
+                        [&_corruptedEntries, i]()
+                        {
+                            std::vector<std::unique_ptr<ServiceEntry>> _entries;
+                            for (uint16_t j = 0; j < cEntryCount; ++j)
+                            {
+                                _entries.push_back(ServiceEntry::CreateFindServiceEntry(j, i + 1));
+                            }
+
+                            for (uint16_t j = 0; j < cEntryCount; ++j)
+                            {
+                                if (_entries[j]->ServiceId() != j ||
+                                    _entries[j]->TTL() != static_cast<uint32_t>(i + 1))
+                                {
+                                    ++_corruptedEntries;
+                                }
+                            }
+                        });
+                }
+
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                EXPECT_EQ(0, _corruptedEntries);
+            }
+
+            TEST(ServiceEntryTest, RecordMethod)
+            {
+                const uint16_t cServiceId = 0x1234;
+                const uint32_t cTTL = 0xabcdef;
+                const uint16_t cInstanceId = 0xfedc;
+                const uint8_t cMajorVersion = 0xba;
+                const uint32_t cMinorVersion = 0x87654321;
+
+                auto _entry =
+                    ServiceEntry::CreateFindServiceEntry(
+                        cServiceId, cTTL, cInstanceId, cMajorVersion, cMinorVersion);
+
+                uint8_t _optionIndex = 0;
+                EntryRecord _record = _entry->Record(_optionIndex);
+
+                EXPECT_TRUE(_record.IsServiceEntry());
+                EXPECT_FALSE(_record.IsEventgroupEntry());
+                EXPECT_EQ(EntryType::Finding, _record.Type);
+                EXPECT_EQ(cServiceId, _record.ServiceId);
+                EXPECT_EQ(cInstanceId, _record.InstanceId);
+                EXPECT_EQ(cMajorVersion, _record.MajorVersion);
+                EXPECT_EQ(cTTL, _record.TTL);
+                EXPECT_EQ(cMinorVersion, _record.MinorVersion);
+                EXPECT_EQ(0, _record.FirstOptionCount);
+                EXPECT_EQ(0, _record.SecondOptionCount);
+                EXPECT_EQ(0, _optionIndex);
+            }
+
             TEST(ServiceEntryTest, AddOption)
             {
                 const uint16_t cServiceId = 0x0001;
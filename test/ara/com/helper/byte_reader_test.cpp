@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/helper/byte_reader.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(ByteReaderTest, Constructor)
+            {
+                const std::vector<uint8_t> cPayload{0x01, 0x02, 0x03};
+                ByteReader _reader(cPayload);
+
+                EXPECT_EQ(0, _reader.Offset());
+                EXPECT_EQ(cPayload.size(), _reader.Remaining());
+                EXPECT_EQ(cPayload.data(), _reader.Current());
+            }
+
+            TEST(ByteReaderTest, UncheckedReads)
+            {
+                const std::vector<uint8_t> cPayload{
+                    0x01,
+                    0x02, 0x03,
+                    0x04, 0x05, 0x06, 0x07};
+                const uint8_t cExpectedByte = 0x01;
+                const uint16_t cExpectedShort = 0x0203;
+                const uint32_t cExpectedInteger = 0x04050607;
+
+                ByteReader _reader(cPayload);
+                ASSERT_TRUE(_reader.Require(cPayload.size()));
+
+                EXPECT_EQ(cExpectedByte, _reader.ReadByte());
+                EXPECT_EQ(cExpectedShort, _reader.ReadShort());
+                EXPECT_EQ(cExpectedInteger, _reader.ReadInteger());
+                EXPECT_EQ(0, _reader.Remaining());
+            }
+
+            TEST(ByteReaderTest, CheckedReads)
+            {
+                const std::vector<uint8_t> cPayload{0x01, 0x02, 0x03};
+                const uint16_t cExpectedShort = 0x0102;
+
+                ByteReader _reader(cPayload);
+
+                uint16_t _short;
+                EXPECT_TRUE(_reader.TryRead(_short));
+                EXPECT_EQ(cExpectedShort, _short);
+
+                // Only one byte is remained, so the cursor should not move.
+                uint32_t _integer;
+                EXPECT_FALSE(_reader.TryRead(_integer));
+                EXPECT_EQ(sizeof(_short), _reader.Offset());
+
+                uint8_t _byte;
+                EXPECT_TRUE(_reader.TryRead(_byte));
+                EXPECT_FALSE(_reader.TryRead(_byte));
+            }
+
+            TEST(ByteReaderTest, SkipMethod)
+            {
+                const std::vector<uint8_t> cPayload{0x01, 0x02, 0x03};
+                ByteReader _reader(cPayload);
+
+                EXPECT_FALSE(_reader.Require(cPayload.size() + 1));
+                EXPECT_FALSE(_reader.Skip(cPayload.size() + 1));
+                EXPECT_EQ(0, _reader.Offset());
+
+                EXPECT_TRUE(_reader.Skip(cPayload.size()));
+                EXPECT_EQ(0, _reader.Remaining());
+            }
+        }
+    }
+}
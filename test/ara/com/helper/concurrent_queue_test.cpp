@@ -28,6 +28,21 @@ namespace ara
 
                 EXPECT_EQ(_expectedResult, _actualResult);
             }
+
+            TEST(ConcurrentQueueTest, DequeuingEmptyQueue)
+            {
+                ConcurrentQueue<int> _queue;
+                _queue.TryEnqueue(1);
+                _queue.TryEnqueue(2);
+
+                int _element;
+                EXPECT_TRUE(_queue.TryDequeue(_element));
+                EXPECT_EQ(1, _element);
+                EXPECT_TRUE(_queue.TryDequeue(_element));
+                EXPECT_EQ(2, _element);
+                EXPECT_FALSE(_queue.TryDequeue(_element));
+                EXPECT_TRUE(_queue.Empty());
+            }
         }
     }
 }
\ No newline at end of file
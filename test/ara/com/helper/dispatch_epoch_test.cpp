@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../../../../src/ara/com/helper/dispatch_epoch.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(DispatchEpochTest, IdleSynchronization)
+            {
+                DispatchEpoch _epoch;
+
+                // Without any dispatch, the synchronizations should return immediately.
+                _epoch.Synchronize();
+                _epoch.Synchronize();
+
+                DispatchEpoch::Scope _scope(_epoch);
+                SUCCEED();
+            }
+
+            TEST(DispatchEpochTest, SynchronizationGracePeriod)
+            {
+                const std::chrono::milliseconds cDispatchDuration{20};
+
+                DispatchEpoch _epoch;
+                std::atomic_bool _entered{false};
+                std::atomic_bool _finished{false};
+
+                std::thread _dispatcher(
+                    [&]()
+                    {
+                        DispatchEpoch::Scope _scope(_epoch);
+                        _entered = true;
+                        std::this_thread::sleep_for(cDispatchDuration);
+                        _finished = true;
+                    });
+
+                while (!_entered)
+                {
+                    std::this_thread::yield();
+                }
+
+                // The dispatch that joined before the synchronization should be waited for.
+                _epoch.Synchronize();
+                EXPECT_TRUE(_finished);
+
+                _dispatcher.join();
+            }
+        }
+    }
+}
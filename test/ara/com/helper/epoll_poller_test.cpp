@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "../../../../src/ara/com/helper/epoll_poller.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(EpollPollerTest, ReceiverInvocation)
+            {
+                const int cTimeout = 100;
+                const uint8_t cByte = 0xff;
+
+                int _pipe[2];
+                ASSERT_EQ(0, pipe(_pipe));
+
+                EpollPoller _poller;
+                int _invocations = 0;
+                auto _callback =
+                    [&]()
+                {
+                    uint8_t _byte;
+                    EXPECT_EQ(1, read(_pipe[0], &_byte, sizeof(_byte)));
+                    ++_invocations;
+                };
+
+                EXPECT_TRUE(_poller.TryAddReceiver(_pipe[0], _callback));
+                EXPECT_FALSE(_poller.TryAddReceiver(_pipe[0], _callback));
+
+                // Nothing is readable yet
+                EXPECT_TRUE(_poller.TryPoll(0));
+                EXPECT_EQ(0, _invocations);
+
+                EXPECT_EQ(1, write(_pipe[1], &cByte, sizeof(cByte)));
+                EXPECT_TRUE(_poller.TryPoll(cTimeout));
+                EXPECT_EQ(1, _invocations);
+
+                EXPECT_TRUE(_poller.TryRemoveReceiver(_pipe[0]));
+                EXPECT_FALSE(_poller.TryRemoveReceiver(_pipe[0]));
+
+                EXPECT_EQ(1, write(_pipe[1], &cByte, sizeof(cByte)));
+                EXPECT_TRUE(_poller.TryPoll(0));
+                EXPECT_EQ(1, _invocations);
+
+                close(_pipe[0]);
+                close(_pipe[1]);
+            }
+
+            TEST(EpollPollerTest, SenderInvocation)
+            {
+                int _pipe[2];
+                ASSERT_EQ(0, pipe(_pipe));
+
+                EpollPoller _poller;
+                int _receptions = 0;
+                int _transmissions = 0;
+
+                EXPECT_TRUE(_poller.TryAddReceiver(_pipe[1], [&]()
+                                                   { ++_receptions; }));
+                EXPECT_TRUE(_poller.TryAddSender(_pipe[1], [&]()
+                                                 {
+                                                     ++_transmissions;
+                                                     // Remove the sender from within its own invocation
+                                                     EXPECT_TRUE(_poller.TryRemoveSender(_pipe[1]));
+                                                 }));
+
+                // The empty pipe is writable, but it is never readable from its write end.
+                EXPECT_TRUE(_poller.TryPoll(0));
+                EXPECT_TRUE(_poller.TryPoll(0));
+                EXPECT_EQ(0, _receptions);
+                EXPECT_EQ(1, _transmissions);
+
+                EXPECT_TRUE(_poller.TryRemoveReceiver(_pipe[1]));
+                EXPECT_FALSE(_poller.TryRemoveSender(_pipe[1]));
+
+                close(_pipe[0]);
+                close(_pipe[1]);
+            }
+        }
+    }
+}
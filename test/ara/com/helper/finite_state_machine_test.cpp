@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/helper/finite_state_machine.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            enum class SwitchState
+            {
+                Off,
+                On
+            };
+
+            template <>
+            struct StateTraits<SwitchState>
+            {
+                static const std::size_t cStateCount = 2;
+
+                static constexpr uint32_t GetTransitions(SwitchState state) noexcept
+                {
+                    return state == SwitchState::Off ? GetStateMask(SwitchState::On)
+                                                     : GetStateMask(SwitchState::Off);
+                }
+            };
+
+            class SwitchMachineState : public MachineState<SwitchState>
+            {
+            protected:
+                void Deactivate(SwitchState /*nextState*/) override
+                {
+                }
+
+            public:
+                int Activations;
+
+                explicit SwitchMachineState(SwitchState state) : MachineState<SwitchState>(state),
+                                                                 Activations{0}
+                {
+                }
+
+                void Activate(SwitchState /*previousState*/) override
+                {
+                    ++Activations;
+                }
+
+                void Toggle(SwitchState nextState)
+                {
+                    Transit(nextState);
+                }
+            };
+
+            TEST(FiniteStateMachineTest, Initialize)
+            {
+                SwitchMachineState _offState(SwitchState::Off);
+                SwitchMachineState _duplicatedState(SwitchState::Off);
+
+                FiniteStateMachine<SwitchState> _invalidMachine;
+                EXPECT_THROW(
+                    _invalidMachine.Initialize({&_offState, &_duplicatedState}, SwitchState::Off),
+                    std::invalid_argument);
+
+                FiniteStateMachine<SwitchState> _machine;
+                EXPECT_THROW(
+                    _machine.Initialize({&_offState}, SwitchState::On),
+                    std::invalid_argument);
+
+                // A rejected state list should not leave any state behind.
+                SwitchMachineState _onState(SwitchState::On);
+                EXPECT_NO_THROW(
+                    _machine.Initialize({&_offState, &_onState}, SwitchState::Off));
+            }
+
+            TEST(FiniteStateMachineTest, Transit)
+            {
+                SwitchMachineState _offState(SwitchState::Off);
+                SwitchMachineState _onState(SwitchState::On);
+
+                FiniteStateMachine<SwitchState> _machine;
+                _machine.Initialize({&_offState, &_onState}, SwitchState::Off);
+                EXPECT_EQ(SwitchState::Off, _machine.GetState());
+                EXPECT_EQ(&_offState, _machine.GetMachineState());
+                EXPECT_EQ(1, _offState.Activations);
+
+                _offState.Toggle(SwitchState::On);
+                EXPECT_EQ(SwitchState::On, _machine.GetState());
+                EXPECT_EQ(&_onState, _machine.GetMachineState());
+                EXPECT_EQ(1, _onState.Activations);
+
+                // A state which is not the current one cannot transit.
+                _offState.Toggle(SwitchState::On);
+                EXPECT_EQ(1, _onState.Activations);
+
+                // A transition out of the table is rejected.
+                EXPECT_THROW(_onState.Toggle(SwitchState::On), std::logic_error);
+                EXPECT_EQ(SwitchState::On, _machine.GetState());
+            }
+        }
+    }
+}
@@ -21,6 +21,11 @@ namespace ara
                     // In the mockup network layer, the message payload is direcly forwarded to the receiver callback.
                     this->FireReceiverCallbacks(message.Payload());
                 }
+
+                virtual void SendPayload(const std::vector<uint8_t> &payload) override
+                {
+                    this->FireReceiverCallbacks(payload);
+                }
             };
         }
     }
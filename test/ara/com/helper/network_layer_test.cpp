@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+#include "./mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(NetworkLayerTest, MalformedPayloadDrop)
+            {
+                const auto cExpectedReason{
+                    static_cast<core::ErrorDomain::CodeType>(someip::SomeIpErrc::kTruncatedHeader)};
+                const std::vector<uint8_t> cGarbagePayload{0xde, 0xad, 0xbe, 0xef};
+
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                int _receivedMessages{0};
+                _networkLayer.SetReceiver(
+                    this,
+                    [&_receivedMessages](std::shared_ptr<const someip::sd::SomeIpSdMessage>)
+                    { ++_receivedMessages; });
+
+                _networkLayer.SendPayload(cGarbagePayload);
+                _networkLayer.SendPayload(cGarbagePayload);
+
+                EXPECT_EQ(0, _receivedMessages);
+                EXPECT_EQ(2, _networkLayer.DroppedPayloads());
+                EXPECT_EQ(2, _networkLayer.DroppedPayloads(cExpectedReason));
+            }
+
+            TEST(NetworkLayerTest, WellFormedPayloadReception)
+            {
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                std::size_t _receivedEntries{0};
+                _networkLayer.SetReceiver(
+                    this,
+                    [&_receivedEntries](std::shared_ptr<const someip::sd::SomeIpSdMessage> message)
+                    { _receivedEntries += message->EntryRecords().size(); });
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                _networkLayer.Send(_message);
+
+                EXPECT_EQ(1, _receivedEntries);
+                EXPECT_EQ(0, _networkLayer.DroppedPayloads());
+            }
+
+            TEST(NetworkLayerTest, SharedMessageFanOut)
+            {
+                int _firstReceiver;
+                int _secondReceiver;
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                std::shared_ptr<const someip::sd::SomeIpSdMessage> _firstMessage;
+                std::shared_ptr<const someip::sd::SomeIpSdMessage> _secondMessage;
+
+                _networkLayer.SetReceiver(
+                    &_firstReceiver,
+                    [&_firstMessage](std::shared_ptr<const someip::sd::SomeIpSdMessage> message)
+                    { _firstMessage = message; });
+                _networkLayer.SetReceiver(
+                    &_secondReceiver,
+                    [&_secondMessage](std::shared_ptr<const someip::sd::SomeIpSdMessage> message)
+                    { _secondMessage = message; });
+
+                someip::sd::SomeIpSdMessage _message;
+                _networkLayer.Send(_message);
+
+                // Both receivers should share the same once-deserialized message.
+                ASSERT_NE(nullptr, _firstMessage);
+                EXPECT_EQ(_firstMessage, _secondMessage);
+            }
+
+            TEST(NetworkLayerTest, RawPayloadReception)
+            {
+                const std::vector<uint8_t> cGarbagePayload{0xde, 0xad, 0xbe, 0xef};
+
+                int _payloadReceiver;
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                std::size_t _receivedBytes{0};
+                _networkLayer.SetPayloadReceiver(
+                    &_payloadReceiver,
+                    [&_receivedBytes](const uint8_t *, std::size_t size)
+                    { _receivedBytes += size; });
+
+                // The raw payload is not decoded when there is no message receiver.
+                _networkLayer.SendPayload(cGarbagePayload);
+                EXPECT_EQ(cGarbagePayload.size(), _receivedBytes);
+                EXPECT_EQ(0, _networkLayer.DroppedPayloads());
+
+                _networkLayer.ResetReceiver(&_payloadReceiver);
+                _networkLayer.SendPayload(cGarbagePayload);
+                EXPECT_EQ(cGarbagePayload.size(), _receivedBytes);
+            }
+
+            TEST(NetworkLayerTest, ConcurrentReceiverRegistration)
+            {
+                const int cIterations = 1000;
+
+                int _registeredReceiver;
+                int _churningReceiver;
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                std::atomic_int _receivedMessages{0};
+
+                _networkLayer.SetReceiver(
+                    &_registeredReceiver,
+                    [&_receivedMessages](std::shared_ptr<const someip::sd::SomeIpSdMessage>)
+                    { ++_receivedMessages; });
+
+                std::thread _churner(
+                    [&]()
+                    {
+                        for (int i = 0; i < cIterations; ++i)
+                        {
+                            _networkLayer.SetReceiver(
+                                &_churningReceiver,
+                                [](std::shared_ptr<const someip::sd::SomeIpSdMessage>) {});
+                            _networkLayer.ResetReceiver(&_churningReceiver);
+                        }
+                    });
+
+                const auto cPayload = someip::sd::SomeIpSdMessage().Payload();
+                for (int i = 0; i < cIterations; ++i)
+                {
+                    _networkLayer.SendPayload(cPayload);
+                }
+
+                _churner.join();
+
+                EXPECT_EQ(cIterations, _receivedMessages);
+            }
+
+            TEST(NetworkLayerTest, ResetAfterOlderSnapshotDispatch)
+            {
+                const std::chrono::milliseconds cDispatchDuration{20};
+
+                int _slowReceiver;
+                int _laterReceiver;
+                MockupNetworkLayer<someip::sd::SomeIpSdMessage> _networkLayer;
+                std::atomic_bool _entered{false};
+                std::atomic_bool _finished{false};
+
+                _networkLayer.SetPayloadReceiver(
+                    &_slowReceiver,
+                    [&](const uint8_t *, std::size_t)
+                    {
+                        _entered = true;
+                        std::this_thread::sleep_for(cDispatchDuration);
+                        _finished = true;
+                    });
+
+                const auto cPayload = someip::sd::SomeIpSdMessage().Payload();
+                std::thread _receiver([&]()
+                                      { _networkLayer.SendPayload(cPayload); });
+
+                while (!_entered)
+                {
+                    std::this_thread::yield();
+                }
+
+                // The in-flight dispatch holds a snapshot older than the one being replaced by the reset.
+                _networkLayer.SetReceiver(
+                    &_laterReceiver,
+                    [](std::shared_ptr<const someip::sd::SomeIpSdMessage>) {});
+                _networkLayer.ResetReceiver(&_slowReceiver);
+                EXPECT_TRUE(_finished);
+
+                _receiver.join();
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <thread>
+#include "../../../../src/ara/com/helper/object_pool.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            struct PooledObject
+            {
+                uint64_t First;
+                uint64_t Second;
+            };
+
+            struct ThreadCachedObject
+            {
+                uint64_t First;
+                uint64_t Second;
+            };
+
+            TEST(ObjectPoolTest, Constructor)
+            {
+                ObjectPool<PooledObject> _pool;
+                EXPECT_EQ(0, _pool.FreeBlocks());
+            }
+
+            TEST(ObjectPoolTest, RecyclingScenario)
+            {
+                ObjectPool<PooledObject> _pool;
+
+                void *_firstBlock = _pool.Allocate(sizeof(PooledObject));
+                _pool.Deallocate(_firstBlock, sizeof(PooledObject));
+                EXPECT_EQ(1, _pool.FreeBlocks());
+
+                void *_secondBlock = _pool.Allocate(sizeof(PooledObject));
+                EXPECT_EQ(_firstBlock, _secondBlock);
+                EXPECT_EQ(0, _pool.FreeBlocks());
+
+                _pool.Deallocate(_secondBlock, sizeof(PooledObject));
+            }
+
+            TEST(ObjectPoolTest, CapacityBound)
+            {
+                const std::size_t cCapacity = 1;
+                ObjectPool<PooledObject> _pool(cCapacity);
+
+                void *_firstBlock = _pool.Allocate(sizeof(PooledObject));
+                void *_secondBlock = _pool.Allocate(sizeof(PooledObject));
+                _pool.Deallocate(_firstBlock, sizeof(PooledObject));
+                _pool.Deallocate(_secondBlock, sizeof(PooledObject));
+
+                EXPECT_EQ(cCapacity, _pool.FreeBlocks());
+            }
+
+            TEST(ObjectPoolTest, MismatchedSize)
+            {
+                const std::size_t cSize = 2 * sizeof(PooledObject);
+                ObjectPool<PooledObject> _pool;
+
+                void *_block = _pool.Allocate(cSize);
+                EXPECT_NE(nullptr, _block);
+
+                _pool.Deallocate(_block, cSize);
+                EXPECT_EQ(0, _pool.FreeBlocks());
+            }
+
+            TEST(ObjectPoolTest, ThreadCacheScenario)
+            {
+                const std::size_t cBlockCount = 8;
+                ObjectPool<ThreadCachedObject> &_pool = ObjectPool<ThreadCachedObject>::Instance();
+
+                std::thread _thread(
+                    [&_pool]()
+                    {
+                        std::array<void *, cBlockCount> _blocks;
+                        for (auto &_block : _blocks)
+                        {
+                            _block = _pool.Allocate(sizeof(ThreadCachedObject));
+                        }
+
+                        for (auto _block : _blocks)
+                        {
+                            _pool.Deallocate(_block, sizeof(ThreadCachedObject));
+                        }
+
+                        // The released blocks are kept in the thread cache.
+                        EXPECT_EQ(0, _pool.FreeBlocks());
+                    });
+                _thread.join();
+
+                // The thread cache should be handed back to the shared free-list at the thread exit.
+                EXPECT_EQ(cBlockCount, _pool.FreeBlocks());
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../../../../src/ara/com/helper/ring_buffer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(RingBufferTest, Constructor)
+            {
+                const std::size_t cInvalidCapacity = 0;
+                const std::size_t cCapacity = 5;
+                const std::size_t cExpectedCapacity = 8;
+
+                EXPECT_THROW(SpscRingBuffer<int>{cInvalidCapacity}, std::invalid_argument);
+
+                MpmcRingBuffer<int> _buffer(cCapacity);
+                EXPECT_EQ(cExpectedCapacity, _buffer.Capacity());
+                EXPECT_TRUE(_buffer.Empty());
+            }
+
+            TEST(RingBufferTest, QueuingScenario)
+            {
+                const std::size_t cCapacity = 4;
+
+                SpscRingBuffer<std::unique_ptr<int>> _buffer(cCapacity);
+
+                for (int i = 0; i < static_cast<int>(cCapacity); ++i)
+                {
+                    EXPECT_TRUE(_buffer.TryEnqueue(std::unique_ptr<int>(new int(i))));
+                }
+                EXPECT_EQ(cCapacity, _buffer.Size());
+
+                // A rejected element stays with the caller.
+                std::unique_ptr<int> _rejected(new int(-1));
+                EXPECT_FALSE(_buffer.TryEnqueue(std::move(_rejected)));
+                ASSERT_NE(nullptr, _rejected);
+
+                for (int i = 0; i < static_cast<int>(cCapacity); ++i)
+                {
+                    std::unique_ptr<int> _element;
+                    ASSERT_TRUE(_buffer.TryDequeue(_element));
+                    EXPECT_EQ(i, *_element);
+                }
+
+                std::unique_ptr<int> _element;
+                EXPECT_FALSE(_buffer.TryDequeue(_element));
+                EXPECT_TRUE(_buffer.Empty());
+            }
+
+            TEST(RingBufferTest, BlockingScenario)
+            {
+                const int cExpectedResult = 1;
+                const std::chrono::milliseconds cShortTimeout{10};
+                const std::chrono::seconds cLongTimeout{5};
+                const std::chrono::milliseconds cEnqueueDelay{20};
+
+                MpscRingBuffer<int> _buffer;
+                int _actualResult;
+                EXPECT_FALSE(_buffer.TryDequeue(_actualResult, cShortTimeout));
+
+                std::thread _producer(
+                    [&]()
+                    {
+                        std::this_thread::sleep_for(cEnqueueDelay);
+                        _buffer.TryEnqueue(int{cExpectedResult});
+                    });
+
+                EXPECT_TRUE(_buffer.TryDequeue(_actualResult, cLongTimeout));
+                EXPECT_EQ(cExpectedResult, _actualResult);
+
+                _producer.join();
+            }
+
+            TEST(RingBufferTest, MultiProducerMultiConsumer)
+            {
+                const int cThreadCount = 4;
+                const int cElementCount = 10000;
+                const std::size_t cCapacity = 64;
+                const std::chrono::seconds cTimeout{5};
+
+                MpmcRingBuffer<int> _buffer(cCapacity);
+                std::vector<std::thread> _threads;
+                std::vector<long> _sums(cThreadCount, 0);
+
+                for (int i = 0; i < cThreadCount; ++i)
+                {
+                    _threads.emplace_back(
+                        [&]()
+                        {
+                            for (int j = 1; j <= cElementCount; ++j)
+                            {
+                                ASSERT_TRUE(_buffer.TryEnqueue(int{j}, cTimeout));
+                            }
+                        });
+
+                    _threads.emplace_back(
+                        [&, i]()
+                        {
+                            for (int j = 0; j < cElementCount; ++j)
+                            {
+                                int _element;
+                                ASSERT_TRUE(_buffer.TryDequeue(_element, cTimeout));
+                                _sums[i] += _element;
+                            }
+                        });
+                }
+
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                long _actualSum = 0;
+                for (long _sum : _sums)
+                {
+                    _actualSum += _sum;
+                }
+
+                const long cExpectedSum =
+                    static_cast<long>(cThreadCount) * cElementCount * (cElementCount + 1) / 2;
+                EXPECT_EQ(cExpectedSum, _actualSum);
+                EXPECT_TRUE(_buffer.Empty());
+            }
+        }
+    }
+}
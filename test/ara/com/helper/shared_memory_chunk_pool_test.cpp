@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "../../../../src/ara/com/helper/shared_memory_chunk_pool.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            static std::string getPoolName(const std::string &suffix)
+            {
+                return "/ara_com_pool_test_" + std::to_string(getpid()) + "_" + suffix;
+            }
+
+            TEST(SharedMemoryChunkPoolTest, Constructor)
+            {
+                const std::size_t cChunkSize = 100;
+                const std::size_t cChunkCount = 3;
+
+                EXPECT_THROW(
+                    SharedMemoryChunkPool(getPoolName("invalid"), 0, cChunkCount),
+                    std::invalid_argument);
+                EXPECT_THROW(SharedMemoryChunkPool{getPoolName("missing")}, std::runtime_error);
+
+                SharedMemoryChunkPool _creator(getPoolName("constructor"), cChunkSize, cChunkCount);
+                SharedMemoryChunkPool _opener(getPoolName("constructor"));
+
+                EXPECT_EQ(cChunkSize, _opener.ChunkSize());
+                EXPECT_EQ(cChunkCount, _opener.ChunkCount());
+                EXPECT_EQ(cChunkCount, _opener.FreeChunks());
+            }
+
+            TEST(SharedMemoryChunkPoolTest, SharedChunk)
+            {
+                const std::size_t cChunkSize = 100;
+                const std::size_t cChunkCount = 2;
+                const uint8_t cByte = 0xa5;
+
+                SharedMemoryChunkPool _creator(getPoolName("shared"), cChunkSize, cChunkCount);
+                SharedMemoryChunkPool _opener(getPoolName("shared"));
+
+                uint32_t _chunk = _creator.TryLoan();
+                ASSERT_NE(SharedMemoryChunkPool::cInvalidChunk, _chunk);
+                _creator.Data(_chunk)[cChunkSize - 1] = cByte;
+                _creator.SetSize(_chunk, cChunkSize);
+
+                // The chunk index is valid across the mappings.
+                EXPECT_EQ(cByte, _opener.Data(_chunk)[cChunkSize - 1]);
+                EXPECT_EQ(cChunkSize, _opener.Size(_chunk));
+
+                _creator.Retain(_chunk);
+                _creator.Release(_chunk);
+                EXPECT_EQ(cChunkCount - 1, _opener.FreeChunks());
+
+                _opener.Release(_chunk);
+                EXPECT_EQ(cChunkCount, _creator.FreeChunks());
+            }
+
+            TEST(SharedMemoryChunkPoolTest, Exhaustion)
+            {
+                const std::size_t cChunkSize = 8;
+                const std::size_t cChunkCount = 2;
+
+                SharedMemoryChunkPool _pool(getPoolName("exhaustion"), cChunkSize, cChunkCount);
+
+                LoanedSample _first(&_pool, _pool.TryLoan());
+                LoanedSample _second(&_pool, _pool.TryLoan());
+                EXPECT_TRUE(_first);
+                EXPECT_TRUE(_second);
+                EXPECT_NE(_first.Data(), _second.Data());
+                EXPECT_EQ(SharedMemoryChunkPool::cInvalidChunk, _pool.TryLoan());
+
+                LoanedSample _moved{std::move(_first)};
+                EXPECT_FALSE(_first);
+                EXPECT_EQ(0, _pool.FreeChunks());
+
+                _moved.Reset();
+                EXPECT_EQ(1, _pool.FreeChunks());
+                EXPECT_NE(SharedMemoryChunkPool::cInvalidChunk, _pool.TryLoan());
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <condition_variable>
+#include "../../../../src/ara/com/helper/shared_memory_network_layer.h"
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            class SharedMemoryNetworkLayerTest : public testing::Test
+            {
+            protected:
+                using ShmLayer = SharedMemoryNetworkLayer<someip::sd::SomeIpSdMessage>;
+
+                const std::string ClientRingName;
+                const std::string ServerRingName;
+                std::mutex Mutex;
+                std::condition_variable ConditionVariable;
+                std::size_t ReceivedMessages;
+                someip::sd::SomeIpSdMessage Message;
+
+                SharedMemoryNetworkLayerTest() : ClientRingName{"/ara_com_shm_test_" + std::to_string(getpid()) + "_client"},
+                                                 ServerRingName{"/ara_com_shm_test_" + std::to_string(getpid()) + "_server"},
+                                                 ReceivedMessages{0}
+                {
+                    Message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                }
+
+                void SetReceiver(ShmLayer &layer)
+                {
+                    layer.SetReceiver(
+                        this,
+                        [this](std::shared_ptr<const someip::sd::SomeIpSdMessage> message)
+                        {
+                            EXPECT_EQ(Message.Payload(), message->Payload());
+
+                            std::lock_guard<std::mutex> _lock(Mutex);
+                            ++ReceivedMessages;
+                            ConditionVariable.notify_one();
+                        });
+                }
+
+                bool WaitFor(std::size_t expectedMessages)
+                {
+                    const std::chrono::seconds cTimeout(1);
+
+                    std::unique_lock<std::mutex> _lock(Mutex);
+                    return ConditionVariable.wait_for(
+                        _lock,
+                        cTimeout,
+                        [&]()
+                        { return ReceivedMessages >= expectedMessages; });
+                }
+            };
+
+            TEST_F(SharedMemoryNetworkLayerTest, Send)
+            {
+                const std::size_t cNumberOfMessages = 10;
+
+                ShmLayer _client(ClientRingName, ServerRingName);
+                ShmLayer _server(ServerRingName, ClientRingName);
+                SetReceiver(_server);
+
+                for (std::size_t i = 0; i < cNumberOfMessages; ++i)
+                {
+                    _client.Send(Message);
+                }
+
+                EXPECT_TRUE(WaitFor(cNumberOfMessages));
+                EXPECT_EQ(0, _client.FailedSends());
+                EXPECT_EQ(0, _server.DroppedPayloads());
+
+                _server.ResetReceiver(this);
+            }
+
+            TEST_F(SharedMemoryNetworkLayerTest, SendPayload)
+            {
+                ShmLayer _client(ClientRingName, ServerRingName);
+                ShmLayer _server(ServerRingName, ClientRingName);
+                SetReceiver(_client);
+
+                _server.SendPayload(Message.Payload());
+
+                EXPECT_TRUE(WaitFor(1));
+                _client.ResetReceiver(this);
+            }
+
+            TEST_F(SharedMemoryNetworkLayerTest, FullRing)
+            {
+                const std::size_t cCapacity = 8;
+
+                ShmLayer _client(ClientRingName, ServerRingName, cCapacity);
+                _client.Send(Message);
+
+                EXPECT_EQ(1, _client.FailedSends());
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#include "../../../../src/ara/com/helper/shared_memory_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            static std::string getRingName(const std::string &suffix)
+            {
+                return "/ara_com_ring_test_" + std::to_string(getpid()) + "_" + suffix;
+            }
+
+            TEST(SharedMemoryRingTest, Constructor)
+            {
+                const std::size_t cCapacity = 60;
+                const std::size_t cAlignedCapacity = 64;
+
+                SharedMemoryRing _creator(getRingName("constructor"), cCapacity);
+                SharedMemoryRing _opener(getRingName("constructor"));
+
+                EXPECT_EQ(cAlignedCapacity, _creator.Capacity());
+                EXPECT_EQ(cAlignedCapacity, _opener.Capacity());
+                EXPECT_TRUE(_opener.Empty());
+            }
+
+            TEST(SharedMemoryRingTest, WrapAround)
+            {
+                const std::size_t cCapacity = 64;
+                const std::size_t cRecordSize = 20;
+                const int cRounds = 10;
+
+                SharedMemoryRing _writer(getRingName("wrap"), cCapacity);
+                SharedMemoryRing _reader(getRingName("wrap"));
+
+                for (int i = 0; i < cRounds; ++i)
+                {
+                    const std::vector<uint8_t> cRecord(cRecordSize, static_cast<uint8_t>(i));
+                    ASSERT_TRUE(_writer.TryWrite(cRecord.data(), cRecord.size()));
+                    EXPECT_FALSE(_reader.Empty());
+
+                    std::size_t _received =
+                        _reader.Receive(
+                            [&](const uint8_t *data, std::size_t size)
+                            {
+                                std::vector<uint8_t> _actual(data, data + size);
+                                EXPECT_EQ(cRecord, _actual);
+                            });
+
+                    EXPECT_EQ(1, _received);
+                    EXPECT_TRUE(_reader.Empty());
+                }
+            }
+
+            TEST(SharedMemoryRingTest, FullRing)
+            {
+                const std::size_t cCapacity = 64;
+                const std::size_t cRecordSize = 28;
+                const std::vector<uint8_t> cRecord(cRecordSize, 0xff);
+
+                SharedMemoryRing _writer(getRingName("full"), cCapacity);
+                SharedMemoryRing _reader(getRingName("full"));
+
+                EXPECT_TRUE(_writer.TryWrite(cRecord.data(), cRecord.size()));
+                EXPECT_TRUE(_writer.TryWrite(cRecord.data(), cRecord.size()));
+                EXPECT_FALSE(_writer.TryWrite(cRecord.data(), cRecord.size()));
+
+                EXPECT_EQ(2, _reader.Receive([](const uint8_t *, std::size_t) {}));
+                EXPECT_TRUE(_writer.TryWrite(cRecord.data(), cRecord.size()));
+            }
+
+            TEST(SharedMemoryRingTest, InPlaceReservation)
+            {
+                const uint8_t cByte = 0x5a;
+                SharedMemoryRing _writer(getRingName("reservation"));
+                SharedMemoryRing _reader(getRingName("reservation"));
+
+                uint8_t *_record = _writer.TryReserve(sizeof(cByte));
+                ASSERT_NE(nullptr, _record);
+                *_record = cByte;
+
+                // The reservation is not visible before the commit.
+                EXPECT_TRUE(_reader.Empty());
+                _writer.Commit(sizeof(cByte));
+
+                _reader.Receive(
+                    [&](const uint8_t *data, std::size_t size)
+                    {
+                        EXPECT_EQ(sizeof(cByte), size);
+                        EXPECT_EQ(cByte, *data);
+                    });
+            }
+
+            TEST(SharedMemoryRingTest, InterProcessWait)
+            {
+                const int cTimeout = 1000;
+                const int cNumberOfRecords = 100;
+
+                // The name must be resolved before forking the writer process.
+                const std::string cName{getRingName("process")};
+                SharedMemoryRing _reader(cName);
+
+                pid_t _child = fork();
+                ASSERT_GE(_child, 0);
+                if (_child == 0)
+                {
+                    SharedMemoryRing _writer(cName);
+                    for (int i = 0; i < cNumberOfRecords; ++i)
+                    {
+                        while (!_writer.TryWrite(reinterpret_cast<const uint8_t *>(&i), sizeof(i)))
+                        {
+                        }
+                    }
+                    _exit(0);
+                }
+
+                int _expected = 0;
+                while (_expected < cNumberOfRecords && _reader.Wait(cTimeout))
+                {
+                    _reader.Receive(
+                        [&](const uint8_t *data, std::size_t size)
+                        {
+                            int _actual;
+                            ASSERT_EQ(sizeof(_actual), size);
+                            std::memcpy(&_actual, data, size);
+                            EXPECT_EQ(_expected, _actual);
+                            ++_expected;
+                        });
+                }
+
+                int _status;
+                waitpid(_child, &_status, 0);
+                EXPECT_EQ(cNumberOfRecords, _expected);
+            }
+        }
+    }
+}
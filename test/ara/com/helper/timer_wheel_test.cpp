@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "../../../../src/ara/com/helper/timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            TEST(TimerWheelTest, Constructor)
+            {
+                const std::chrono::milliseconds cInvalidTick{0};
+
+                EXPECT_THROW(TimerWheel{cInvalidTick}, std::invalid_argument);
+
+                TimerWheel _wheel;
+                EXPECT_EQ(0, _wheel.Pending());
+            }
+
+            TEST(TimerWheelTest, ExpirationOrder)
+            {
+                const std::vector<int> cDelays{30, 10, 90, 20};
+                const std::vector<int> cExpectedOrder{10, 20, 30, 90};
+
+                TimerWheel _wheel;
+                std::mutex _mutex;
+                std::condition_variable _conditionVariable;
+                std::vector<int> _order;
+
+                const auto cStartTime{std::chrono::steady_clock::now()};
+                for (int _delay : cDelays)
+                {
+                    _wheel.Schedule(
+                        std::chrono::milliseconds(_delay),
+                        [&, _delay]()
+                        {
+                            // A timer never fires earlier than its delay.
+                            EXPECT_GE(
+                                std::chrono::steady_clock::now() - cStartTime,
+                                std::chrono::milliseconds(_delay));
+
+                            std::lock_guard<std::mutex> _lock(_mutex);
+                            _order.push_back(_delay);
+                            _conditionVariable.notify_one();
+                        });
+                }
+
+                const std::chrono::seconds cTimeout{1};
+                std::unique_lock<std::mutex> _lock(_mutex);
+                EXPECT_TRUE(
+                    _conditionVariable.wait_for(
+                        _lock, cTimeout, [&]()
+                        { return _order.size() == cDelays.size(); }));
+                EXPECT_EQ(cExpectedOrder, _order);
+            }
+
+            TEST(TimerWheelTest, Cancel)
+            {
+                const std::chrono::milliseconds cDelay{20};
+
+                TimerWheel _wheel;
+                std::atomic_bool _fired{false};
+                TimerWheel::TimerId _timer =
+                    _wheel.Schedule(cDelay, [&]()
+                                    { _fired = true; });
+
+                EXPECT_EQ(1, _wheel.Pending());
+                EXPECT_TRUE(_wheel.Cancel(_timer));
+                EXPECT_EQ(0, _wheel.Pending());
+
+                std::this_thread::sleep_for(cDelay * 3);
+                EXPECT_FALSE(_fired);
+                EXPECT_FALSE(_wheel.Cancel(_timer));
+                EXPECT_FALSE(_wheel.Cancel(TimerWheel::cInvalidTimer));
+            }
+
+            TEST(TimerWheelTest, ManyTimers)
+            {
+                const int cTimerCount = 5000;
+                // Spread the timers over the first two levels
+                const int cMaxDelay = 300;
+
+                TimerWheel _wheel;
+                std::atomic_int _fired{0};
+                std::vector<TimerWheel::TimerId> _timers;
+
+                for (int i = 0; i < cTimerCount; ++i)
+                {
+                    _timers.push_back(
+                        _wheel.Schedule(
+                            std::chrono::milliseconds(i % cMaxDelay),
+                            [&]()
+                            { ++_fired; }));
+                }
+
+                // Cancel every other timer
+                int _cancelled = 0;
+                for (std::size_t i = 0; i < _timers.size(); i += 2)
+                {
+                    if (_wheel.Cancel(_timers[i]))
+                    {
+                        ++_cancelled;
+                    }
+                }
+
+                const auto cDeadline{
+                    std::chrono::steady_clock::now() + std::chrono::seconds(2)};
+                while (_wheel.Pending() > 0 && std::chrono::steady_clock::now() < cDeadline)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+
+                EXPECT_EQ(0, _wheel.Pending());
+                EXPECT_EQ(cTimerCount, _fired + _cancelled);
+            }
+        }
+    }
+}
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "../../../../src/ara/com/helper/ttl_timer.h"
 
 namespace ara
@@ -35,6 +38,30 @@ namespace ara
                 
                 EXPECT_TRUE(_timer.GetOffered());
             }
+
+            TEST(TtlTimerTest, Expiration)
+            {
+                const uint32_t cTtl{1};
+                const std::chrono::seconds cTimeout{cTtl * 3};
+
+                TtlTimer _timer;
+                std::atomic_int _signals{0};
+                _timer.SetHandler([&_signals]()
+                                  { ++_signals; });
+
+                _timer.SetOffered(cTtl);
+                EXPECT_EQ(1, _signals.load());
+
+                // The offer should be withdrawn by the wheel timer if it is not renewed within the TTL.
+                const auto cDeadline{std::chrono::steady_clock::now() + cTimeout};
+                while (_timer.GetOffered() && std::chrono::steady_clock::now() < cDeadline)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+
+                EXPECT_FALSE(_timer.GetOffered());
+                EXPECT_EQ(2, _signals.load());
+            }
         }
     }
 }
\ No newline at end of file
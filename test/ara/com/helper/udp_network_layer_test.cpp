@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../src/ara/com/helper/udp_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            class UdpNetworkLayerTest : public testing::Test
+            {
+            protected:
+                static const int cPollTimeout = 100;
+
+                EpollPoller Poller;
+                std::size_t ReceivedEntries;
+
+                UdpNetworkLayerTest() : ReceivedEntries{0}
+                {
+                }
+
+                void SetReceiver(UdpNetworkLayer<someip::sd::SomeIpSdMessage> &receiver)
+                {
+                    receiver.SetReceiver(
+                        this,
+                        [this](std::shared_ptr<const someip::sd::SomeIpSdMessage> message)
+                        { ReceivedEntries += message->EntryRecords().size(); });
+                }
+
+                void Poll(std::size_t expectedEntries)
+                {
+                    // Bound the polls to avoid hanging on a lost datagram
+                    const int cMaxPolls = 10;
+
+                    for (int i = 0; i < cMaxPolls && ReceivedEntries < expectedEntries; ++i)
+                    {
+                        ASSERT_TRUE(Poller.TryPoll(cPollTimeout));
+                    }
+                }
+            };
+
+            TEST_F(UdpNetworkLayerTest, LoopbackReception)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40490;
+                const uint16_t cReceiverPort = 40491;
+
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _sender(
+                    &Poller, cLocalhost, cSenderPort, cLocalhost, cReceiverPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _receiver(
+                    &Poller, cLocalhost, cReceiverPort, cLocalhost, cSenderPort);
+                SetReceiver(_receiver);
+
+                const std::size_t cExpectedEntries = 1;
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                _sender.Send(_message);
+                Poll(cExpectedEntries);
+
+                EXPECT_EQ(cExpectedEntries, ReceivedEntries);
+                EXPECT_EQ(0, _sender.FailedSends());
+                EXPECT_EQ(0, _receiver.DroppedPayloads());
+            }
+
+            TEST_F(UdpNetworkLayerTest, BatchedLoopbackReception)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40492;
+                const uint16_t cReceiverPort = 40493;
+
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _sender(
+                    &Poller, cLocalhost, cSenderPort, cLocalhost, cReceiverPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _receiver(
+                    &Poller, cLocalhost, cReceiverPort, cLocalhost, cSenderPort);
+                SetReceiver(_receiver);
+
+                // More than a single batch
+                const std::size_t cNumberOfPayloads = UdpSocket::cBatchSize + 36;
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                const std::vector<std::vector<uint8_t>> cPayloads(cNumberOfPayloads, _message.Payload());
+
+                EXPECT_EQ(cNumberOfPayloads, _sender.SendPayloads(cPayloads));
+                Poll(cNumberOfPayloads);
+
+                EXPECT_EQ(cNumberOfPayloads, ReceivedEntries);
+            }
+
+            TEST_F(UdpNetworkLayerTest, MalformedAndTruncatedDatagrams)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40494;
+                const uint16_t cReceiverPort = 40495;
+
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _sender(
+                    &Poller, cLocalhost, cSenderPort, cLocalhost, cReceiverPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _receiver(
+                    &Poller, cLocalhost, cReceiverPort, cLocalhost, cSenderPort);
+                SetReceiver(_receiver);
+
+                const std::vector<uint8_t> cGarbagePayload{0xde, 0xad, 0xbe, 0xef};
+                const std::vector<uint8_t> cOversizedPayload(UdpSocket::cMaxDatagramSize + 1);
+
+                _sender.SendPayload(cGarbagePayload);
+                _sender.SendPayload(cOversizedPayload);
+                ASSERT_TRUE(Poller.TryPoll(cPollTimeout));
+
+                EXPECT_EQ(0, ReceivedEntries);
+                EXPECT_EQ(1, _receiver.DroppedPayloads());
+                EXPECT_EQ(1, _receiver.TruncatedDatagrams());
+            }
+
+            TEST_F(UdpNetworkLayerTest, UnicastFanOut)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40496;
+                const uint16_t cFirstReceiverPort = 40497;
+                const uint16_t cSecondReceiverPort = 40498;
+
+                UdpSocket _sender(cLocalhost, cSenderPort, cLocalhost, cFirstReceiverPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _firstReceiver(
+                    &Poller, cLocalhost, cFirstReceiverPort, cLocalhost, cSenderPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _secondReceiver(
+                    &Poller, cLocalhost, cSecondReceiverPort, cLocalhost, cSenderPort);
+                SetReceiver(_firstReceiver);
+                SetReceiver(_secondReceiver);
+
+                // More than a single batch by repeating the receivers endpoints
+                std::vector<DatagramEndpoint> _endpoints;
+                for (std::size_t i = 0; i < UdpSocket::cBatchSize; ++i)
+                {
+                    _endpoints.push_back(DatagramEndpoint{cLocalhost, cFirstReceiverPort});
+                    _endpoints.push_back(DatagramEndpoint{cLocalhost, cSecondReceiverPort});
+                }
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                const std::vector<uint8_t> cPayload{_message.Payload()};
+
+                EXPECT_EQ(_endpoints.size(), _sender.SendTo(cPayload.data(), cPayload.size(), _endpoints));
+                Poll(_endpoints.size());
+
+                EXPECT_EQ(_endpoints.size(), ReceivedEntries);
+            }
+
+            TEST_F(UdpNetworkLayerTest, FanOutFailureSkip)
+            {
+                const Ipv4Address cLocalhost(127, 0, 0, 1);
+                const uint16_t cSenderPort = 40499;
+                const uint16_t cReceiverPort = 40500;
+                // The kernel refuses the UDP datagrams towards the zero port.
+                const uint16_t cInvalidPort = 0;
+
+                UdpSocket _sender(cLocalhost, cSenderPort, cLocalhost, cReceiverPort);
+                UdpNetworkLayer<someip::sd::SomeIpSdMessage> _receiver(
+                    &Poller, cLocalhost, cReceiverPort, cLocalhost, cSenderPort);
+                SetReceiver(_receiver);
+
+                const std::vector<DatagramEndpoint> cEndpoints{
+                    DatagramEndpoint{cLocalhost, cReceiverPort},
+                    DatagramEndpoint{cLocalhost, cInvalidPort},
+                    DatagramEndpoint{cLocalhost, cReceiverPort}};
+                const std::size_t cExpectedEntries = 2;
+
+                someip::sd::SomeIpSdMessage _message;
+                _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                const std::vector<uint8_t> cPayload{_message.Payload()};
+
+                EXPECT_EQ(cExpectedEntries, _sender.SendTo(cPayload.data(), cPayload.size(), cEndpoints));
+                Poll(cExpectedEntries);
+
+                EXPECT_EQ(cExpectedEntries, ReceivedEntries);
+                EXPECT_EQ(1, _sender.FailedDatagrams());
+            }
+        }
+    }
+}
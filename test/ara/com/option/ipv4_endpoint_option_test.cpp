@@ -65,6 +65,26 @@ namespace ara
                 EXPECT_TRUE(_areEqual);
             }
 
+            TEST(Ipv4EndpointOptionTest, RecordMethod)
+            {
+                const bool cDiscardable = true;
+                const helper::Ipv4Address cIpAddress(127, 0, 0, 1);
+                const Layer4ProtocolType cProtocol = Layer4ProtocolType::Tcp;
+                const uint16_t cPort = 8080;
+
+                auto _option =
+                    Ipv4EndpointOption::CreateUnitcastEndpoint(
+                        cDiscardable, cIpAddress, cProtocol, cPort);
+
+                OptionRecord _record = _option->Record();
+
+                EXPECT_EQ(OptionType::IPv4Endpoint, _record.Type);
+                EXPECT_EQ(cDiscardable, _record.Discardable);
+                EXPECT_EQ(cIpAddress.Octets, _record.Ipv4Endpoint.Octets);
+                EXPECT_EQ(cProtocol, _record.Ipv4Endpoint.Protocol);
+                EXPECT_EQ(cPort, _record.Ipv4Endpoint.Port);
+            }
+
             TEST(Ipv4EndpointOptionTest, Deserializing)
             {
                 const bool cDiscardable = true;
@@ -49,6 +49,46 @@ namespace ara
                 EXPECT_TRUE(_areEqual);
             }
 
+            TEST(LoadBalancingOptionTest, SerializeToMethod)
+            {
+                const bool cDiscardable = false;
+                const uint16_t cPriority = 1;
+                const uint16_t cWeight = 2;
+
+                LoadBalancingOption _option(cDiscardable, cPriority, cWeight);
+
+                const size_t cPayloadSize = 8;
+                const std::array<uint8_t, cPayloadSize> cExpectedPayload =
+                    {0x00, 0x05, 0x02, 0x00,
+                     0x00, 0x01, 0x00, 0x02};
+
+                std::array<uint8_t, cPayloadSize> _actualPayload;
+                std::size_t _size =
+                    _option.SerializeTo(_actualPayload.data(), _actualPayload.size());
+
+                EXPECT_EQ(cPayloadSize, _size);
+                EXPECT_EQ(cExpectedPayload, _actualPayload);
+
+                EXPECT_THROW(
+                    _option.SerializeTo(_actualPayload.data(), cPayloadSize - 1),
+                    std::out_of_range);
+            }
+
+            TEST(LoadBalancingOptionTest, RecordMethod)
+            {
+                const bool cDiscardable = false;
+                const uint16_t cPriority = 1;
+                const uint16_t cWeight = 2;
+
+                LoadBalancingOption _option(cDiscardable, cPriority, cWeight);
+                OptionRecord _record = _option.Record();
+
+                EXPECT_EQ(OptionType::LoadBalancing, _record.Type);
+                EXPECT_EQ(cDiscardable, _record.Discardable);
+                EXPECT_EQ(cPriority, _record.LoadBalancing.Priority);
+                EXPECT_EQ(cWeight, _record.LoadBalancing.Weight);
+            }
+
             TEST(LoadBalancingOptionTest, Deserializing)
             {
                 const bool cDiscardable = false;
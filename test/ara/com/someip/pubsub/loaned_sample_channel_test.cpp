@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../../../../../src/ara/com/someip/pubsub/loaned_sample_channel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                class LoanedSampleChannelTest : public testing::Test
+                {
+                protected:
+                    static const std::size_t cChunkSize = 1024;
+                    static const std::size_t cChunkCount = 4;
+
+                    const std::string PoolName;
+                    LoanedSamplePublisher Publisher;
+
+                    LoanedSampleChannelTest() : PoolName{"/ara_com_channel_test_" + std::to_string(getpid())},
+                                                Publisher(PoolName, cChunkSize, cChunkCount)
+                    {
+                    }
+
+                    std::string GetQueueName(const std::string &suffix) const
+                    {
+                        return PoolName + "_" + suffix;
+                    }
+                };
+
+                const std::size_t LoanedSampleChannelTest::cChunkSize;
+                const std::size_t LoanedSampleChannelTest::cChunkCount;
+
+                TEST_F(LoanedSampleChannelTest, ZeroCopyDelivery)
+                {
+                    const uint8_t cByte = 0x3c;
+
+                    LoanedSampleSubscriber _first(PoolName, GetQueueName("first"));
+                    LoanedSampleSubscriber _second(PoolName, GetQueueName("second"));
+                    Publisher.AddSubscriber(GetQueueName("first"));
+                    Publisher.AddSubscriber(GetQueueName("second"));
+
+                    helper::LoanedSample _sample{Publisher.Loan()};
+                    ASSERT_TRUE(_sample);
+                    std::memset(_sample.Data(), cByte, cChunkSize);
+                    const uint32_t cChunk = _sample.Chunk();
+
+                    EXPECT_EQ(2, Publisher.Publish(std::move(_sample), cChunkSize));
+                    EXPECT_EQ(cChunkCount - 1, Publisher.FreeChunks());
+
+                    // The first subscriber keeps the event beyond the callback.
+                    helper::LoanedSample _kept;
+                    EXPECT_EQ(
+                        1,
+                        _first.Take(
+                            [&](helper::LoanedSample &&sample)
+                            { _kept = std::move(sample); }));
+                    EXPECT_EQ(
+                        1,
+                        _second.Take(
+                            [&](helper::LoanedSample &&sample)
+                            {
+                                EXPECT_EQ(cChunk, sample.Chunk());
+                                EXPECT_EQ(cChunkSize, sample.Size());
+                                EXPECT_EQ(cByte, sample.Data()[cChunkSize - 1]);
+                            }));
+                    EXPECT_EQ(cChunkCount - 1, Publisher.FreeChunks());
+
+                    _kept.Reset();
+                    EXPECT_EQ(cChunkCount, Publisher.FreeChunks());
+
+                    Publisher.RemoveSubscriber(GetQueueName("first"));
+                    Publisher.RemoveSubscriber(GetQueueName("second"));
+                }
+
+                TEST_F(LoanedSampleChannelTest, NoSubscriber)
+                {
+                    EXPECT_EQ(0, Publisher.Publish(Publisher.Loan(), cChunkSize));
+                    EXPECT_EQ(cChunkCount, Publisher.FreeChunks());
+                    EXPECT_EQ(0, Publisher.Publish(helper::LoanedSample(), cChunkSize));
+                }
+
+                TEST_F(LoanedSampleChannelTest, PoolExhaustion)
+                {
+                    LoanedSampleSubscriber _subscriber(PoolName, GetQueueName("slow"));
+                    Publisher.AddSubscriber(GetQueueName("slow"));
+
+                    // The slow subscriber holds all the chunks in its queue.
+                    for (std::size_t i = 0; i < cChunkCount; ++i)
+                    {
+                        EXPECT_EQ(1, Publisher.Publish(Publisher.Loan(), cChunkSize));
+                    }
+                    EXPECT_FALSE(Publisher.Loan());
+
+                    EXPECT_EQ(cChunkCount, _subscriber.Take([](helper::LoanedSample &&) {}));
+                    EXPECT_TRUE(Publisher.Loan());
+
+                    Publisher.RemoveSubscriber(GetQueueName("slow"));
+                }
+
+                TEST_F(LoanedSampleChannelTest, InterProcessDelivery)
+                {
+                    const int cTimeout = 1000;
+                    const std::string cQueueName{GetQueueName("process")};
+
+                    LoanedSampleSubscriber _subscriber(PoolName, cQueueName);
+
+                    pid_t _child = fork();
+                    ASSERT_GE(_child, 0);
+                    if (_child == 0)
+                    {
+                        // The child publishes through the parent pool, so it must not destruct the parent objects.
+                        LoanedSamplePublisher *_publisher = &Publisher;
+                        _publisher->AddSubscriber(cQueueName);
+                        helper::LoanedSample _sample{_publisher->Loan()};
+                        const uint32_t cPid = static_cast<uint32_t>(getpid());
+                        std::memcpy(_sample.Data(), &cPid, sizeof(cPid));
+                        _publisher->Publish(std::move(_sample), sizeof(cPid));
+                        _exit(0);
+                    }
+
+                    std::size_t _taken = 0;
+                    while (_taken == 0 && _subscriber.Wait(cTimeout))
+                    {
+                        _taken +=
+                            _subscriber.Take(
+                                [&](helper::LoanedSample &&sample)
+                                {
+                                    uint32_t _pid;
+                                    std::memcpy(&_pid, sample.Data(), sizeof(_pid));
+                                    EXPECT_EQ(static_cast<uint32_t>(_child), _pid);
+                                });
+                    }
+
+                    int _status;
+                    waitpid(_child, &_status, 0);
+                    EXPECT_EQ(1, _taken);
+                    EXPECT_EQ(cChunkCount, Publisher.FreeChunks());
+                }
+            }
+        }
+    }
+}
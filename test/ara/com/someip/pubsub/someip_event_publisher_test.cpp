@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "../../../../../src/ara/com/someip/pubsub/someip_event_publisher.h"
+#include "../../../../../src/ara/com/someip/someip_message_view.h"
+#include "../../helper/mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                class MockupDatagramSender : public helper::DatagramSender
+                {
+                private:
+                    std::mutex mMutex;
+                    std::vector<std::vector<uint8_t>> mDatagrams;
+                    std::size_t mEndpointCount;
+
+                public:
+                    MockupDatagramSender() : mEndpointCount{0}
+                    {
+                    }
+
+                    std::size_t SendTo(
+                        const uint8_t *data,
+                        std::size_t size,
+                        const std::vector<helper::DatagramEndpoint> &endpoints) override
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        mDatagrams.emplace_back(data, data + size);
+                        mEndpointCount = endpoints.size();
+
+                        return endpoints.size();
+                    }
+
+                    std::vector<std::vector<uint8_t>> Datagrams()
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        return mDatagrams;
+                    }
+
+                    std::size_t EndpointCount()
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        return mEndpointCount;
+                    }
+                };
+
+                class SomeIpEventPublisherTest : public testing::Test
+                {
+                private:
+                    helper::MockupNetworkLayer<sd::SomeIpSdMessage> mNetworkLayer;
+
+                    static void addSubscription(
+                        sd::SomeIpSdMessage &message,
+                        uint8_t subscriberId,
+                        option::Layer4ProtocolType protocol)
+                    {
+                        const bool cDiscardable{false};
+                        const uint8_t cCounter{0};
+                        const uint16_t cSubscriberPort{20001};
+
+                        auto _entry =
+                            entry::EventgroupEntry::CreateSubscribeEventEntry(
+                                cServiceId, cInstanceId, cMajorVersion, cCounter, cEventgroupId);
+                        _entry->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                cDiscardable,
+                                helper::Ipv4Address(192, 168, 0, subscriberId),
+                                protocol,
+                                cSubscriberPort));
+                        message.AddEntry(std::move(_entry));
+                    }
+
+                protected:
+                    static const uint16_t cServiceId = 1;
+                    static const uint16_t cInstanceId = 1;
+                    static const uint8_t cMajorVersion = 1;
+                    static const uint16_t cEventgroupId = 1;
+                    static const uint16_t cEventId = 0x8001;
+
+                    SomeIpPubSubMultiServer Server;
+                    MockupDatagramSender Sender;
+                    SomeIpEventMessage Event;
+
+                    SomeIpEventPublisherTest() : Server(&mNetworkLayer,
+                                                        cServiceId,
+                                                        cInstanceId,
+                                                        cMajorVersion),
+                                                 Event(cServiceId, cEventId, cMajorVersion)
+                    {
+                        const uint16_t cMulticastPort{10001};
+
+                        Server.AddEventgroup(
+                            cEventgroupId, helper::Ipv4Address(239, 0, 0, 1), cMulticastPort);
+                        Server.Start();
+
+                        // Two UDP subscribers and a TCP subscriber which is not notified via datagrams
+                        sd::SomeIpSdMessage _message;
+                        addSubscription(_message, 1, option::Layer4ProtocolType::Udp);
+                        addSubscription(_message, 2, option::Layer4ProtocolType::Udp);
+                        addSubscription(_message, 3, option::Layer4ProtocolType::Tcp);
+                        mNetworkLayer.Send(_message);
+
+                        Event.SetData(std::vector<uint8_t>{0x01, 0x02, 0x03, 0x04});
+                    }
+
+                    static std::size_t CountMessages(const std::vector<uint8_t> &datagram)
+                    {
+                        std::size_t _result = 0;
+
+                        for (std::size_t _offset = 0; _offset < datagram.size(); ++_result)
+                        {
+                            SomeIpMessageView _view(datagram.data() + _offset, datagram.size() - _offset);
+                            if (!_view.IsValid())
+                            {
+                                return 0;
+                            }
+
+                            _offset += _view.Size();
+                        }
+
+                        return _result;
+                    }
+                };
+
+                const uint16_t SomeIpEventPublisherTest::cEventgroupId;
+
+                TEST_F(SomeIpEventPublisherTest, Constructor)
+                {
+                    const std::chrono::milliseconds cNegativeWindow{-1};
+                    const std::size_t cInvalidDatagramSize{0};
+
+                    EXPECT_THROW(
+                        SomeIpEventPublisher(&Server, &Sender, cNegativeWindow),
+                        std::invalid_argument);
+
+                    EXPECT_THROW(
+                        SomeIpEventPublisher(
+                            &Server, &Sender, std::chrono::milliseconds::zero(), cInvalidDatagramSize),
+                        std::invalid_argument);
+                }
+
+                TEST_F(SomeIpEventPublisherTest, ImmediateNotification)
+                {
+                    const std::size_t cExpectedEndpointCount{2};
+                    const uint16_t cSessionId{Event.SessionId()};
+
+                    SomeIpEventPublisher _publisher(&Server, &Sender);
+                    _publisher.Publish(cEventgroupId, Event);
+                    _publisher.Publish(cEventgroupId, Event);
+
+                    const auto cDatagrams = Sender.Datagrams();
+                    ASSERT_EQ(2, cDatagrams.size());
+                    EXPECT_EQ(cExpectedEndpointCount, Sender.EndpointCount());
+                    EXPECT_EQ(1, CountMessages(cDatagrams.at(0)));
+                    EXPECT_EQ(Event.Size(), cDatagrams.at(0).size());
+
+                    SomeIpMessageView _view(cDatagrams.at(1));
+                    EXPECT_EQ(cSessionId + 1, _view.SessionId());
+                    EXPECT_EQ(SomeIpMessageType::Notification, _view.MessageType());
+                }
+
+                TEST_F(SomeIpEventPublisherTest, NoSubscriber)
+                {
+                    const uint16_t cUnsubscribedEventgroupId{2};
+
+                    SomeIpEventPublisher _publisher(&Server, &Sender);
+                    _publisher.Publish(cUnsubscribedEventgroupId, Event);
+
+                    EXPECT_TRUE(Sender.Datagrams().empty());
+                }
+
+                TEST_F(SomeIpEventPublisherTest, CoalescedNotification)
+                {
+                    const std::chrono::milliseconds cWindow{50};
+                    const std::size_t cEventCount{3};
+
+                    SomeIpEventPublisher _publisher(&Server, &Sender, cWindow);
+                    for (std::size_t i = 0; i < cEventCount; ++i)
+                    {
+                        _publisher.Publish(cEventgroupId, Event);
+                    }
+
+                    EXPECT_TRUE(Sender.Datagrams().empty());
+
+                    std::this_thread::sleep_for(cWindow * 4);
+
+                    const auto cDatagrams = Sender.Datagrams();
+                    ASSERT_EQ(1, cDatagrams.size());
+                    EXPECT_EQ(cEventCount, CountMessages(cDatagrams.at(0)));
+                    EXPECT_EQ(0, _publisher.Flush());
+                }
+
+                TEST_F(SomeIpEventPublisherTest, FlushedWindow)
+                {
+                    const std::chrono::milliseconds cWindow{50};
+
+                    SomeIpEventPublisher _publisher(&Server, &Sender, cWindow);
+                    _publisher.Publish(cEventgroupId, Event);
+                    EXPECT_EQ(1, _publisher.Flush());
+
+                    // The flush closes the window, so the next event starts a new one.
+                    _publisher.Publish(cEventgroupId, Event);
+                    EXPECT_EQ(1, Sender.Datagrams().size());
+
+                    std::this_thread::sleep_for(cWindow * 4);
+
+                    const auto cDatagrams = Sender.Datagrams();
+                    ASSERT_EQ(2, cDatagrams.size());
+                    EXPECT_EQ(1, CountMessages(cDatagrams.at(1)));
+                }
+
+                TEST_F(SomeIpEventPublisherTest, DatagramSizeLimit)
+                {
+                    const std::chrono::milliseconds cWindow{10000};
+                    const std::size_t cEventPerDatagram{2};
+
+                    SomeIpEventPublisher _publisher(
+                        &Server, &Sender, cWindow, cEventPerDatagram * Event.Size());
+
+                    // The first two events fill the datagram, and the third one waits for the window.
+                    _publisher.Publish(cEventgroupId, Event);
+                    _publisher.Publish(cEventgroupId, Event);
+                    _publisher.Publish(cEventgroupId, Event);
+
+                    auto _datagrams = Sender.Datagrams();
+                    ASSERT_EQ(1, _datagrams.size());
+                    EXPECT_EQ(cEventPerDatagram, CountMessages(_datagrams.at(0)));
+
+                    EXPECT_EQ(1, _publisher.Flush());
+                    _datagrams = Sender.Datagrams();
+                    ASSERT_EQ(2, _datagrams.size());
+                    EXPECT_EQ(1, CountMessages(_datagrams.at(1)));
+                }
+            }
+        }
+    }
+}
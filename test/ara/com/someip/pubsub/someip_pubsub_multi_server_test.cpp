@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "../../../../../src/ara/com/someip/pubsub/someip_pubsub_multi_server.h"
+#include "../../helper/mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace pubsub
+            {
+                class SomeIpPubSubMultiServerTest : public testing::Test
+                {
+                private:
+                    helper::MockupNetworkLayer<sd::SomeIpSdMessage> mNetworkLayer;
+
+                    void onMessageReceived(std::shared_ptr<const sd::SomeIpSdMessage> message)
+                    {
+                        std::size_t _acknowledgeCount = 0;
+                        for (const auto &_entry : message->EntryRecords())
+                        {
+                            if (_entry.Type == entry::EntryType::Acknowledging)
+                            {
+                                if (_entry.TTL > 0)
+                                {
+                                    ++AcknowledgeCount;
+                                }
+                                else
+                                {
+                                    ++NegativeAcknowledgeCount;
+                                }
+
+                                ++_acknowledgeCount;
+                            }
+                        }
+
+                        if (_acknowledgeCount > 0)
+                        {
+                            ++ReplyCount;
+                        }
+                    }
+
+                protected:
+                    static const uint16_t cServiceId = 1;
+                    static const uint16_t cInstanceId = 1;
+                    static const uint8_t cMajorVersion = 1;
+                    static const uint16_t cFirstEventgroupId = 1;
+                    static const uint16_t cSecondEventgroupId = 2;
+                    static const uint16_t cUnknownEventgroupId = 3;
+                    static const uint16_t cMulticastPort = 10001;
+                    static const uint16_t cSubscriberPort = 20001;
+
+                    SomeIpPubSubMultiServer Server;
+                    std::size_t ReplyCount;
+                    std::size_t AcknowledgeCount;
+                    std::size_t NegativeAcknowledgeCount;
+
+                    SomeIpPubSubMultiServerTest() : Server(&mNetworkLayer,
+                                                           cServiceId,
+                                                           cInstanceId,
+                                                           cMajorVersion),
+                                                    ReplyCount{0},
+                                                    AcknowledgeCount{0},
+                                                    NegativeAcknowledgeCount{0}
+                    {
+                        Server.AddEventgroup(
+                            cFirstEventgroupId, helper::Ipv4Address(239, 0, 0, 1), cMulticastPort);
+                        Server.AddEventgroup(
+                            cSecondEventgroupId, helper::Ipv4Address(239, 0, 0, 2), cMulticastPort);
+
+                        auto _receiver =
+                            std::bind(
+                                &SomeIpPubSubMultiServerTest::onMessageReceived,
+                                this,
+                                std::placeholders::_1);
+                        mNetworkLayer.SetReceiver(this, _receiver);
+                    }
+
+                    ~SomeIpPubSubMultiServerTest() override
+                    {
+                        mNetworkLayer.ResetReceiver(this);
+                    }
+
+                    static void AddSubscription(
+                        sd::SomeIpSdMessage &message,
+                        uint16_t eventgroupId,
+                        uint8_t subscriberId,
+                        uint32_t ttl = SomeIpPubSubMultiServer::cInfiniteTtl,
+                        option::Layer4ProtocolType protocol = option::Layer4ProtocolType::Udp)
+                    {
+                        const bool cDiscardable{false};
+                        const uint8_t cCounter{0};
+
+                        std::unique_ptr<entry::EventgroupEntry> _entry;
+                        if (ttl > 0)
+                        {
+                            _entry = entry::EventgroupEntry::CreateSubscribeEventEntry(
+                                cServiceId, cInstanceId, cMajorVersion, cCounter, eventgroupId, ttl);
+                        }
+                        else
+                        {
+                            _entry = entry::EventgroupEntry::CreateUnsubscribeEventEntry(
+                                cServiceId, cInstanceId, cMajorVersion, cCounter, eventgroupId);
+                        }
+
+                        _entry->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                cDiscardable,
+                                helper::Ipv4Address(192, 168, 0, subscriberId),
+                                protocol,
+                                cSubscriberPort));
+                        message.AddEntry(std::move(_entry));
+                    }
+
+                    void Send(const sd::SomeIpSdMessage &message)
+                    {
+                        mNetworkLayer.Send(message);
+                    }
+                };
+
+                const uint16_t SomeIpPubSubMultiServerTest::cFirstEventgroupId;
+                const uint16_t SomeIpPubSubMultiServerTest::cSecondEventgroupId;
+                const uint16_t SomeIpPubSubMultiServerTest::cUnknownEventgroupId;
+                const uint16_t SomeIpPubSubMultiServerTest::cSubscriberPort;
+
+                TEST_F(SomeIpPubSubMultiServerTest, Constructor)
+                {
+                    EXPECT_EQ(helper::PubSubState::ServiceDown, Server.GetState(cFirstEventgroupId));
+                    EXPECT_THROW(
+                        Server.AddEventgroup(
+                            cFirstEventgroupId, helper::Ipv4Address(239, 0, 0, 1), cMulticastPort),
+                        std::invalid_argument);
+
+                    Server.Start();
+                    EXPECT_EQ(helper::PubSubState::NotSubscribed, Server.GetState(cFirstEventgroupId));
+                    EXPECT_EQ(helper::PubSubState::ServiceDown, Server.GetState(cUnknownEventgroupId));
+                }
+
+                TEST_F(SomeIpPubSubMultiServerTest, BatchedAcknowledgeScenario)
+                {
+                    const std::size_t cExpectedReplyCount{1};
+                    const std::size_t cExpectedAcknowledgeCount{3};
+                    const uint8_t cFirstSubscriberId{1};
+                    const uint8_t cSecondSubscriberId{2};
+
+                    sd::SomeIpSdMessage _message;
+                    AddSubscription(_message, cFirstEventgroupId, cFirstSubscriberId);
+                    AddSubscription(_message, cFirstEventgroupId, cSecondSubscriberId);
+                    AddSubscription(_message, cSecondEventgroupId, cFirstSubscriberId);
+                    AddSubscription(_message, cUnknownEventgroupId, cFirstSubscriberId);
+
+                    Server.Start();
+                    Send(_message);
+
+                    EXPECT_EQ(cExpectedReplyCount, ReplyCount);
+                    EXPECT_EQ(cExpectedAcknowledgeCount, AcknowledgeCount);
+                    EXPECT_EQ(0, NegativeAcknowledgeCount);
+
+                    EXPECT_EQ(helper::PubSubState::Subscribed, Server.GetState(cFirstEventgroupId));
+                    EXPECT_EQ(helper::PubSubState::Subscribed, Server.GetState(cSecondEventgroupId));
+                    EXPECT_EQ(2, Server.GetSubscribers(cFirstEventgroupId).size());
+
+                    const auto cSubscribers = Server.GetSubscribers(cSecondEventgroupId);
+                    ASSERT_EQ(1, cSubscribers.size());
+                    EXPECT_EQ(helper::Ipv4Address(192, 168, 0, cFirstSubscriberId), cSubscribers.at(0).Address);
+                    EXPECT_EQ(cSubscriberPort, cSubscribers.at(0).Port);
+                    EXPECT_EQ(SomeIpPubSubMultiServer::cInfiniteTtl, cSubscribers.at(0).TTL);
+
+                    // A renewal should not add a duplicate subscriber.
+                    Send(_message);
+                    EXPECT_EQ(2, Server.GetSubscribers(cFirstEventgroupId).size());
+                }
+
+                TEST_F(SomeIpPubSubMultiServerTest, UnsubscribeScenario)
+                {
+                    const uint8_t cSubscriberId{1};
+
+                    sd::SomeIpSdMessage _subscribeMessage;
+                    AddSubscription(_subscribeMessage, cFirstEventgroupId, cSubscriberId);
+
+                    sd::SomeIpSdMessage _unsubscribeMessage;
+                    AddSubscription(_unsubscribeMessage, cFirstEventgroupId, cSubscriberId, 0);
+
+                    Server.Start();
+                    Send(_subscribeMessage);
+                    EXPECT_EQ(helper::PubSubState::Subscribed, Server.GetState(cFirstEventgroupId));
+
+                    Send(_unsubscribeMessage);
+                    EXPECT_EQ(helper::PubSubState::NotSubscribed, Server.GetState(cFirstEventgroupId));
+                    EXPECT_EQ(1, ReplyCount);
+                }
+
+                TEST_F(SomeIpPubSubMultiServerTest, NegativeAcknowledgeScenario)
+                {
+                    const std::size_t cExpectedNegativeAcknowledgeCount{2};
+                    const uint8_t cSubscriberId{1};
+
+                    sd::SomeIpSdMessage _message;
+                    AddSubscription(_message, cFirstEventgroupId, cSubscriberId);
+                    AddSubscription(_message, cSecondEventgroupId, cSubscriberId);
+
+                    Send(_message);
+
+                    EXPECT_EQ(1, ReplyCount);
+                    EXPECT_EQ(0, AcknowledgeCount);
+                    EXPECT_EQ(cExpectedNegativeAcknowledgeCount, NegativeAcknowledgeCount);
+
+                    Server.Start();
+                    Send(_message);
+                    Server.Stop();
+
+                    EXPECT_EQ(helper::PubSubState::ServiceDown, Server.GetState(cFirstEventgroupId));
+                    EXPECT_TRUE(Server.GetSubscribers(cFirstEventgroupId).empty());
+                }
+
+                TEST_F(SomeIpPubSubMultiServerTest, ExpiryScenario)
+                {
+                    const uint8_t cSubscriberId{1};
+                    const uint32_t cTtl{1};
+
+                    sd::SomeIpSdMessage _message;
+                    AddSubscription(_message, cFirstEventgroupId, cSubscriberId, cTtl);
+
+                    Server.Start();
+                    Send(_message);
+
+                    const auto cSubscribers = Server.GetSubscribers(cFirstEventgroupId);
+                    ASSERT_EQ(1, cSubscribers.size());
+                    EXPECT_EQ(cTtl, cSubscribers.at(0).TTL);
+                    EXPECT_EQ(0, Server.Purge());
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+                    EXPECT_EQ(1, Server.Purge());
+                    EXPECT_EQ(helper::PubSubState::NotSubscribed, Server.GetState(cFirstEventgroupId));
+                }
+
+                TEST_F(SomeIpPubSubMultiServerTest, SubscriberEndpoints)
+                {
+                    const uint8_t cUdpSubscriberId{1};
+                    const uint8_t cTcpSubscriberId{2};
+
+                    sd::SomeIpSdMessage _message;
+                    AddSubscription(_message, cFirstEventgroupId, cUdpSubscriberId);
+                    AddSubscription(
+                        _message,
+                        cFirstEventgroupId,
+                        cTcpSubscriberId,
+                        SomeIpPubSubMultiServer::cInfiniteTtl,
+                        option::Layer4ProtocolType::Tcp);
+
+                    Server.Start();
+                    Send(_message);
+
+                    // The stale endpoint should be overwritten.
+                    std::vector<helper::DatagramEndpoint> _endpoints{
+                        helper::DatagramEndpoint{helper::Ipv4Address(10, 0, 0, 1), cSubscriberPort}};
+
+                    ASSERT_EQ(1, Server.GetSubscribers(cFirstEventgroupId, _endpoints));
+                    ASSERT_EQ(1, _endpoints.size());
+                    EXPECT_EQ(helper::Ipv4Address(192, 168, 0, cUdpSubscriberId), _endpoints.at(0).Address);
+                    EXPECT_EQ(cSubscriberPort, _endpoints.at(0).Port);
+
+                    EXPECT_EQ(0, Server.GetSubscribers(cUnknownEventgroupId, _endpoints));
+                    EXPECT_TRUE(_endpoints.empty());
+                }
+            }
+        }
+    }
+}
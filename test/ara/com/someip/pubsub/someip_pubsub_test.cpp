@@ -56,7 +56,7 @@ namespace ara
                 TEST_F(SomeIpPubSubTest, NoServerRunning)
                 {
                     const int cMinimalDuration = 1;
-                    sd::SomeIpSdMessage _message;
+                    std::shared_ptr<const sd::SomeIpSdMessage> _message;
 
                     EXPECT_FALSE(
                         Client.TryGetProcessedSubscription(
@@ -81,7 +81,7 @@ namespace ara
                     const option::OptionType cExpectedOptionType =
                         option::OptionType::IPv4Multicast;
                     const uint16_t cExpectedPort{cPort};
-                    sd::SomeIpSdMessage _message;
+                    std::shared_ptr<const sd::SomeIpSdMessage> _message;
 
                     Server.Start();
                     Client.Subscribe(
@@ -89,17 +89,17 @@ namespace ara
                     bool _succeed =
                         Client.TryGetProcessedSubscription(cWaitingDuration, _message);
 
-                    EXPECT_TRUE(_succeed);
+                    ASSERT_TRUE(_succeed);
 
                     auto _eventgroupEntry =
                         dynamic_cast<entry::EventgroupEntry *>(
-                            _message.Entries().at(0).get());
+                            _message->Entries().at(0).get());
 
                     EXPECT_GT(_eventgroupEntry->TTL(), 0);
                     EXPECT_EQ(_eventgroupEntry->FirstOptions().size(), 1);
 
                     auto _endpointOption =
-                        dynamic_cast<option::Ipv4EndpointOption *>(
+                        dynamic_cast<const option::Ipv4EndpointOption *>(
                             _eventgroupEntry->FirstOptions().at(0).get());
 
                     EXPECT_EQ(_endpointOption->Type(), cExpectedOptionType);
@@ -112,18 +112,18 @@ namespace ara
                 {
                     const helper::PubSubState cExpectedState =
                         helper::PubSubState::ServiceDown;
-                    sd::SomeIpSdMessage _message;
+                    std::shared_ptr<const sd::SomeIpSdMessage> _message;
 
                     Client.Subscribe(
                         cServiceId, cInstanceId, cMajorVersion, cEventgroupId);
                     bool _succeed =
                         Client.TryGetProcessedSubscription(cWaitingDuration, _message);
 
-                    EXPECT_TRUE(_succeed);
+                    ASSERT_TRUE(_succeed);
 
                     auto _eventgroupEntry =
                         dynamic_cast<entry::EventgroupEntry *>(
-                            _message.Entries().at(0).get());
+                            _message->Entries().at(0).get());
 
                     EXPECT_EQ(_eventgroupEntry->TTL(), 0);
                     EXPECT_EQ(cExpectedState, Server.GetState());
@@ -133,7 +133,7 @@ namespace ara
                 {
                     const helper::PubSubState cExpectedState =
                         helper::PubSubState::NotSubscribed;
-                    sd::SomeIpSdMessage _message;
+                    std::shared_ptr<const sd::SomeIpSdMessage> _message;
 
                     Server.Start();
                     Client.Subscribe(
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "../../../../../../src/ara/com/someip/sd/fsm/notready_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/initial_wait_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/repetition_state.h"
@@ -59,6 +62,7 @@ namespace ara
                         EXPECT_EQ(_actualState, cExpectedState);
 
                         EXPECT_NO_THROW(_machineState.Activate(cPreviousState));
+                        _machineState.ServiceStopped();
                     }
 
                     TEST(MachineStateTest, RepetitionStateConstructor)
@@ -73,7 +77,7 @@ namespace ara
                             helper::SdServerState::NotReady;
                         const int cRepetitionsMax = 2;
                         const int cRepetitionsBaseDelay = 100;
-                        uint32_t _counter = 0;
+                        std::atomic_int _counter{0};
                         const auto cOnTimerExpired = [&_counter]()
                         {
                             ++_counter;
@@ -92,9 +96,42 @@ namespace ara
                         EXPECT_EQ(_actualState, cExpectedState);
 
                         EXPECT_NO_THROW(_machineState.Activate(cPreviousState));
-                        // Due to blocking invocation, the counter value should be equal to the maximum repetitions.
-                        EXPECT_EQ(_counter, cRepetitionsMax);
+
+                        // The repetitions are served by the timer wheel, so the activation returns at once.
+                        const auto cDeadline{
+                            std::chrono::steady_clock::now() +
+                            std::chrono::milliseconds(cRepetitionsBaseDelay * 10)};
+                        while (_counter < cRepetitionsMax && std::chrono::steady_clock::now() < cDeadline)
+                        {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        }
+
+                        EXPECT_EQ(_counter.load(), cRepetitionsMax);
                         // Finish the test gracefully
+                        _machineState.ServiceStopped();
+                    }
+
+                    TEST(MachineStateTest, MainStateStop)
+                    {
+                        const helper::SdServerState cPreviousState =
+                            helper::SdServerState::RepetitionPhase;
+                        const int cCyclicOfferDelay = 60000;
+                        std::atomic_int _counter{0};
+                        const auto cOnTimerExpired = [&_counter]()
+                        {
+                            ++_counter;
+                        };
+
+                        MainState _machineState(cOnTimerExpired, cCyclicOfferDelay);
+                        _machineState.Activate(cPreviousState);
+
+                        // The stop should cancel the cyclic offer timer without waiting for the cycle.
+                        const auto cStartTime{std::chrono::steady_clock::now()};
+                        _machineState.ServiceStopped();
+                        const auto cElapsed{std::chrono::steady_clock::now() - cStartTime};
+
+                        EXPECT_LT(cElapsed, std::chrono::milliseconds(cCyclicOfferDelay));
+                        EXPECT_EQ(0, _counter.load());
                     }
 
                     TEST(MachineStateTest, MainStateConstructor)
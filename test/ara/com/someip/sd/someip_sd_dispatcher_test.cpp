@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/entry/eventgroup_entry.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_dispatcher.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_server.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_client.h"
+#include "../../../../../src/ara/com/someip/pubsub/someip_pubsub_server.h"
+#include "../../helper/mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                class SomeIpSdDispatcherTest : public testing::Test
+                {
+                protected:
+                    static const uint16_t cServiceId = 1;
+                    static const uint16_t cOtherServiceId = 2;
+                    static const uint16_t cInstanceId = 1;
+                    static const uint16_t cOtherInstanceId = 2;
+                    static const uint8_t cMajorVersion = 1;
+                    static const uint32_t cMinorVersion = 0;
+                    static const uint16_t cEventgroupId = 3;
+                    static const uint8_t cCounter = 0;
+
+                    helper::MockupNetworkLayer<SomeIpSdMessage> NetworkLayer;
+                    SomeIpSdDispatcher Dispatcher;
+
+                    SomeIpSdDispatcherTest() : Dispatcher(&NetworkLayer)
+                    {
+                    }
+
+                    void SendOffer(uint16_t serviceId, uint16_t instanceId)
+                    {
+                        SomeIpSdMessage _message;
+                        auto _entry{
+                            entry::ServiceEntry::CreateOfferServiceEntry(
+                                serviceId, instanceId, cMajorVersion, cMinorVersion)};
+                        _message.AddEntry(std::move(_entry));
+                        NetworkLayer.Send(_message);
+                    }
+                };
+
+                TEST_F(SomeIpSdDispatcherTest, ServiceRouting)
+                {
+                    int _matchedCounter = 0;
+                    int _otherCounter = 0;
+                    int _anyCounter = 0;
+
+                    Dispatcher.Register(
+                        &_matchedCounter, entry::EntryType::Offering, cServiceId, cInstanceId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &entry)
+                        {
+                            EXPECT_EQ(entry.ServiceId, static_cast<uint16_t>(cServiceId));
+                            ++_matchedCounter;
+                        });
+                    Dispatcher.Register(
+                        &_otherCounter, entry::EntryType::Offering, cOtherServiceId, cInstanceId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &)
+                        {
+                            ++_otherCounter;
+                        });
+                    Dispatcher.Register(
+                        &_anyCounter, entry::EntryType::Offering, cServiceId, entry::Entry::cAnyInstanceId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &)
+                        {
+                            ++_anyCounter;
+                        });
+
+                    SendOffer(cServiceId, cInstanceId);
+                    SendOffer(cServiceId, cOtherInstanceId);
+
+                    EXPECT_EQ(_matchedCounter, 1);
+                    EXPECT_EQ(_otherCounter, 0);
+                    EXPECT_EQ(_anyCounter, 2);
+
+                    Dispatcher.Unregister(&_anyCounter);
+                    SendOffer(cServiceId, cInstanceId);
+
+                    EXPECT_EQ(_matchedCounter, 2);
+                    EXPECT_EQ(_anyCounter, 2);
+                }
+
+                TEST_F(SomeIpSdDispatcherTest, EventgroupRouting)
+                {
+                    const uint16_t cOtherEventgroupId = cEventgroupId + 1;
+
+                    int _counter = 0;
+                    Dispatcher.Register(
+                        &_counter, entry::EntryType::Subscribing, cServiceId, cInstanceId, cEventgroupId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &entry)
+                        {
+                            EXPECT_EQ(entry.Eventgroup.EventgroupId, static_cast<uint16_t>(cEventgroupId));
+                            ++_counter;
+                        });
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(
+                        entry::EventgroupEntry::CreateSubscribeEventEntry(
+                            cServiceId, cInstanceId, cMajorVersion, cCounter, cOtherEventgroupId));
+                    _message.AddEntry(
+                        entry::EventgroupEntry::CreateSubscribeEventEntry(
+                            cServiceId, cInstanceId, cMajorVersion, cCounter, cEventgroupId));
+                    NetworkLayer.Send(_message);
+
+                    EXPECT_EQ(_counter, 1);
+                }
+
+                TEST_F(SomeIpSdDispatcherTest, InvalidRegistration)
+                {
+                    auto _handler =
+                        [](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &) {};
+
+                    EXPECT_THROW(
+                        Dispatcher.Register(
+                            this, entry::EntryType::Subscribing, cServiceId, cInstanceId, _handler),
+                        std::invalid_argument);
+                    EXPECT_THROW(
+                        Dispatcher.Register(
+                            this, entry::EntryType::Offering, cServiceId, cInstanceId, cEventgroupId, _handler),
+                        std::invalid_argument);
+                }
+
+                TEST_F(SomeIpSdDispatcherTest, UnregisterAfterOlderSnapshotDispatch)
+                {
+                    const std::chrono::milliseconds cDispatchDuration{20};
+
+                    int _slowHandler;
+                    int _laterHandler;
+                    std::atomic_bool _entered{false};
+                    std::atomic_bool _finished{false};
+
+                    Dispatcher.Register(
+                        &_slowHandler, entry::EntryType::Offering, cServiceId, cInstanceId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &)
+                        {
+                            _entered = true;
+                            std::this_thread::sleep_for(cDispatchDuration);
+                            _finished = true;
+                        });
+
+                    std::thread _receiver([this]()
+                                          { SendOffer(cServiceId, cInstanceId); });
+
+                    while (!_entered)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    // The in-flight dispatch holds a table older than the one being replaced by the unregistration.
+                    Dispatcher.Register(
+                        &_laterHandler, entry::EntryType::Offering, cOtherServiceId, cInstanceId,
+                        [](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &) {});
+                    Dispatcher.Unregister(&_slowHandler);
+                    EXPECT_TRUE(_finished);
+
+                    _receiver.join();
+                }
+
+                TEST_F(SomeIpSdDispatcherTest, OfferScenario)
+                {
+                    const uint16_t cPort = 8080;
+                    const int cInitialDelayMin = 10;
+                    const int cInitialDelayMax = 20;
+                    const int cRepetitionBaseDelay = 20;
+                    const uint32_t cRepetitionMax = 2;
+                    const int cCycleOfferDelay = 10;
+                    const int cWaitDuration = 2000;
+                    const helper::Ipv4Address cLocalhost(127, 0, 0, 1);
+
+                    SomeIpSdServer _server(
+                        &Dispatcher,
+                        cServiceId,
+                        cInstanceId,
+                        cMajorVersion,
+                        cMinorVersion,
+                        cLocalhost,
+                        cPort,
+                        cInitialDelayMin,
+                        cInitialDelayMax,
+                        cRepetitionBaseDelay,
+                        cCycleOfferDelay,
+                        cRepetitionMax);
+                    SomeIpSdClient _client(
+                        &Dispatcher,
+                        cServiceId,
+                        cInitialDelayMin,
+                        cInitialDelayMax,
+                        cRepetitionBaseDelay,
+                        cRepetitionMax);
+
+                    _server.Start();
+                    _client.Start();
+
+                    EXPECT_TRUE(_client.TryWaitUntiServiceOffered(cWaitDuration));
+
+                    _server.Stop();
+                    _client.Stop();
+                }
+
+                TEST_F(SomeIpSdDispatcherTest, PubSubServerScenario)
+                {
+                    const uint16_t cPort = 5555;
+                    const helper::Ipv4Address cMulticastIp(239, 0, 0, 1);
+
+                    int _acknowledgeCounter = 0;
+                    Dispatcher.Register(
+                        &_acknowledgeCounter,
+                        entry::EntryType::Acknowledging,
+                        cServiceId,
+                        cInstanceId,
+                        cEventgroupId,
+                        [&](const std::shared_ptr<const SomeIpSdMessage> &, const entry::EntryRecord &entry)
+                        {
+                            EXPECT_GT(entry.TTL, 0);
+                            ++_acknowledgeCounter;
+                        });
+
+                    pubsub::SomeIpPubSubServer _server(
+                        &Dispatcher, cServiceId, cInstanceId, cMajorVersion, cEventgroupId, cMulticastIp, cPort);
+                    _server.Start();
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(
+                        entry::EventgroupEntry::CreateSubscribeEventEntry(
+                            cServiceId, cInstanceId, cMajorVersion, cCounter, cEventgroupId));
+                    NetworkLayer.Send(_message);
+
+                    EXPECT_EQ(_server.GetState(), helper::PubSubState::Subscribed);
+                    EXPECT_EQ(_acknowledgeCounter, 1);
+                }
+            }
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <array>
 #include "../../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../../src/ara/com/entry/eventgroup_entry.h"
 #include "../../../../../src/ara/com/entry/service_entry.h"
 #include "../../../../../src/ara/com/option/loadbalancing_option.h"
 #include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
@@ -121,6 +122,380 @@ namespace ara
                     EXPECT_TRUE(_areEqual);
                 }
 
+                TEST(SomeIpSdMessageTest, SerializeMethod)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_entry));
+
+                    auto _expectedPayload = _message.Payload();
+                    EXPECT_EQ(_expectedPayload.size(), _expectedPayload.capacity());
+
+                    std::vector<uint8_t> _actualPayload;
+                    _message.Serialize(_actualPayload);
+                    EXPECT_EQ(_expectedPayload, _actualPayload);
+
+                    // Re-serializing into the cleared buffer should reuse its capacity
+                    const uint8_t *cBufferData = _actualPayload.data();
+                    _actualPayload.clear();
+                    _message.Serialize(_actualPayload);
+                    EXPECT_EQ(_expectedPayload, _actualPayload);
+                    EXPECT_EQ(cBufferData, _actualPayload.data());
+
+                    // Appending repeatedly should grow the buffer geometrically rather than per message
+                    const std::size_t cMessageCount = 64;
+                    const std::size_t cMaxReallocationCount = 16;
+                    std::size_t _reallocationCount = 0;
+                    std::vector<uint8_t> _appendedPayload;
+                    for (std::size_t i = 0; i < cMessageCount; ++i)
+                    {
+                        const std::size_t cCapacity = _appendedPayload.capacity();
+                        _message.Serialize(_appendedPayload);
+                        if (_appendedPayload.capacity() != cCapacity)
+                        {
+                            ++_reallocationCount;
+                        }
+                    }
+
+                    EXPECT_EQ(cMessageCount * _expectedPayload.size(), _appendedPayload.size());
+                    EXPECT_LT(_reallocationCount, cMaxReallocationCount);
+                }
+
+                TEST(SomeIpSdMessageTest, SerializeToMethod)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_entry));
+
+                    auto _expectedPayload = _message.Payload();
+                    EXPECT_EQ(_expectedPayload.size(), _message.Size());
+
+                    std::vector<uint8_t> _actualPayload(_expectedPayload.size());
+                    std::size_t _size =
+                        _message.SerializeTo(_actualPayload.data(), _actualPayload.size());
+
+                    EXPECT_EQ(_expectedPayload.size(), _size);
+                    EXPECT_EQ(_expectedPayload, _actualPayload);
+
+                    EXPECT_THROW(
+                        _message.SerializeTo(_actualPayload.data(), _size - 1),
+                        std::out_of_range);
+                }
+
+                TEST(SomeIpSdMessageTest, ScatterGatherSerializeToMethod)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_entry));
+
+                    const std::size_t cSegmentCapacity = 64;
+                    std::array<std::array<uint8_t, cSegmentCapacity>, SomeIpSdMessage::cSegmentCount> _buffers;
+                    std::array<iovec, SomeIpSdMessage::cSegmentCount> _segments;
+                    for (std::size_t i = 0; i < SomeIpSdMessage::cSegmentCount; ++i)
+                    {
+                        _segments[i].iov_base = _buffers[i].data();
+                        _segments[i].iov_len = cSegmentCapacity;
+                    }
+
+                    std::size_t _size = _message.SerializeTo(_segments);
+
+                    std::vector<uint8_t> _actualPayload;
+                    for (const iovec &segment : _segments)
+                    {
+                        auto _segmentBegin = static_cast<const uint8_t *>(segment.iov_base);
+                        _actualPayload.insert(
+                            _actualPayload.end(),
+                            _segmentBegin,
+                            _segmentBegin + segment.iov_len);
+                    }
+
+                    auto _expectedPayload = _message.Payload();
+                    EXPECT_EQ(_expectedPayload.size(), _size);
+                    EXPECT_EQ(_expectedPayload, _actualPayload);
+
+                    // Entries segment is too small for the single entry.
+                    const std::size_t cEntriesSegmentIndex = 1;
+                    for (std::size_t i = 0; i < SomeIpSdMessage::cSegmentCount; ++i)
+                    {
+                        _segments[i].iov_len = cSegmentCapacity;
+                    }
+                    _segments[cEntriesSegmentIndex].iov_len = entry::Entry::cEntrySize - 1;
+
+                    EXPECT_THROW(
+                        _message.SerializeTo(_segments),
+                        std::out_of_range);
+                }
+
+                TEST(SomeIpSdMessageTest, RecordsDeserialization)
+                {
+                    const uint16_t cPort = 8080;
+
+                    auto _firstEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _endpointOption =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            cPort);
+                    _firstEntry->AddFirstOption(std::move(_endpointOption));
+
+                    auto _secondEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(5, 6, 7, 8);
+                    auto _loadBalancingOption =
+                        std::make_unique<option::LoadBalancingOption>(true, 0, 1);
+                    _secondEntry->AddSecondOption(std::move(_loadBalancingOption));
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(std::move(_firstEntry));
+                    _originalMessage.AddEntry(std::move(_secondEntry));
+
+                    auto _payload = _originalMessage.Payload();
+                    auto _deserializedMessage = SomeIpSdMessage::Deserialize(_payload);
+
+                    const auto &cEntryRecords = _deserializedMessage.EntryRecords();
+                    const auto &cOptionRecords = _deserializedMessage.OptionRecords();
+                    ASSERT_EQ(2, cEntryRecords.size());
+                    ASSERT_EQ(2, cOptionRecords.size());
+
+                    EXPECT_EQ(1, cEntryRecords[0].ServiceId);
+                    EXPECT_EQ(0, cEntryRecords[0].FirstOptionIndex);
+                    EXPECT_EQ(1, cEntryRecords[0].FirstOptionCount);
+                    EXPECT_EQ(
+                        option::OptionType::IPv4Endpoint,
+                        cOptionRecords[cEntryRecords[0].FirstOptionIndex].Type);
+                    EXPECT_EQ(
+                        cPort,
+                        cOptionRecords[cEntryRecords[0].FirstOptionIndex].Ipv4Endpoint.Port);
+
+                    EXPECT_EQ(5, cEntryRecords[1].ServiceId);
+                    EXPECT_EQ(1, cEntryRecords[1].SecondOptionIndex);
+                    EXPECT_EQ(1, cEntryRecords[1].SecondOptionCount);
+                    EXPECT_EQ(
+                        option::OptionType::LoadBalancing,
+                        cOptionRecords[cEntryRecords[1].SecondOptionIndex].Type);
+                }
+
+                TEST(SomeIpSdMessageTest, EntriesOnDemand)
+                {
+                    auto _firstEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    _firstEntry->AddFirstOption(
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080));
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_firstEntry));
+                    ASSERT_EQ(1, _message.Entries().size());
+
+                    // The entries added after the first call are instantiated on the next call.
+                    auto _secondEntry =
+                        entry::EventgroupEntry::CreateSubscribeEventEntry(5, 6, 7, 1, 8);
+                    _message.AddEntry(std::move(_secondEntry));
+
+                    const auto &cEntries = _message.Entries();
+                    ASSERT_EQ(2, cEntries.size());
+                    EXPECT_EQ(1, cEntries[0]->ServiceId());
+                    EXPECT_EQ(1, cEntries[0]->FirstOptions().size());
+                    EXPECT_EQ(entry::EntryType::Subscribing, cEntries[1]->Type());
+                    EXPECT_EQ(5, cEntries[1]->ServiceId());
+                    EXPECT_TRUE(cEntries[1]->FirstOptions().empty());
+
+                    auto _eventgroupEntry = dynamic_cast<const entry::EventgroupEntry *>(cEntries[1].get());
+                    ASSERT_NE(nullptr, _eventgroupEntry);
+                    EXPECT_EQ(8, _eventgroupEntry->EventgroupId());
+                }
+
+                TEST(SomeIpSdMessageTest, SharedOptions)
+                {
+                    const uint16_t cNumberOfEntries = 20;
+                    const uint16_t cPort = 8080;
+                    // SOME/IP header + SD header + Options length + Entries + One shared endpoint option
+                    const std::size_t cExpectedSize = 16 + 8 + 4 + cNumberOfEntries * 16 + 12;
+
+                    SomeIpSdMessage _originalMessage;
+                    for (uint16_t _serviceId = 1; _serviceId <= cNumberOfEntries; ++_serviceId)
+                    {
+                        auto _entry =
+                            entry::ServiceEntry::CreateOfferServiceEntry(_serviceId, 1, 1, 0);
+                        _entry->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                false,
+                                helper::Ipv4Address(127, 0, 0, 1),
+                                option::Layer4ProtocolType::Tcp,
+                                cPort));
+                        _originalMessage.AddEntry(std::move(_entry));
+                    }
+
+                    // The distinct load-balancing option is appended after the shared endpoint option.
+                    auto _lastEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(cNumberOfEntries + 1, 1, 1, 0);
+                    _lastEntry->AddSecondOption(
+                        std::make_unique<option::LoadBalancingOption>(true, 0, 1));
+
+                    std::size_t _addedOptions;
+                    EXPECT_EQ(16 + 8, _originalMessage.AddedLength(*_lastEntry, _addedOptions));
+                    EXPECT_EQ(1, _addedOptions);
+
+                    EXPECT_EQ(cExpectedSize, _originalMessage.Size());
+                    _originalMessage.AddEntry(std::move(_lastEntry));
+
+                    const auto cPayload = _originalMessage.Payload();
+                    ASSERT_EQ(_originalMessage.Size(), cPayload.size());
+
+                    SomeIpSdMessage _deserializedMessage;
+                    ASSERT_TRUE(SomeIpSdMessage::TryDeserialize(cPayload, _deserializedMessage).HasValue());
+
+                    const auto &cEntryRecords = _deserializedMessage.EntryRecords();
+                    const auto &cOptionRecords = _deserializedMessage.OptionRecords();
+                    ASSERT_EQ(cNumberOfEntries + 1, cEntryRecords.size());
+                    ASSERT_EQ(2, cOptionRecords.size());
+
+                    const auto &cSharedOption = _deserializedMessage.Entries()[0]->FirstOptions().at(0);
+                    for (std::size_t i = 0; i < cNumberOfEntries; ++i)
+                    {
+                        EXPECT_EQ(0, cEntryRecords[i].FirstOptionIndex);
+                        EXPECT_EQ(1, cEntryRecords[i].FirstOptionCount);
+                        // The deserialized entries share a single instance of the shared option.
+                        EXPECT_EQ(cSharedOption, _deserializedMessage.Entries()[i]->FirstOptions().at(0));
+                    }
+
+                    EXPECT_EQ(cPort, cOptionRecords[0].Ipv4Endpoint.Port);
+                    EXPECT_EQ(1, cEntryRecords[cNumberOfEntries].SecondOptionIndex);
+                    EXPECT_EQ(
+                        option::OptionType::LoadBalancing,
+                        cOptionRecords[cEntryRecords[cNumberOfEntries].SecondOptionIndex].Type);
+
+                    EXPECT_EQ(cPayload, _deserializedMessage.Payload());
+                }
+
+                TEST(SomeIpSdMessageTest, OptionIndexOverflow)
+                {
+                    // The option run index is a byte, so the 257th distinct run cannot be referenced.
+                    const uint16_t cMaxIndexedEntries = 256;
+
+                    SomeIpSdMessage _message;
+                    for (uint16_t _port = 1; _port <= cMaxIndexedEntries + 1; ++_port)
+                    {
+                        auto _entry = entry::ServiceEntry::CreateOfferServiceEntry(1, 1, 1, 0);
+                        _entry->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                false,
+                                helper::Ipv4Address(127, 0, 0, 1),
+                                option::Layer4ProtocolType::Udp,
+                                _port));
+
+                        if (_port <= cMaxIndexedEntries)
+                        {
+                            _message.AddEntry(std::move(_entry));
+                        }
+                        else
+                        {
+                            EXPECT_THROW(_message.AddEntry(std::move(_entry)), std::out_of_range);
+                        }
+                    }
+
+                    EXPECT_EQ(cMaxIndexedEntries, _message.OptionRecords().size());
+                }
+
+                TEST(SomeIpSdMessageTest, AddEntryAfterDeserialization)
+                {
+                    const uint16_t cSharedPort = 8080;
+                    const uint16_t cDistinctPort = 9090;
+
+                    auto _createEntry =
+                        [](uint16_t serviceId, uint16_t port)
+                    {
+                        auto _result = entry::ServiceEntry::CreateOfferServiceEntry(serviceId, 1, 1, 0);
+                        _result->AddFirstOption(
+                            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                                false,
+                                helper::Ipv4Address(127, 0, 0, 1),
+                                option::Layer4ProtocolType::Tcp,
+                                port));
+
+                        return _result;
+                    };
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(_createEntry(1, cSharedPort));
+
+                    // The received options are indexed, so an identical option run is still shared.
+                    SomeIpSdMessage _message = SomeIpSdMessage::Deserialize(_originalMessage.Payload());
+                    _message.AddEntry(_createEntry(2, cSharedPort));
+                    _message.AddEntry(_createEntry(3, cDistinctPort));
+
+                    SomeIpSdMessage _deserializedMessage = SomeIpSdMessage::Deserialize(_message.Payload());
+                    const auto &cEntryRecords = _deserializedMessage.EntryRecords();
+                    const auto &cOptionRecords = _deserializedMessage.OptionRecords();
+                    ASSERT_EQ(3, cEntryRecords.size());
+                    ASSERT_EQ(2, cOptionRecords.size());
+
+                    EXPECT_EQ(0, cEntryRecords[0].FirstOptionIndex);
+                    EXPECT_EQ(0, cEntryRecords[1].FirstOptionIndex);
+                    EXPECT_EQ(1, cEntryRecords[2].FirstOptionIndex);
+                    EXPECT_EQ(cDistinctPort, cOptionRecords[1].Ipv4Endpoint.Port);
+                }
+
+                TEST(SomeIpSdMessageTest, OptionIndexDeserialization)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    _entry->AddFirstOption(
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080));
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(std::move(_entry));
+                    auto _payload = _originalMessage.Payload();
+
+                    // SOME/IP header + SD header + Entry type
+                    const std::size_t cFirstOptionIndexOffset = 16 + 8 + 1;
+                    // Reference a missing option
+                    _payload.at(cFirstOptionIndexOffset) = 0x01;
+
+                    SomeIpSdMessage _deserializedMessage;
+                    core::Result<void> _result{
+                        SomeIpSdMessage::TryDeserialize(_payload, _deserializedMessage)};
+                    ASSERT_FALSE(_result.HasValue());
+                    EXPECT_EQ(
+                        SomeIpErrc::kTruncatedOptions,
+                        static_cast<SomeIpErrc>(_result.Error().Value()));
+                }
+
                 TEST(SomeIpSdMessageTest, NoEntryDeserialization)
                 {
                     SomeIpSdMessage _originalMessage;
@@ -171,6 +546,121 @@ namespace ara
                         SomeIpSdMessage::Deserialize(_payload), std::out_of_range);
                 }
 
+                TEST(SomeIpSdMessageTest, TruncatedDeserialization)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(std::move(_entry));
+                    const auto cPayload = _originalMessage.Payload();
+
+                    // Every strict prefix of the payload should be rejected.
+                    for (std::size_t i = 0; i < cPayload.size(); ++i)
+                    {
+                        std::vector<uint8_t> _truncatedPayload(
+                            cPayload.begin(), cPayload.begin() + i);
+
+                        EXPECT_THROW(
+                            SomeIpSdMessage::Deserialize(_truncatedPayload),
+                            std::out_of_range);
+                    }
+                }
+
+                TEST(SomeIpSdMessageTest, OptionLengthDeserialization)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(std::move(_entry));
+                    auto _payload = _originalMessage.Payload();
+
+                    // SOME/IP header + SD header + Entry + Options length + Option length MSB
+                    const std::size_t cOptionLengthOffset = 16 + 8 + 16 + 4 + 1;
+                    // Violate the option length field
+                    _payload.at(cOptionLengthOffset) = 0x05;
+
+                    EXPECT_THROW(
+                        SomeIpSdMessage::Deserialize(_payload), std::out_of_range);
+                }
+
+                TEST(SomeIpSdMessageTest, TryDeserializeMethod)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _originalMessage;
+                    _originalMessage.AddEntry(std::move(_entry));
+                    const auto cPayload = _originalMessage.Payload();
+
+                    // SOME/IP header + SD header + Entry + Options length + Option length
+                    const std::size_t cOptionTypeOffset = 16 + 8 + 16 + 4 + 2;
+                    const std::vector<std::pair<std::size_t, uint8_t>> cViolations{
+                        {7, 0xff},                   // Length field
+                        {0, 0x00},                   // Message ID
+                        {16, 0x00},                  // Flags
+                        {23, 0x11},                  // Entries length
+                        {24, 0x05},                  // Entry type
+                        {27, 0x20},                  // Number of the first options
+                        {cOptionTypeOffset, 0x77}};  // Option type
+                    const std::vector<SomeIpErrc> cExpectedResults{
+                        SomeIpErrc::kLengthMismatch,
+                        SomeIpErrc::kUnknownMessageId,
+                        SomeIpErrc::kInvalidFlags,
+                        SomeIpErrc::kTruncatedEntries,
+                        SomeIpErrc::kUnsupportedEntry,
+                        SomeIpErrc::kTruncatedOptions,
+                        SomeIpErrc::kInvalidOption};
+
+                    SomeIpSdMessage _message;
+                    EXPECT_TRUE(SomeIpSdMessage::TryDeserialize(cPayload, _message).HasValue());
+                    EXPECT_EQ(1, _message.EntryRecords().size());
+
+                    const std::vector<uint8_t> cTruncatedPayload(
+                        cPayload.begin(), cPayload.begin() + 4);
+                    auto _result{SomeIpSdMessage::TryDeserialize(cTruncatedPayload, _message)};
+                    ASSERT_FALSE(_result.HasValue());
+                    EXPECT_EQ(
+                        SomeIpErrc::kTruncatedHeader,
+                        static_cast<SomeIpErrc>(_result.Error().Value()));
+
+                    for (std::size_t i = 0; i < cViolations.size(); ++i)
+                    {
+                        auto _payload = cPayload;
+                        _payload.at(cViolations.at(i).first) = cViolations.at(i).second;
+
+                        SomeIpSdMessage _malformedMessage;
+                        auto _malformedResult{
+                            SomeIpSdMessage::TryDeserialize(_payload, _malformedMessage)};
+                        ASSERT_FALSE(_malformedResult.HasValue());
+                        EXPECT_EQ(
+                            cExpectedResults.at(i),
+                            static_cast<SomeIpErrc>(_malformedResult.Error().Value()));
+                    }
+                }
+
                 TEST(SomeIpSdMessageTest, Deserializing)
                 {
                     const uint16_t cServiceId = 0x0001;
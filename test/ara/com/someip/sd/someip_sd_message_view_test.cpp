@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_message_view.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/entry/eventgroup_entry.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                TEST(SomeIpSdMessageViewTest, NoEntryMessage)
+                {
+                    const std::size_t cExpectedEntryCount = 0;
+                    const uint32_t cExpectedOptionsLength = 0;
+
+                    SomeIpSdMessage _message;
+                    auto _payload = _message.Payload();
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_TRUE(_view.IsValid());
+                    EXPECT_TRUE(_view.Rebooted());
+                    EXPECT_TRUE(_view.UnicastSupported());
+                    EXPECT_EQ(_view.EntryCount(), cExpectedEntryCount);
+                    EXPECT_EQ(_view.OptionsLength(), cExpectedOptionsLength);
+                }
+
+                TEST(SomeIpSdMessageViewTest, EntriesAndOptions)
+                {
+                    const std::size_t cExpectedEntryCount = 2;
+                    const uint32_t cExpectedEntriesLength = 32;
+                    const uint32_t cExpectedOptionsLength = 12;
+
+                    auto _offerEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 1, 1, 0);
+                    auto _endpointOption =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _offerEntry->AddFirstOption(std::move(_endpointOption));
+                    auto _findEntry = entry::ServiceEntry::CreateFindServiceEntry(2);
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_offerEntry));
+                    _message.AddEntry(std::move(_findEntry));
+                    auto _payload = _message.Payload();
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_TRUE(_view.IsValid());
+                    EXPECT_EQ(_view.SessionId(), _message.SessionId());
+                    EXPECT_EQ(_view.EntryCount(), cExpectedEntryCount);
+                    EXPECT_EQ(_view.EntriesLength(), cExpectedEntriesLength);
+                    EXPECT_EQ(_view.OptionsLength(), cExpectedOptionsLength);
+                }
+
+                TEST(SomeIpSdMessageViewTest, NotRebootedFlag)
+                {
+                    const uint16_t cLastSessionId = 255;
+
+                    SomeIpSdMessage _message;
+                    _message.SetSessionId(cLastSessionId);
+                    // Wrapping the session ID resets the reboot flag
+                    _message.IncrementSessionId();
+                    auto _payload = _message.Payload();
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_TRUE(_view.IsValid());
+                    EXPECT_FALSE(_view.Rebooted());
+                }
+
+                TEST(SomeIpSdMessageViewTest, InvalidMessageId)
+                {
+                    SomeIpSdMessage _message;
+                    auto _payload = _message.Payload();
+                    // Violate the SD message ID
+                    _payload.at(0) = 0x00;
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_FALSE(_view.IsValid());
+                }
+
+                TEST(SomeIpSdMessageViewTest, InvalidEntriesLength)
+                {
+                    const std::size_t cEntriesLengthOffset = 23;
+
+                    SomeIpSdMessage _message;
+                    auto _payload = _message.Payload();
+                    // Entries length which is not a multiple of the entry size
+                    _payload.at(cEntriesLengthOffset) = 0x01;
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_FALSE(_view.IsValid());
+                }
+
+                TEST(SomeIpSdMessageViewTest, InvalidOptionsLength)
+                {
+                    const std::size_t cOptionsLengthOffset = 27;
+
+                    SomeIpSdMessage _message;
+                    auto _payload = _message.Payload();
+                    // Options length which exceeds the message length
+                    _payload.at(cOptionsLengthOffset) = 0x0c;
+
+                    SomeIpSdMessageView _view(_payload);
+
+                    EXPECT_FALSE(_view.IsValid());
+                }
+
+                TEST(SomeIpSdMessageViewTest, FilteredEntries)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cOtherServiceId = 2;
+                    const uint16_t cEventgroupId = 3;
+                    const uint16_t cPort = 8080;
+
+                    auto _offerEntry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(cServiceId, 1, 1, 0);
+                    auto _endpointOption =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            cPort);
+                    _offerEntry->AddFirstOption(std::move(_endpointOption));
+                    auto _findEntry =
+                        entry::ServiceEntry::CreateFindServiceEntry(cOtherServiceId);
+                    auto _subscribeEntry =
+                        entry::EventgroupEntry::CreateSubscribeEventEntry(
+                            cServiceId, 1, 1, 0, cEventgroupId);
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_offerEntry));
+                    _message.AddEntry(std::move(_findEntry));
+                    _message.AddEntry(std::move(_subscribeEntry));
+                    auto _payload = _message.Payload();
+
+                    SomeIpSdMessageView _view(_payload);
+                    ASSERT_TRUE(_view.IsValid());
+
+                    std::size_t _allEntries = 0;
+                    for (const entry::EntryRecord &record : _view.Entries())
+                    {
+                        EXPECT_TRUE(record.IsServiceEntry() || record.IsEventgroupEntry());
+                        ++_allEntries;
+                    }
+                    EXPECT_EQ(3, _allEntries);
+
+                    std::size_t _serviceEntries = 0;
+                    for (const entry::EntryRecord &record :
+                         _view.Entries(SomeIpSdMessageView::EntryFilter(cServiceId)))
+                    {
+                        EXPECT_EQ(cServiceId, record.ServiceId);
+                        ++_serviceEntries;
+                    }
+                    EXPECT_EQ(2, _serviceEntries);
+
+                    SomeIpSdMessageView::EntryFilter _subscriptionFilter(
+                        {entry::EntryType::Subscribing}, cServiceId);
+                    auto _subscriptions = _view.Entries(_subscriptionFilter);
+                    auto _itr = _subscriptions.begin();
+                    ASSERT_NE(_subscriptions.end(), _itr);
+                    EXPECT_EQ(cEventgroupId, _itr->Eventgroup.EventgroupId);
+                    EXPECT_EQ(_subscriptions.end(), ++_itr);
+
+                    SomeIpSdMessageView::EntryFilter _offerFilter(
+                        {entry::EntryType::Offering}, cServiceId);
+                    auto _offers = _view.Entries(_offerFilter);
+                    ASSERT_NE(_offers.end(), _offers.begin());
+                    const entry::EntryRecord cOffer = *_offers.begin();
+                    EXPECT_EQ(1, cOffer.FirstOptionCount);
+
+                    option::OptionRecord _option;
+                    ASSERT_TRUE(_view.TryGetOption(cOffer.FirstOptionIndex, _option));
+                    EXPECT_EQ(option::OptionType::IPv4Endpoint, _option.Type);
+                    EXPECT_EQ(cPort, _option.Ipv4Endpoint.Port);
+                    EXPECT_FALSE(_view.TryGetOption(cOffer.FirstOptionIndex + 1, _option));
+                }
+            }
+        }
+    }
+}
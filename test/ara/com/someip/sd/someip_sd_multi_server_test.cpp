@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_multi_server.h"
+#include "../../helper/mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                class SomeIpSdMultiServerTest : public testing::Test
+                {
+                protected:
+                    static const uint16_t cNumberOfServices = 20;
+                    static const uint16_t cInstanceId = 1;
+                    static const uint8_t cMajorVersion = 1;
+                    static const uint32_t cMinorVersion = 0;
+                    static const uint16_t cPort = 8080;
+                    static const int cRepetitionBaseDelay = 20;
+                    static const uint32_t cRepetitionMax = 2;
+
+                    const helper::Ipv4Address IpAddress;
+                    helper::MockupNetworkLayer<SomeIpSdMessage> NetworkLayer;
+                    std::mutex Mutex;
+                    std::vector<std::size_t> OfferMessages;
+                    std::size_t StopOffers;
+
+                    SomeIpSdMultiServerTest() : IpAddress(224, 0, 0, 0),
+                                                StopOffers{0}
+                    {
+                        NetworkLayer.SetReceiver(
+                            this,
+                            [this](std::shared_ptr<const SomeIpSdMessage> message)
+                            { onMessage(message); });
+                    }
+
+                    ~SomeIpSdMultiServerTest() override
+                    {
+                        NetworkLayer.ResetReceiver(this);
+                    }
+
+                    void onMessage(const std::shared_ptr<const SomeIpSdMessage> &message)
+                    {
+                        std::size_t _offers = 0;
+                        std::lock_guard<std::mutex> _lock(Mutex);
+
+                        for (const auto &_entry : message->EntryRecords())
+                        {
+                            if (_entry.Type == entry::EntryType::Offering)
+                            {
+                                if (_entry.TTL > 0)
+                                {
+                                    ++_offers;
+                                }
+                                else
+                                {
+                                    ++StopOffers;
+                                }
+                            }
+                        }
+
+                        if (_offers > 0)
+                        {
+                            OfferMessages.push_back(_offers);
+                        }
+                    }
+
+                    std::size_t GetOfferMessages()
+                    {
+                        std::lock_guard<std::mutex> _lock(Mutex);
+                        return OfferMessages.size();
+                    }
+
+                    bool WaitForOfferMessages(std::size_t expected)
+                    {
+                        const int cMaxPolls = 100;
+                        const std::chrono::milliseconds cPollDelay(10);
+
+                        for (int i = 0; i < cMaxPolls; ++i)
+                        {
+                            if (GetOfferMessages() >= expected)
+                            {
+                                return true;
+                            }
+
+                            std::this_thread::sleep_for(cPollDelay);
+                        }
+
+                        return false;
+                    }
+
+                    void SendFind(uint16_t serviceId)
+                    {
+                        SomeIpSdMessage _message;
+                        _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(serviceId));
+                        NetworkLayer.Send(_message);
+                    }
+                };
+
+                const uint16_t SomeIpSdMultiServerTest::cNumberOfServices;
+                const uint16_t SomeIpSdMultiServerTest::cInstanceId;
+                const uint8_t SomeIpSdMultiServerTest::cMajorVersion;
+                const uint32_t SomeIpSdMultiServerTest::cMinorVersion;
+                const uint16_t SomeIpSdMultiServerTest::cPort;
+                const int SomeIpSdMultiServerTest::cRepetitionBaseDelay;
+                const uint32_t SomeIpSdMultiServerTest::cRepetitionMax;
+
+                TEST_F(SomeIpSdMultiServerTest, Constructor)
+                {
+                    EXPECT_THROW(
+                        SomeIpSdMultiServer(&NetworkLayer, 10, 0, cRepetitionBaseDelay, 100, cRepetitionMax),
+                        std::invalid_argument);
+                    EXPECT_THROW(
+                        SomeIpSdMultiServer(&NetworkLayer, 0, 0, cRepetitionBaseDelay, 0, cRepetitionMax),
+                        std::invalid_argument);
+                    EXPECT_THROW(
+                        SomeIpSdMultiServer(&NetworkLayer, 0, 0, cRepetitionBaseDelay, 100, 33),
+                        std::invalid_argument);
+                    EXPECT_THROW(
+                        SomeIpSdMultiServer(&NetworkLayer, 0, 0, cRepetitionBaseDelay, 100, 31),
+                        std::invalid_argument);
+
+                    SomeIpSdMultiServer _server(&NetworkLayer, 0, 0, cRepetitionBaseDelay, 100, cRepetitionMax);
+                    _server.AddService(1, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                    EXPECT_THROW(
+                        _server.AddService(1, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort),
+                        std::invalid_argument);
+                }
+
+                TEST_F(SomeIpSdMultiServerTest, CoalescedOffers)
+                {
+                    const int cCycleOfferDelay = 50;
+                    // Initial, repetitions, and at least a cyclic offer
+                    const std::size_t cExpectedMessages = 1 + cRepetitionMax + 1;
+
+                    SomeIpSdMultiServer _server(
+                        &NetworkLayer, 0, 0, cRepetitionBaseDelay, cCycleOfferDelay, cRepetitionMax);
+
+                    for (uint16_t _serviceId = 1; _serviceId <= cNumberOfServices; ++_serviceId)
+                    {
+                        _server.AddService(
+                            _serviceId, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                        EXPECT_EQ(helper::SdServerState::NotReady, _server.GetState(_serviceId, cInstanceId));
+                    }
+
+                    _server.Start();
+                    ASSERT_TRUE(WaitForOfferMessages(cExpectedMessages));
+                    EXPECT_EQ(helper::SdServerState::MainPhase, _server.GetState(1, cInstanceId));
+                    _server.Stop();
+
+                    // Every message carries the offers of all the services.
+                    std::lock_guard<std::mutex> _lock(Mutex);
+                    for (std::size_t _offers : OfferMessages)
+                    {
+                        EXPECT_EQ(static_cast<std::size_t>(cNumberOfServices), _offers);
+                    }
+
+                    // The stop offers are coalesced as well.
+                    EXPECT_EQ(static_cast<std::size_t>(cNumberOfServices), StopOffers);
+                    EXPECT_EQ(OfferMessages.size() + 1, _server.SentMessages());
+                    EXPECT_EQ(_server.SentMessages() * cNumberOfServices, _server.SentEntries());
+                }
+
+                TEST_F(SomeIpSdMultiServerTest, FindResponse)
+                {
+                    const int cCycleOfferDelay = 10000;
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cOtherServiceId = 2;
+
+                    SomeIpSdMultiServer _server(&NetworkLayer, 0, 0, cRepetitionBaseDelay, cCycleOfferDelay, 0);
+                    _server.AddService(cServiceId, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                    _server.Start();
+                    ASSERT_TRUE(WaitForOfferMessages(1));
+
+                    // Only the finding of an offered service is answered before the next cycle.
+                    SendFind(cOtherServiceId);
+                    SendFind(cServiceId);
+                    EXPECT_TRUE(WaitForOfferMessages(2));
+                    EXPECT_EQ(2, GetOfferMessages());
+                }
+
+                TEST_F(SomeIpSdMultiServerTest, DispatchedFindResponse)
+                {
+                    const int cCycleOfferDelay = 10000;
+                    const uint16_t cServiceId = 1;
+
+                    SomeIpSdDispatcher _dispatcher(&NetworkLayer);
+                    SomeIpSdMultiServer _server(&_dispatcher, 0, 0, cRepetitionBaseDelay, cCycleOfferDelay, 0);
+                    _server.Start();
+                    _server.AddService(cServiceId, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                    ASSERT_TRUE(WaitForOfferMessages(1));
+
+                    SendFind(cServiceId);
+                    EXPECT_TRUE(WaitForOfferMessages(2));
+                }
+
+                TEST_F(SomeIpSdMultiServerTest, RemoveService)
+                {
+                    const int cCycleOfferDelay = 10000;
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cOtherServiceId = 2;
+
+                    SomeIpSdMultiServer _server(&NetworkLayer, 0, 0, cRepetitionBaseDelay, cCycleOfferDelay, 0);
+                    _server.AddService(cServiceId, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                    _server.AddService(cOtherServiceId, cInstanceId, cMajorVersion, cMinorVersion, IpAddress, cPort);
+                    _server.Start();
+                    ASSERT_TRUE(WaitForOfferMessages(1));
+
+                    _server.RemoveService(cServiceId, cInstanceId);
+                    EXPECT_EQ(helper::SdServerState::NotReady, _server.GetState(cServiceId, cInstanceId));
+
+                    // Flush the pending stop offer with the find answer of the other service.
+                    SendFind(cOtherServiceId);
+                    ASSERT_TRUE(WaitForOfferMessages(2));
+
+                    std::lock_guard<std::mutex> _lock(Mutex);
+                    EXPECT_EQ(1, StopOffers);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_packetizer.h"
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                static std::unique_ptr<entry::Entry> createOffer(uint16_t serviceId)
+                {
+                    const uint16_t cInstanceId = 1;
+                    const uint8_t cMajorVersion = 1;
+                    const uint32_t cMinorVersion = 0;
+                    const helper::Ipv4Address cIpAddress(192, 168, 0, 1);
+
+                    auto _entry{
+                        entry::ServiceEntry::CreateOfferServiceEntry(
+                            serviceId, cInstanceId, cMajorVersion, cMinorVersion)};
+                    // The port identifies the entry option.
+                    _entry->AddFirstOption(
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false, cIpAddress, option::Layer4ProtocolType::Tcp, serviceId));
+
+                    return _entry;
+                }
+
+                TEST(SomeIpSdPacketizerTest, Constructor)
+                {
+                    const std::size_t cTooSmallSize = 40;
+
+                    EXPECT_THROW(SomeIpSdPacketizer{cTooSmallSize}, std::invalid_argument);
+
+                    SomeIpSdPacketizer _packetizer(SomeIpSdPacketizer::cEmptyMessageSize + entry::Entry::cEntrySize);
+                    // The entry option does not fit anymore.
+                    EXPECT_THROW(_packetizer.Add(createOffer(1)), std::invalid_argument);
+                    _packetizer.Add(entry::ServiceEntry::CreateFindServiceEntry(1));
+                    EXPECT_EQ(1, _packetizer.Pending());
+                }
+
+                TEST(SomeIpSdPacketizerTest, MtuPacking)
+                {
+                    const std::size_t cMaxMessageSize = 1400;
+                    const uint16_t cNumberOfEntries = 100;
+                    // 28 bytes per entry with its endpoint option
+                    const std::size_t cEntriesPerMessage = (cMaxMessageSize - 28) / 28;
+                    const std::size_t cExpectedMessages =
+                        (cNumberOfEntries + cEntriesPerMessage - 1) / cEntriesPerMessage;
+
+                    SomeIpSdPacketizer _packetizer(cMaxMessageSize);
+                    for (uint16_t _serviceId = 1; _serviceId <= cNumberOfEntries; ++_serviceId)
+                    {
+                        _packetizer.Add(createOffer(_serviceId));
+                    }
+
+                    uint16_t _expectedServiceId = 1;
+                    std::size_t _messages =
+                        _packetizer.Flush(
+                            [&](SomeIpSdMessage &message)
+                            {
+                                const std::vector<uint8_t> cPayload{message.Payload()};
+                                EXPECT_LE(cPayload.size(), cMaxMessageSize);
+
+                                SomeIpSdMessage _received;
+                                ASSERT_TRUE(SomeIpSdMessage::TryDeserialize(cPayload, _received).HasValue());
+
+                                // Each entry references its own option within the datagram.
+                                const auto &_options = _received.OptionRecords();
+                                for (const auto &_entry : _received.EntryRecords())
+                                {
+                                    EXPECT_EQ(_expectedServiceId, _entry.ServiceId);
+                                    ASSERT_EQ(1, _entry.FirstOptionCount);
+                                    ASSERT_LT(_entry.FirstOptionIndex, _options.size());
+                                    EXPECT_EQ(
+                                        _expectedServiceId,
+                                        _options[_entry.FirstOptionIndex].Ipv4Endpoint.Port);
+                                    ++_expectedServiceId;
+                                }
+                            });
+
+                    EXPECT_EQ(cExpectedMessages, _messages);
+                    EXPECT_EQ(cNumberOfEntries + 1, _expectedServiceId);
+                    EXPECT_EQ(0, _packetizer.Pending());
+                }
+
+                TEST(SomeIpSdPacketizerTest, SmallMessagesFilling)
+                {
+                    const uint16_t cNumberOfEntries = 10;
+
+                    SomeIpSdPacketizer _packetizer;
+                    for (uint16_t _serviceId = 1; _serviceId <= cNumberOfEntries; ++_serviceId)
+                    {
+                        _packetizer.Add(entry::ServiceEntry::CreateFindServiceEntry(_serviceId));
+                    }
+
+                    std::size_t _entries = 0;
+                    std::size_t _messages =
+                        _packetizer.Flush(
+                            [&](SomeIpSdMessage &message)
+                            { _entries += message.Entries().size(); });
+
+                    EXPECT_EQ(1, _messages);
+                    EXPECT_EQ(cNumberOfEntries, _entries);
+                }
+            }
+        }
+    }
+}
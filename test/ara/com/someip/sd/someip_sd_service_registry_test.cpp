@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_service_registry.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_client.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+#include "../../helper/mockup_network_layer.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                static SomeIpSdMessage createOffer(
+                    uint16_t serviceId,
+                    uint16_t instanceId,
+                    uint32_t ttl,
+                    uint16_t port)
+                {
+                    const uint8_t cMajorVersion = 1;
+                    const uint32_t cMinorVersion = 0;
+
+                    auto _entry{
+                        entry::ServiceEntry::CreateOfferServiceEntry(
+                            serviceId, instanceId, cMajorVersion, cMinorVersion, ttl)};
+                    _entry->AddFirstOption(
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            port));
+
+                    SomeIpSdMessage _result;
+                    _result.AddEntry(std::move(_entry));
+
+                    return _result;
+                }
+
+                TEST(SomeIpSdServiceRegistryTest, FindService)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cPort = 8080;
+
+                    SomeIpSdServiceRegistry _registry;
+                    ServiceInstance _instance;
+                    EXPECT_FALSE(_registry.TryFind(cServiceId, _instance));
+
+                    _registry.Update(createOffer(cServiceId, 2, SomeIpSdServiceRegistry::cInfiniteTtl, cPort));
+                    _registry.Update(createOffer(cServiceId, 1, SomeIpSdServiceRegistry::cInfiniteTtl, cPort + 1));
+                    _registry.Update(createOffer(cServiceId + 1, 1, SomeIpSdServiceRegistry::cInfiniteTtl, cPort));
+
+                    ASSERT_TRUE(_registry.TryFind(cServiceId, _instance, 2));
+                    EXPECT_EQ(cServiceId, _instance.ServiceId);
+                    EXPECT_EQ(2, _instance.InstanceId);
+                    EXPECT_EQ(SomeIpSdServiceRegistry::cInfiniteTtl, _instance.TTL);
+                    ASSERT_TRUE(_instance.HasEndpoint);
+                    EXPECT_EQ(cPort, _instance.Endpoint.Ipv4Endpoint.Port);
+
+                    const uint8_t cUnknownMajorVersion = 2;
+                    EXPECT_FALSE(_registry.TryFind(cServiceId, _instance, 2, cUnknownMajorVersion));
+
+                    auto _instances{_registry.FindService(cServiceId)};
+                    ASSERT_EQ(2, _instances.size());
+                    EXPECT_EQ(1, _instances[0].InstanceId);
+                    EXPECT_EQ(2, _instances[1].InstanceId);
+                }
+
+                TEST(SomeIpSdServiceRegistryTest, StopOffer)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cInstanceId = 1;
+                    const uint16_t cPort = 8080;
+
+                    SomeIpSdServiceRegistry _registry;
+                    _registry.Update(createOffer(cServiceId, cInstanceId, SomeIpSdServiceRegistry::cInfiniteTtl, cPort));
+
+                    const uint8_t cMajorVersion = 1;
+                    const uint32_t cMinorVersion = 0;
+                    SomeIpSdMessage _stopOfferMessage;
+                    _stopOfferMessage.AddEntry(
+                        entry::ServiceEntry::CreateStopOfferEntry(
+                            cServiceId, cInstanceId, cMajorVersion, cMinorVersion));
+                    _registry.Update(_stopOfferMessage);
+
+                    ServiceInstance _instance;
+                    EXPECT_FALSE(_registry.TryFind(cServiceId, _instance));
+                    EXPECT_EQ(0, _registry.Purge());
+                }
+
+                TEST(SomeIpSdServiceRegistryTest, TtlExpiration)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cPort = 8080;
+                    const uint32_t cTtl = 1;
+                    const std::chrono::milliseconds cExpirationDelay(1100);
+
+                    SomeIpSdServiceRegistry _registry;
+                    _registry.Update(createOffer(cServiceId, 1, cTtl, cPort));
+                    _registry.Update(createOffer(cServiceId, 2, SomeIpSdServiceRegistry::cInfiniteTtl, cPort));
+
+                    ServiceInstance _instance;
+                    ASSERT_TRUE(_registry.TryFind(cServiceId, _instance, 1));
+                    EXPECT_EQ(cTtl, _instance.TTL);
+
+                    std::this_thread::sleep_for(cExpirationDelay);
+
+                    EXPECT_FALSE(_registry.TryFind(cServiceId, _instance, 1));
+                    EXPECT_EQ(1, _registry.Purge());
+                }
+
+                TEST(SomeIpSdServiceRegistryTest, CachedClientStart)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cPort = 8080;
+                    // Long enough find phases to tell a cached answer apart
+                    const int cInitialDelay = 2000;
+                    const int cRepetitionBaseDelay = 2000;
+                    const uint32_t cRepetitionMax = 2;
+                    const int cWaitDuration = 1000;
+
+                    helper::MockupNetworkLayer<SomeIpSdMessage> _networkLayer;
+                    SomeIpSdServiceRegistry _registry(&_networkLayer);
+                    // The offer is received before the client exists.
+                    _networkLayer.Send(createOffer(cServiceId, 1, SomeIpSdServiceRegistry::cInfiniteTtl, cPort));
+
+                    SomeIpSdClient _client(
+                        &_networkLayer,
+                        cServiceId,
+                        cInitialDelay,
+                        cInitialDelay,
+                        cRepetitionBaseDelay,
+                        cRepetitionMax,
+                        &_registry);
+
+                    const auto cStartTime{std::chrono::steady_clock::now()};
+                    _client.Start();
+                    EXPECT_TRUE(_client.TryWaitUntiServiceOffered(cWaitDuration));
+                    const auto cElapsed{std::chrono::steady_clock::now() - cStartTime};
+
+                    EXPECT_EQ(helper::SdClientState::ServiceReady, _client.GetState());
+                    EXPECT_LT(cElapsed, std::chrono::milliseconds(cWaitDuration));
+                }
+
+                TEST(SomeIpSdServiceRegistryTest, SharedRegistry)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cInstanceId = 1;
+                    const uint16_t cPort = 8080;
+                    const uint8_t cMajorVersion = 1;
+                    const uint32_t cMinorVersion = 0;
+
+                    helper::MockupNetworkLayer<SomeIpSdMessage> _networkLayer;
+                    auto _registry{SomeIpSdServiceRegistry::Shared(&_networkLayer)};
+                    EXPECT_EQ(_registry, SomeIpSdServiceRegistry::Shared(&_networkLayer));
+
+                    // The offer and the find entries are fed via the raw payload, and only the offer is cached.
+                    SomeIpSdMessage _message{
+                        createOffer(cServiceId, cInstanceId, SomeIpSdServiceRegistry::cInfiniteTtl, cPort)};
+                    _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(cServiceId + 1));
+                    _networkLayer.Send(_message);
+
+                    ServiceInstance _instance;
+                    ASSERT_TRUE(_registry->TryFind(cServiceId, _instance));
+                    ASSERT_TRUE(_instance.HasEndpoint);
+                    EXPECT_EQ(cPort, _instance.Endpoint.Ipv4Endpoint.Port);
+                    EXPECT_EQ(1, _registry->Purge());
+
+                    SomeIpSdMessage _stopOfferMessage;
+                    _stopOfferMessage.AddEntry(
+                        entry::ServiceEntry::CreateStopOfferEntry(
+                            cServiceId, cInstanceId, cMajorVersion, cMinorVersion));
+                    _networkLayer.Send(_stopOfferMessage);
+                    EXPECT_FALSE(_registry->TryFind(cServiceId, _instance));
+
+                    // Releasing the last user drops the registry, so the next user gets an empty one.
+                    _networkLayer.Send(_message);
+                    _registry.reset();
+                    _registry = SomeIpSdServiceRegistry::Shared(&_networkLayer);
+                    EXPECT_EQ(0, _registry->Purge());
+                }
+            }
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <thread>
 #include "../../../../../src/ara/com/someip/sd/someip_sd_server.h"
 #include "../../../../../src/ara/com/someip/sd/someip_sd_client.h"
 #include "../../helper/mockup_network_layer.h"
@@ -143,6 +144,67 @@ namespace ara
 
                     EXPECT_EQ(Client.GetState(), cServiceNotSeen);
                 }
+
+                TEST(SomeIpSdServerTest, ImmediateFindAnswer)
+                {
+                    const uint16_t cServiceId = 1;
+                    const uint16_t cInstanceId = 1;
+                    const uint8_t cMajorVersion = 1;
+                    const uint32_t cMinorVersion = 0;
+                    const uint16_t cPort = 8080;
+                    const int cInitialDelay = 10;
+                    const int cRepetitionBaseDelay = 10;
+                    const int cCycleOfferDelay = 1000;
+                    const uint32_t cRepetitionMax = 1;
+                    const std::chrono::seconds cTimeout{1};
+
+                    helper::MockupNetworkLayer<SomeIpSdMessage> _networkLayer;
+                    SomeIpSdServer _server(
+                        &_networkLayer,
+                        cServiceId,
+                        cInstanceId,
+                        cMajorVersion,
+                        cMinorVersion,
+                        helper::Ipv4Address(127, 0, 0, 1),
+                        cPort,
+                        cInitialDelay,
+                        cInitialDelay,
+                        cRepetitionBaseDelay,
+                        cCycleOfferDelay,
+                        cRepetitionMax);
+
+                    _server.Start();
+                    const auto cDeadline{std::chrono::steady_clock::now() + cTimeout};
+                    while (_server.GetState() != helper::SdServerState::MainPhase &&
+                           std::chrono::steady_clock::now() < cDeadline)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    ASSERT_EQ(helper::SdServerState::MainPhase, _server.GetState());
+
+                    int _offers = 0;
+                    _networkLayer.SetReceiver(
+                        &_offers,
+                        [&_offers](std::shared_ptr<const SomeIpSdMessage> message)
+                        {
+                            for (const auto &_entry : message->EntryRecords())
+                            {
+                                if (_entry.Type == entry::EntryType::Offering)
+                                {
+                                    ++_offers;
+                                }
+                            }
+                        });
+
+                    // In the main phase, the offer is sent before the find sending returns
+                    // rather than at the next offer cycle.
+                    SomeIpSdMessage _findMessage;
+                    _findMessage.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(cServiceId));
+                    _networkLayer.Send(_findMessage);
+                    EXPECT_EQ(1, _offers);
+
+                    _networkLayer.ResetReceiver(&_offers);
+                }
             }
         }
     }
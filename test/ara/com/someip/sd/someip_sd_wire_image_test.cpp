@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/someip_sd_wire_image.h"
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                TEST(SomeIpSdWireImageTest, Constructor)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+                    auto _option =
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false,
+                            helper::Ipv4Address(127, 0, 0, 1),
+                            option::Layer4ProtocolType::Tcp,
+                            8080);
+                    _entry->AddFirstOption(std::move(_option));
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_entry));
+
+                    SomeIpSdWireImage _image(_message);
+                    EXPECT_EQ(_message.Payload(), _image.Payload());
+                }
+
+                TEST(SomeIpSdWireImageTest, RefreshMethod)
+                {
+                    auto _entry =
+                        entry::ServiceEntry::CreateOfferServiceEntry(1, 2, 3, 4);
+
+                    SomeIpSdMessage _message;
+                    _message.AddEntry(std::move(_entry));
+
+                    SomeIpSdWireImage _image(_message);
+                    const uint8_t *cBufferData = _image.Payload().data();
+
+                    _message.IncrementSessionId();
+                    _image.Refresh(_message);
+                    EXPECT_EQ(_message.Payload(), _image.Payload());
+
+                    // Wrap the session ID to clear the reboot flag
+                    while (!_message.IncrementSessionId())
+                    {
+                    }
+                    EXPECT_FALSE(_message.Rebooted());
+
+                    _image.Refresh(_message);
+                    EXPECT_EQ(_message.Payload(), _image.Payload());
+
+                    // The patching should happen in place.
+                    EXPECT_EQ(cBufferData, _image.Payload().data());
+                }
+            }
+        }
+    }
+}
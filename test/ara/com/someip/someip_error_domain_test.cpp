@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/someip_error_domain.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            TEST(SomeIpErrorDomainTest, NameProperty)
+            {
+                EXPECT_STRNE(SomeIpErrorDomain::Instance().Name(), "");
+            }
+
+            TEST(SomeIpErrorDomainTest, MakeErrorCodeMethod)
+            {
+                const SomeIpErrc cExpectedResult{SomeIpErrc::kInvalidFlags};
+
+                core::ErrorCode _errorCode{SomeIpErrorDomain::MakeErrorCode(cExpectedResult)};
+                auto _actualResult{static_cast<SomeIpErrc>(_errorCode.Value())};
+
+                EXPECT_EQ(cExpectedResult, _actualResult);
+                EXPECT_TRUE(_errorCode.Domain() == SomeIpErrorDomain::Instance());
+                EXPECT_STRNE(_errorCode.Message().c_str(), "Unsupported error code");
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/someip_event_message.h"
+#include "../../../../src/ara/com/someip/someip_message_view.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            TEST(SomeIpEventMessageTest, Constructor)
+            {
+                const uint16_t cServiceId = 0x1234;
+                const uint16_t cEventId = 0x8001;
+                const uint16_t cMethodId = 0x0001;
+                const uint8_t cInterfaceVersion = 1;
+
+                SomeIpEventMessage _message(cServiceId, cEventId, cInterfaceVersion);
+
+                EXPECT_EQ(cServiceId, _message.ServiceId());
+                EXPECT_EQ(cEventId, _message.EventId());
+                EXPECT_EQ(SomeIpMessageType::Notification, _message.MessageType());
+                EXPECT_TRUE(_message.Data().empty());
+
+                EXPECT_THROW(
+                    SomeIpEventMessage(cServiceId, cMethodId, cInterfaceVersion),
+                    std::invalid_argument);
+            }
+
+            TEST(SomeIpEventMessageTest, Serialization)
+            {
+                const std::vector<uint8_t> cData{0x01, 0x02, 0x03};
+                const std::vector<uint8_t> cShorterData{0x04};
+
+                SomeIpEventMessage _message(0x1234, 0x8001, 1);
+                _message.SetData(cData);
+
+                std::vector<uint8_t> _datagram;
+                _message.Serialize(_datagram);
+                _message.IncrementSessionId();
+                _message.SetData(cShorterData);
+                _message.Serialize(_datagram);
+
+                SomeIpMessageView _firstView(_datagram);
+                ASSERT_TRUE(_firstView.IsValid());
+                EXPECT_EQ(SomeIpEventMessage(0x1234, 0x8001, 1).Size() + cData.size(), _firstView.Size());
+                EXPECT_EQ(_message.MessageId(), _firstView.MessageId());
+                EXPECT_TRUE(
+                    std::equal(
+                        cData.begin(),
+                        cData.end(),
+                        _firstView.Data() + _firstView.Size() - cData.size()));
+
+                // The second message is packed right after the first one.
+                SomeIpMessageView _secondView(
+                    _datagram.data() + _firstView.Size(), _datagram.size() - _firstView.Size());
+                ASSERT_TRUE(_secondView.IsValid());
+                EXPECT_EQ(_message.SessionId(), _secondView.SessionId());
+                EXPECT_EQ(_message.Size(), _secondView.Size());
+                EXPECT_EQ(_datagram.size(), _firstView.Size() + _secondView.Size());
+            }
+        }
+    }
+}
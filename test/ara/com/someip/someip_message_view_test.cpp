@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/someip_message_view.h"
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            TEST(SomeIpMessageViewTest, HeaderFields)
+            {
+                const uint16_t cSessionId = 0x0002;
+
+                sd::SomeIpSdMessage _message;
+                _message.SetSessionId(cSessionId);
+                auto _payload = _message.Payload();
+
+                SomeIpMessageView _view(_payload);
+
+                EXPECT_TRUE(_view.IsValid());
+                EXPECT_EQ(_view.Size(), _payload.size());
+                EXPECT_EQ(_view.MessageId(), _message.MessageId());
+                EXPECT_EQ(_view.Length(), _message.Length());
+                EXPECT_EQ(_view.ClientId(), _message.ClientId());
+                EXPECT_EQ(_view.SessionId(), _message.SessionId());
+                EXPECT_EQ(_view.ProtocolVersion(), _message.ProtocolVersion());
+                EXPECT_EQ(_view.InterfaceVersion(), _message.InterfaceVersion());
+                EXPECT_EQ(_view.MessageType(), _message.MessageType());
+                EXPECT_EQ(_view.ReturnCode(), _message.ReturnCode());
+            }
+
+            TEST(SomeIpMessageViewTest, TruncatedHeader)
+            {
+                const std::size_t cTruncatedSize = 15;
+
+                sd::SomeIpSdMessage _message;
+                auto _payload = _message.Payload();
+
+                SomeIpMessageView _view(_payload.data(), cTruncatedSize);
+
+                EXPECT_FALSE(_view.IsValid());
+                EXPECT_EQ(_view.Size(), 0);
+            }
+
+            TEST(SomeIpMessageViewTest, LengthFieldMismatch)
+            {
+                sd::SomeIpSdMessage _message;
+                auto _payload = _message.Payload();
+                // Drop the last byte, so the length field exceeds the received bytes
+                _payload.pop_back();
+
+                SomeIpMessageView _view(_payload);
+
+                EXPECT_FALSE(_view.IsValid());
+            }
+
+            TEST(SomeIpMessageViewTest, TrailingMessage)
+            {
+                sd::SomeIpSdMessage _message;
+                auto _payload = _message.Payload();
+                const std::size_t cExpectedSize = _payload.size();
+                // Append another message to the range
+                auto _trailingPayload = _message.Payload();
+                _payload.insert(
+                    _payload.end(), _trailingPayload.begin(), _trailingPayload.end());
+
+                SomeIpMessageView _view(_payload);
+
+                EXPECT_TRUE(_view.IsValid());
+                EXPECT_EQ(_view.Size(), cExpectedSize);
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/someip_stream_framer.h"
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            class SomeIpStreamFramerTest : public testing::Test
+            {
+            protected:
+                std::vector<uint8_t> Message;
+                std::vector<std::vector<uint8_t>> FramedMessages;
+
+                SomeIpStreamFramerTest()
+                {
+                    sd::SomeIpSdMessage _message;
+                    _message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                    Message = _message.Payload();
+                }
+
+                void Feed(SomeIpStreamFramer &framer, const std::vector<uint8_t> &stream)
+                {
+                    framer.Feed(
+                        stream.data(),
+                        stream.size(),
+                        [this](const uint8_t *data, std::size_t size)
+                        { FramedMessages.emplace_back(data, data + size); });
+                }
+            };
+
+            TEST_F(SomeIpStreamFramerTest, SplitStream)
+            {
+                const std::size_t cNumberOfMessages = 3;
+
+                std::vector<uint8_t> _stream;
+                for (std::size_t i = 0; i < cNumberOfMessages; ++i)
+                {
+                    _stream.insert(_stream.end(), Message.begin(), Message.end());
+                }
+
+                // Feed the stream byte by byte to cross all the message boundaries
+                SomeIpStreamFramer _framer(false);
+                for (auto _byte : _stream)
+                {
+                    Feed(_framer, {_byte});
+                }
+
+                ASSERT_EQ(cNumberOfMessages, FramedMessages.size());
+                for (const auto &_framedMessage : FramedMessages)
+                {
+                    EXPECT_EQ(Message, _framedMessage);
+                }
+                EXPECT_EQ(0, _framer.DiscardedBytes());
+            }
+
+            TEST_F(SomeIpStreamFramerTest, MagicCookieSkipping)
+            {
+                std::vector<uint8_t> _stream{
+                    SomeIpStreamFramer::CreateMagicCookie(MagicCookieType::Client)};
+                _stream.insert(_stream.end(), Message.begin(), Message.end());
+
+                SomeIpStreamFramer _framer(true);
+                Feed(_framer, _stream);
+
+                ASSERT_EQ(1, FramedMessages.size());
+                EXPECT_EQ(Message, FramedMessages.front());
+            }
+
+            TEST_F(SomeIpStreamFramerTest, Resynchronization)
+            {
+                // The zero length field makes the garbage an invalid header.
+                const std::vector<uint8_t> cGarbage(20, 0x00);
+
+                std::vector<uint8_t> _stream{cGarbage};
+                const auto cMagicCookie{
+                    SomeIpStreamFramer::CreateMagicCookie(MagicCookieType::Server)};
+                _stream.insert(_stream.end(), cMagicCookie.begin(), cMagicCookie.end());
+                _stream.insert(_stream.end(), Message.begin(), Message.end());
+
+                SomeIpStreamFramer _framer(true);
+                Feed(_framer, _stream);
+
+                ASSERT_EQ(1, FramedMessages.size());
+                EXPECT_EQ(Message, FramedMessages.front());
+                EXPECT_EQ(cGarbage.size(), _framer.DiscardedBytes());
+                EXPECT_TRUE(_framer.IsSynchronized());
+            }
+
+            TEST_F(SomeIpStreamFramerTest, DesynchronizationWithoutCookies)
+            {
+                const std::vector<uint8_t> cGarbage(20, 0x00);
+
+                std::vector<uint8_t> _stream{cGarbage};
+                _stream.insert(_stream.end(), Message.begin(), Message.end());
+
+                SomeIpStreamFramer _framer(false);
+                Feed(_framer, _stream);
+
+                EXPECT_TRUE(FramedMessages.empty());
+                EXPECT_EQ(_stream.size(), _framer.DiscardedBytes());
+                EXPECT_FALSE(_framer.IsSynchronized());
+            }
+
+            TEST(SomeIpStreamFramerCookieTest, CreateMagicCookie)
+            {
+                EXPECT_TRUE(SomeIpStreamFramer::CreateMagicCookie(MagicCookieType::None).empty());
+                EXPECT_EQ(
+                    SomeIpStreamFramer::cMagicCookieSize,
+                    SomeIpStreamFramer::CreateMagicCookie(MagicCookieType::Client).size());
+            }
+        }
+    }
+}
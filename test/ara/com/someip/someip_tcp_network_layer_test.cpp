@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "../../../../src/ara/com/someip/someip_tcp_network_layer.h"
+#include "../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../src/ara/com/entry/service_entry.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            class SomeIpTcpNetworkLayerTest : public testing::Test
+            {
+            private:
+                static const int cPollTimeout = 100;
+
+            protected:
+                using TcpLayer = SomeIpTcpNetworkLayer<sd::SomeIpSdMessage>;
+
+                helper::EpollPoller Poller;
+                helper::TcpListener Listener;
+                std::unique_ptr<helper::TcpSocket> ClientSocket;
+                std::unique_ptr<helper::TcpSocket> ServerSocket;
+                std::size_t ReceivedMessages;
+                sd::SomeIpSdMessage Message;
+
+                SomeIpTcpNetworkLayerTest() : Listener(helper::Ipv4Address(127, 0, 0, 1), 0),
+                                              ReceivedMessages{0}
+                {
+                    ClientSocket =
+                        helper::TcpSocket::Connect(helper::Ipv4Address(127, 0, 0, 1), Listener.Port());
+                    ServerSocket = Listener.TryAccept();
+
+                    Message.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(1));
+                }
+
+                void SetReceiver(TcpLayer &layer)
+                {
+                    layer.SetReceiver(
+                        this,
+                        [this](std::shared_ptr<const sd::SomeIpSdMessage>)
+                        { ++ReceivedMessages; });
+                }
+
+                void Poll(std::size_t expectedMessages)
+                {
+                    // Bound the polls to avoid hanging on a lost message
+                    const int cMaxPolls = 10;
+
+                    for (int i = 0; i < cMaxPolls && ReceivedMessages < expectedMessages; ++i)
+                    {
+                        ASSERT_TRUE(Poller.TryPoll(cPollTimeout));
+                    }
+                }
+            };
+
+            TEST_F(SomeIpTcpNetworkLayerTest, WriteCoalescing)
+            {
+                const std::size_t cNumberOfMessages = 10;
+
+                ASSERT_TRUE(ServerSocket);
+                TcpLayer _client(&Poller, std::move(ClientSocket));
+                TcpLayer _server(&Poller, std::move(ServerSocket));
+                SetReceiver(_server);
+
+                // All the messages are queued within the same poll tick
+                for (std::size_t i = 0; i < cNumberOfMessages; ++i)
+                {
+                    _client.Send(Message);
+                }
+                Poll(cNumberOfMessages);
+
+                EXPECT_EQ(cNumberOfMessages, ReceivedMessages);
+                EXPECT_EQ(1, _client.Writes());
+                EXPECT_EQ(0, _server.DroppedPayloads());
+            }
+
+            TEST_F(SomeIpTcpNetworkLayerTest, MagicCookies)
+            {
+                const std::size_t cNumberOfMessages = 2;
+
+                ASSERT_TRUE(ServerSocket);
+                TcpLayer _client(&Poller, std::move(ClientSocket), false, MagicCookieType::Client);
+                TcpLayer _server(&Poller, std::move(ServerSocket), false, MagicCookieType::Server);
+                SetReceiver(_server);
+
+                _client.Send(Message);
+                Poll(1);
+                _client.Send(Message);
+                Poll(cNumberOfMessages);
+
+                // The leading cookies are not delivered as messages
+                EXPECT_EQ(cNumberOfMessages, ReceivedMessages);
+                EXPECT_EQ(cNumberOfMessages, _client.Writes());
+                EXPECT_EQ(0, _server.DiscardedBytes());
+                EXPECT_EQ(0, _server.DroppedPayloads());
+            }
+
+            TEST_F(SomeIpTcpNetworkLayerTest, PeerDisconnection)
+            {
+                const int cPollTimeout = 100;
+
+                ASSERT_TRUE(ServerSocket);
+                TcpLayer _server(&Poller, std::move(ServerSocket));
+
+                ClientSocket.reset();
+                ASSERT_TRUE(Poller.TryPoll(cPollTimeout));
+                EXPECT_FALSE(_server.IsConnected());
+
+                _server.Send(Message);
+                EXPECT_EQ(1, _server.FailedSends());
+            }
+        }
+    }
+}